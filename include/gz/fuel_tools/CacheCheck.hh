@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_CACHECHECK_HH_
+#define GZ_FUEL_TOOLS_CACHECHECK_HH_
+
+namespace gz::fuel_tools
+{
+  /// \brief How batch downloads decide whether the local cache already
+  /// satisfies a resource, so that it isn't downloaded again.
+  enum class CacheCheck
+  {
+    /// \brief Download every resource, replacing the cached copies.
+    NONE,
+
+    /// \brief A resource with a version is satisfied by that version in
+    /// the cache, and a resource without one by any cached version. No
+    /// request is sent for cached resources.
+    PINNED,
+
+    /// \brief Like PINNED, but a resource without a version is satisfied
+    /// only by the latest version on the server, which costs a details
+    /// request per resource. Falls back to PINNED when the server can't be
+    /// reached.
+    TIP
+  };
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_CACHECHECK_HH_
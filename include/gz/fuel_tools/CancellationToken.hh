@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_CANCELLATIONTOKEN_HH_
+#define GZ_FUEL_TOOLS_CANCELLATIONTOKEN_HH_
+
+#include <memory>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::shared_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class CancellationTokenPrivate;
+
+  /// \brief Requests cooperative cancellation of client operations.
+  ///
+  /// Copies of a token share the same state, so a token handed to a
+  /// FuelClient or a Rest client can be cancelled from anywhere else,
+  /// including another thread or a signal handler. Once cancelled, requests
+  /// in flight are aborted, queued downloads are dropped and new requests
+  /// fail right away, until the token is reset.
+  class GZ_FUEL_TOOLS_VISIBLE CancellationToken
+  {
+    /// \brief Constructor. The token starts not cancelled.
+    public: CancellationToken();
+
+    /// \brief Request cancellation. Async-signal-safe.
+    public: void Cancel();
+
+    /// \brief Clear a cancellation request, so that the operations using
+    /// this token can be started again.
+    public: void Reset();
+
+    /// \brief Check whether cancellation was requested. Async-signal-safe.
+    /// \return True if Cancel was called since the last Reset.
+    public: bool Cancelled() const;
+
+    /// \brief Private data pointer, shared between copies.
+    private: std::shared_ptr<CancellationTokenPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_CANCELLATIONTOKEN_HH_
@@ -18,6 +18,8 @@
 #ifndef GZ_FUEL_TOOLS_CLIENTCONFIG_HH_
 #define GZ_FUEL_TOOLS_CLIENTCONFIG_HH_
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,6 +41,25 @@ namespace gz::fuel_tools
   /// \brief Forward Declaration
   class ClientConfigPrivate;
 
+  /// \brief How hard the local cache works to keep installed resources
+  /// intact across a power loss. Resources are always extracted to a
+  /// staging directory and published with a rename, so a crash never leaves
+  /// a partially extracted resource in the cache.
+  enum class DurabilityPolicy
+  {
+    /// \brief Leave flushing to the operating system. A power loss shortly
+    /// after an install may leave empty or truncated files.
+    NONE,
+
+    /// \brief Flush each resource with a single filesystem-wide flush
+    /// before publishing it.
+    BATCHED,
+
+    /// \brief Flush every file as it's written, then every directory,
+    /// before publishing the resource.
+    PER_FILE,
+  };
+
   /// \brief High level interface to Gazebo Fuel.
   ///
   class GZ_FUEL_TOOLS_VISIBLE ClientConfig
@@ -102,6 +123,95 @@ namespace gz::fuel_tools
     /// \param[in] _path path on disk where models are saved.
     public: void SetCacheLocation(const std::string &_path);
 
+    /// \brief Enable or disable HTTP/2 mode for the REST requests issued
+    /// by clients using this configuration. See Rest::SetHttp2.
+    /// \param[in] _enable True to enable HTTP/2 mode.
+    public: void SetHttp2(bool _enable);
+
+    /// \brief Get whether HTTP/2 mode is enabled.
+    /// \return True if HTTP/2 mode is enabled. Default is false.
+    public: bool Http2() const;
+
+    /// \brief Set the memory budget for archive downloads. Clients using
+    /// this configuration admit parallel downloads only while the archives
+    /// they hold in memory fit in the budget, and stream archives larger
+    /// than a quarter of the budget to a temporary file in the cache
+    /// instead.
+    /// \param[in] _bytes Budget in bytes, 0 for no limit.
+    public: void SetDownloadMemoryBudget(std::uint64_t _bytes);
+
+    /// \brief Get the memory budget for archive downloads.
+    /// \return Budget in bytes. Default is 0, meaning no limit.
+    /// \sa SetDownloadMemoryBudget
+    public: std::uint64_t DownloadMemoryBudget() const;
+
+    /// \brief Enable or disable connection pre-warming. When enabled,
+    /// clients constructed with this configuration call FuelClient::Warmup
+    /// in the background, so that the first request doesn't pay for name
+    /// resolution and connection setup. Destroying the client aborts the
+    /// warm-up still in progress.
+    /// \param[in] _enable True to enable pre-warming.
+    public: void SetPrewarm(bool _enable);
+
+    /// \brief Get whether connection pre-warming is enabled.
+    /// \return True if pre-warming is enabled. Default is false.
+    /// \sa SetPrewarm
+    public: bool Prewarm() const;
+
+    /// \brief Set the durability policy of the resources saved to the
+    /// local cache.
+    /// \param[in] _policy Durability policy.
+    public: void SetDurability(DurabilityPolicy _policy);
+
+    /// \brief Get the durability policy of the resources saved to the
+    /// local cache.
+    /// \return Durability policy. Default is DurabilityPolicy::NONE.
+    /// \sa SetDurability
+    public: DurabilityPolicy Durability() const;
+
+    /// \brief Set the number of bytes of cached files that clients keep in
+    /// memory. Files of a given model or world version that are read
+    /// repeatedly, e.g. through FuelClient::CachedModelFileView, are then
+    /// served without touching the filesystem.
+    /// \param[in] _bytes Budget in bytes, 0 to disable the memory tier.
+    public: void SetMemoryCacheBudget(std::uint64_t _bytes);
+
+    /// \brief Get the number of bytes of cached files that clients keep in
+    /// memory.
+    /// \return Budget in bytes. Default is 0, i.e. disabled.
+    /// \sa SetMemoryCacheBudget
+    public: std::uint64_t MemoryCacheBudget() const;
+
+    /// \brief Set the tag under which clients record the resources resolved
+    /// through fetchResourceWithClient, e.g. the name of a world or of a
+    /// simulation job. The recorded resources can then be downloaded ahead
+    /// of the next run with FuelClient::Prefetch. Defaults to the value of
+    /// the GZ_FUEL_USAGE_TAG environment variable.
+    /// \param[in] _tag Usage tag, empty to disable the recording.
+    public: void SetUsageTag(const std::string &_tag);
+
+    /// \brief Get the tag under which clients record the resources they
+    /// resolve.
+    /// \return Usage tag, empty if the recording is disabled.
+    /// \sa SetUsageTag
+    public: std::string UsageTag() const;
+
+    /// \brief Set how often clients revalidate the cached resources used
+    /// the most. When enabled, clients constructed with this configuration
+    /// check in the background, while no interactive or regular transfer is
+    /// running, whether newer versions of those resources exist, and
+    /// download them at background priority. See FuelClient::Revalidate.
+    /// \param[in] _interval Minimum time between two checks of the same
+    /// resource, 0 to disable the background revalidation.
+    public: void SetRevalidationInterval(std::chrono::seconds _interval);
+
+    /// \brief Get how often clients revalidate the cached resources used
+    /// the most.
+    /// \return Interval between two checks of a resource. Default is 0,
+    /// i.e. disabled.
+    /// \sa SetRevalidationInterval
+    public: std::chrono::seconds RevalidationInterval() const;
+
     /// \brief Returns all the client information as a string.
     /// \param[in] _prefix Optional prefix for every line of the string.
     /// \return Client information string
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_DOWNLOADPRIORITY_HH_
+#define GZ_FUEL_TOOLS_DOWNLOADPRIORITY_HH_
+
+namespace gz::fuel_tools
+{
+  /// \brief Priority classes of archive downloads. When transfers have to
+  /// wait for a free slot, higher classes are served first.
+  enum class DownloadPriority
+  {
+    /// \brief Someone is waiting for the resource right now, e.g. a
+    /// simulator resolving a model through fetchResource. Interactive
+    /// transfers can use a few slots reserved for them, both with automatic
+    /// concurrency and with more than one parallel job. Background
+    /// transfers don't start while interactive ones are in flight.
+    INTERACTIVE,
+
+    /// \brief Regular batch download, e.g. a collection download.
+    NORMAL,
+
+    /// \brief Work nobody is waiting for, e.g. prefetching or syncing.
+    BACKGROUND
+  };
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_DOWNLOADPRIORITY_HH_
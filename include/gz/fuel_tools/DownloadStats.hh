@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_DOWNLOADSTATS_HH_
+#define GZ_FUEL_TOOLS_DOWNLOADSTATS_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::vector
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief A change of the number of concurrent transfers made by the
+  /// adaptive concurrency controller.
+  struct GZ_FUEL_TOOLS_VISIBLE ConcurrencyDecision
+  {
+    /// \brief Time elapsed since the controller started measuring.
+    public: std::chrono::steady_clock::duration time{0};
+
+    /// \brief Number of concurrent transfers before the decision.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t previousLimit = 0;
+
+    /// \brief Number of concurrent transfers after the decision.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t limit = 0;
+
+    /// \brief Throughput observed while running at previousLimit, in
+    /// bytes per second.
+    // cppcheck-suppress unusedStructMember
+    public: double throughput = 0;
+
+    /// \brief Mean transfer latency observed while running at
+    /// previousLimit.
+    public: std::chrono::steady_clock::duration latency{0};
+
+    /// \brief Fraction of failed transfers, between 0 and 1, observed while
+    /// running at previousLimit.
+    // cppcheck-suppress unusedStructMember
+    public: double errorRate = 0;
+
+    /// \brief Why the limit changed. E.g.: "throughput increased".
+    public: std::string reason = "";
+  };
+
+  /// \brief Statistics about the archive transfers made by a FuelClient.
+  struct GZ_FUEL_TOOLS_VISIBLE DownloadStats
+  {
+    /// \brief Number of transfers that completed successfully.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t transfers = 0;
+
+    /// \brief Number of transfers that failed.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t failedTransfers = 0;
+
+    /// \brief Number of bytes received.
+    // cppcheck-suppress unusedStructMember
+    public: std::uint64_t bytes = 0;
+
+    /// \brief Time during which at least one transfer was in flight.
+    /// Dividing bytes by this value gives the aggregate throughput.
+    public: std::chrono::steady_clock::duration activeTime{0};
+
+    /// \brief Largest number of transfers in flight at the same time.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t peakConcurrency = 0;
+
+    /// \brief Largest number of bytes reserved at the same time by archives
+    /// downloaded into memory. Stays at 0 without a memory budget, see
+    /// ClientConfig::SetDownloadMemoryBudget.
+    // cppcheck-suppress unusedStructMember
+    public: std::uint64_t peakReservedBytes = 0;
+
+    /// \brief Decisions taken by the adaptive concurrency controller, in
+    /// chronological order. Empty unless the automatic concurrency mode was
+    /// used.
+    public: std::vector<ConcurrencyDecision> decisions;
+  };
+
+  /// \brief Summary of a bulk download, see FuelClient::DownloadOwner.
+  struct GZ_FUEL_TOOLS_VISIBLE BulkDownloadStats
+  {
+    /// \brief Number of distinct models and worlds listed, including the
+    /// model dependencies.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t listed = 0;
+
+    /// \brief Number of models and worlds downloaded.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t downloaded = 0;
+
+    /// \brief Number of models and worlds skipped because they were
+    /// already cached.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t skipped = 0;
+
+    /// \brief Number of models and worlds that failed to download.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t failed = 0;
+
+    /// \brief Number of bytes received by the client during the download.
+    // cppcheck-suppress unusedStructMember
+    public: std::uint64_t bytes = 0;
+
+    /// \brief Wall time of the whole operation, listing included. Dividing
+    /// bytes by this value gives the aggregate throughput.
+    public: std::chrono::steady_clock::duration elapsed{0};
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_DOWNLOADSTATS_HH_
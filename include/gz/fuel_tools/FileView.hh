@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_FILEVIEW_HH_
+#define GZ_FUEL_TOOLS_FILEVIEW_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::shared_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class FileViewPrivate;
+
+  /// \brief Read-only, memory-mapped view of a file, e.g. a mesh or a
+  /// texture in the local cache.
+  ///
+  /// The bytes are read straight from the page cache, without being copied
+  /// into a buffer. Copies of a view share the same mapping and may be
+  /// handed to other threads; the mapping is released with the last copy.
+  /// Opening a file that is already viewed reuses the existing mapping, as
+  /// long as the file didn't change on disk.
+  class GZ_FUEL_TOOLS_VISIBLE FileView
+  {
+    /// \brief Constructor of an empty, invalid view.
+    public: FileView();
+
+    /// \brief Constructor.
+    /// \param[in] _path Path of the file to view.
+    public: explicit FileView(const std::string &_path);
+
+    /// \brief Read a file into memory instead of mapping it. The view then
+    /// never touches the file again, which suits content that is kept
+    /// around, e.g. by the memory tier of the cache.
+    /// \param[in] _path Path of the file to read.
+    /// \return The view, invalid if the file couldn't be read.
+    public: static FileView Load(const std::string &_path);
+
+    /// \brief Get whether the file could be viewed.
+    /// \return True if Data() holds the content of the file.
+    public: bool Valid() const;
+
+    /// \brief Same as Valid.
+    /// \return True if Data() holds the content of the file.
+    public: explicit operator bool() const;
+
+    /// \brief Get the content of the file. The content stays valid as long
+    /// as any copy of this view exists.
+    /// \return Pointer to the first byte. Not null for valid views, even
+    /// of empty files.
+    public: const char *Data() const;
+
+    /// \brief Get the size of the file.
+    /// \return Size in bytes.
+    public: std::size_t Size() const;
+
+    /// \brief Get the path of the file.
+    /// \return Path given to the constructor, empty for invalid views.
+    public: std::string Path() const;
+
+    /// \brief Private data pointer, shared between copies.
+    private: std::shared_ptr<const FileViewPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_FILEVIEW_HH_
@@ -18,13 +18,21 @@
 #ifndef GZ_FUEL_TOOLS_FUELCLIENT_HH_
 #define GZ_FUEL_TOOLS_FUELCLIENT_HH_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
 #include <gz/common/URI.hh>
 
+#include "gz/fuel_tools/CacheCheck.hh"
+#include "gz/fuel_tools/CancellationToken.hh"
+#include "gz/fuel_tools/DownloadPriority.hh"
+#include "gz/fuel_tools/DownloadStats.hh"
+#include "gz/fuel_tools/FileView.hh"
+#include "gz/fuel_tools/MemoryCacheStats.hh"
 #include "gz/fuel_tools/ModelIter.hh"
+#include "gz/fuel_tools/ResourceQuery.hh"
 #include "gz/fuel_tools/RestClient.hh"
 #include "gz/fuel_tools/Result.hh"
 #include "gz/fuel_tools/WorldIter.hh"
@@ -48,6 +56,20 @@ namespace gz::fuel_tools
   class WorldIdentifier;
 
   /// \brief High level interface to Gazebo Fuel
+  ///
+  /// Downloads, listings, cache lookups, usage recording, Revalidate and
+  /// the statistics may be called from several threads at once, they share
+  /// the transfer scheduler and the cache of the client. Changing the
+  /// configuration through Config, or the cancellation token through
+  /// SetCancellationToken, isn't thread safe: do it while no other
+  /// operation runs.
+  ///
+  /// A client whose configuration sets a revalidation interval runs
+  /// Revalidate on a background thread. The thread takes its schedule and
+  /// the servers to check from a copy of the configuration made by the
+  /// constructor, but the updates it downloads use the configuration of
+  /// the client: the servers, the cache location and the durability must
+  /// not be changed on such a client.
   class GZ_FUEL_TOOLS_VISIBLE FuelClient
   {
     /// \brief Default constructor.
@@ -63,10 +85,37 @@ namespace gz::fuel_tools
     /// \brief Destructor
     public: ~FuelClient();
 
-    /// \brief Get a mutable reference to the client configuration.
+    /// \brief Get a mutable reference to the client configuration. The
+    /// configuration must only be changed while no other operation of the
+    /// client runs, see the class description.
     /// \return Mutable reference to the client configuration.
     public: ClientConfig &Config();
 
+    /// \brief Set the token used to cancel the operations of this client.
+    /// Once the token is cancelled, the transfers of downloads, uploads,
+    /// listings and updates in flight are aborted, batch downloads drop the
+    /// items that haven't started, and the affected calls return
+    /// ResultType::CANCELLED. Nothing partially downloaded is left in the
+    /// cache. Reset the token to use the client again.
+    /// \param[in] _token Cancellation token, which may be cancelled from
+    /// another thread or a signal handler.
+    public: void SetCancellationToken(const CancellationToken &_token);
+
+    /// \brief Get the token used to cancel the operations of this client.
+    /// \return The cancellation token.
+    public: const CancellationToken &Cancellation() const;
+
+    /// \brief Warm up the connections to the configured servers. Each
+    /// server is sent a HEAD request, in parallel, which resolves its name
+    /// and performs the TCP and TLS handshakes. Later requests then reuse
+    /// the cached name and TLS session, and in HTTP/2 mode the open
+    /// connection itself, instead of paying for the setup on their critical
+    /// path. Blocks until all servers answered or failed. Failures are
+    /// ignored, the regular requests report them.
+    /// \sa ClientConfig::SetPrewarm to warm up in the background when the
+    /// client is constructed.
+    public: void Warmup();
+
     /// \brief Fetch the details of a model.
     /// \param[in] _id a partially filled out identifier used to fetch models
     /// \remarks Fulfills Get-One requirement
@@ -188,6 +237,42 @@ namespace gz::fuel_tools
     /// \return An iterator of words in the collection.
     public: WorldIter Worlds(const CollectionIdentifier &_id) const;
 
+    /// \brief Returns an iterator over the models of a server matching a
+    /// query. The filters, sort order and page size are applied by the
+    /// server, the local cache is not used.
+    /// \param[in] _server The server to request the operation.
+    /// \param[in] _query Filters, sort order and page size.
+    /// \return A model iterator, empty if the request failed.
+    public: ModelIter Models(const ServerConfig &_server,
+                             const ResourceQuery &_query) const;
+
+    /// \brief Returns an iterator over the models of an owner matching a
+    /// query. The filters, sort order and page size are applied by the
+    /// server, the local cache is not used.
+    /// \param[in] _id Identifier with the server and owner of the models.
+    /// \param[in] _query Filters, sort order and page size.
+    /// \return A model iterator, empty if the request failed.
+    public: ModelIter Models(const ModelIdentifier &_id,
+                             const ResourceQuery &_query) const;
+
+    /// \brief Returns an iterator over the worlds of a server matching a
+    /// query. The filters, sort order and page size are applied by the
+    /// server, the local cache is not used.
+    /// \param[in] _server The server to request the operation.
+    /// \param[in] _query Filters, sort order and page size.
+    /// \return A world iterator, empty if the request failed.
+    public: WorldIter Worlds(const ServerConfig &_server,
+                             const ResourceQuery &_query) const;
+
+    /// \brief Returns an iterator over the worlds of an owner matching a
+    /// query. The filters, sort order and page size are applied by the
+    /// server, the local cache is not used.
+    /// \param[in] _id Identifier with the server and owner of the worlds.
+    /// \param[in] _query Filters, sort order and page size.
+    /// \return A world iterator, empty if the request failed.
+    public: WorldIter Worlds(const WorldIdentifier &_id,
+                             const ResourceQuery &_query) const;
+
     /// \brief Upload a directory as a new model
     /// \param[in] _pathToModelDir a path to a directory containing a model
     /// \param[in] _id An identifier to assign to this new model
@@ -236,14 +321,18 @@ namespace gz::fuel_tools
                 const std::vector<std::string> &_headers);
 
     /// \brief Download a model from Gazebo Fuel. This will override an
-    /// existing local copy of the model.
+    /// existing local copy of the model. The SHA-256 of the archive isn't
+    /// set on _id, which is const: DownloadModels reports it, and
+    /// CachedModelManifest gives the digests of the extracted files.
     /// \param[in] _id The model identifier.
     /// \param[in] _headers Headers to set on the HTTP request.
     /// \param[out] _dependencies List of models that this model depends on.
+    /// \param[in] _priority Priority class of the transfer.
     /// \return Result of the download operation
     public: Result DownloadModel(const ModelIdentifier &_id,
                 const std::vector<std::string> &_headers,
-                std::vector<ModelIdentifier> &_dependencies);
+                std::vector<ModelIdentifier> &_dependencies,
+                DownloadPriority _priority = DownloadPriority::INTERACTIVE);
 
     /// \brief Retrieve the list of dependencies for a model.
     /// \param[in] _id The model identifier.
@@ -262,17 +351,21 @@ namespace gz::fuel_tools
 
     /// \brief Download a world from Gazebo Fuel. This will override an
     /// existing local copy of the world.
-    /// \param[out] _id The world identifier, with local path updated.
+    /// \param[out] _id The world identifier, with local path and SHA-256
+    /// of the archive updated.
     /// \return Result of the download operation
     public: Result DownloadWorld(WorldIdentifier &_id);
 
     /// \brief Download a world from Gazebo Fuel. This will override an
     /// existing local copy of the world.
-    /// \param[out] _id The world identifier, with local path updated.
+    /// \param[out] _id The world identifier, with local path and SHA-256
+    /// of the archive updated.
     /// \param[in] _headers Headers to set on the HTTP request.
+    /// \param[in] _priority Priority class of the transfer.
     /// \return Result of the download operation
     public: Result DownloadWorld(WorldIdentifier &_id,
-                const std::vector<std::string> &_headers);
+                const std::vector<std::string> &_headers,
+                DownloadPriority _priority = DownloadPriority::INTERACTIVE);
 
     /// \brief Download a model from Gazebo Fuel. This will override an
     /// existing local copy of the model.
@@ -294,25 +387,157 @@ namespace gz::fuel_tools
 
     using ModelResult = std::tuple<ModelIdentifier, Result>;
 
-    /// \brief Download a list of models from Gazebo Fuel.
+    /// \brief Download a list of models from Gazebo Fuel. The models with
+    /// the largest FileSize start first, so that the jobs finish at about
+    /// the same time.
     /// \param[in] _ids The list of model ids to download.
     ///   This will also find all recursive dependencies of the models
-    /// \param[in] _jobs Number of parallel jobs to use to download models
+    /// \param[in] _jobs Number of parallel jobs to use to download models.
+    /// Zero enables the automatic concurrency mode, where the number of
+    /// parallel transfers is adjusted from the observed throughput, latency
+    /// and error rate. See DownloadStatistics.
+    /// \param[in] _priority Priority class of the transfers. Use
+    /// DownloadPriority::BACKGROUND for prefetching and syncing, so that
+    /// interactive downloads of the same client don't wait behind them.
+    /// With more than one job, a quarter of them, at least one, is left to
+    /// the interactive downloads of the same client.
+    /// \param[in] _cacheCheck How the models and their dependencies are
+    /// checked against the local cache before downloading them. The
+    /// dependencies of cached models are read from the cache. By default
+    /// every model is downloaded.
     /// \return Result of the download operation.
     //    The resulting vector will be at least the size of the _ids input
     //    vector, but may be larger depending on the number of depedencies
-    //    downloaded
+    //    downloaded. Models satisfied by the cache have the result
+    //    FETCH_ALREADY_EXISTS. The identifiers of the downloaded models
+    //    carry the SHA-256 of their archive.
     public: std::vector<ModelResult> DownloadModels(
                 const std::vector<ModelIdentifier> &_ids,
-                size_t _jobs = 2);
+                size_t _jobs = 2,
+                DownloadPriority _priority = DownloadPriority::NORMAL,
+                CacheCheck _cacheCheck = CacheCheck::NONE);
 
-    /// \brief Download a list of mworlds from Gazebo Fuel.
+    /// \brief Download a list of mworlds from Gazebo Fuel. The worlds with
+    /// the largest FileSize start first, see DownloadModels.
     /// \param[in] _ids The list of world ids to download.
     /// \param[in] _jobs Number of parallel jobs to use to download worlds.
+    /// Zero enables the automatic concurrency mode, see DownloadModels.
+    /// \param[in] _priority Priority class of the transfers.
     /// \return Result of the download operation.
     public: Result DownloadWorlds(
                 const std::vector<WorldIdentifier> &_ids,
-                size_t _jobs = 2);
+                size_t _jobs = 2,
+                DownloadPriority _priority = DownloadPriority::NORMAL);
+
+    /// \brief Download the models and worlds of a collection. Downloads
+    /// start as soon as the first page of the listing is received, instead
+    /// of waiting for the whole listing, and model dependencies are
+    /// downloaded as well.
+    /// The progress is journaled next to the cache, so that downloading the
+    /// collection again after an interruption, such as a crash or a
+    /// cancellation, skips the resources already downloaded and resumes the
+    /// interrupted transfers. The journal is removed once every resource
+    /// was downloaded.
+    /// \param[in] _id The collection.
+    /// \param[in] _models True to download the models of the collection.
+    /// \param[in] _worlds True to download the worlds of the collection.
+    /// \param[in] _jobs Number of parallel downloads. Zero enables the
+    /// automatic concurrency mode, see DownloadModels.
+    /// \param[in] _priority Priority class of the transfers.
+    /// \param[in] _cacheCheck How the models, worlds and dependencies are
+    /// checked against the local cache before downloading them, see
+    /// DownloadModels. By default every resource is downloaded.
+    /// \return FETCH if every resource was downloaded or already cached,
+    /// CANCELLED if the client was cancelled, FETCH_ERROR if the collection
+    /// is empty or a download failed.
+    public: Result DownloadCollection(const CollectionIdentifier &_id,
+                bool _models = true, bool _worlds = true,
+                size_t _jobs = 2,
+                DownloadPriority _priority = DownloadPriority::NORMAL,
+                CacheCheck _cacheCheck = CacheCheck::NONE);
+
+    /// \brief Download all the models and worlds of an owner, such as a
+    /// user or an organization, to mirror its library. Listing pages and
+    /// downloads overlap, duplicates are downloaded once, and the resources
+    /// already cached are skipped. When the listing reports versions, only
+    /// the listed version counts as cached. An interrupted download resumes
+    /// where it stopped, see DownloadCollection.
+    /// \param[in] _server The server to download from.
+    /// \param[in] _owner The owner.
+    /// \param[out] _stats Counts, bytes and elapsed time of the operation.
+    /// \param[in] _jobs Number of parallel downloads. Zero enables the
+    /// automatic concurrency mode, see DownloadModels.
+    /// \param[in] _priority Priority class of the transfers.
+    /// \return FETCH if every resource was downloaded or already cached,
+    /// CANCELLED if the client was cancelled, FETCH_ERROR if the owner has
+    /// no resources or a download failed.
+    public: Result DownloadOwner(const ServerConfig &_server,
+                const std::string &_owner, BulkDownloadStats &_stats,
+                size_t _jobs = 2,
+                DownloadPriority _priority = DownloadPriority::NORMAL);
+
+    /// \brief Record that a model or world was used, under the usage tag of
+    /// the configuration, see ClientConfig::SetUsageTag. File URLs are
+    /// recorded as the resource holding the file. fetchResourceWithClient
+    /// records every resource it resolves. Nothing is recorded if the usage
+    /// tag is empty, but the use still ranks the resource for Revalidate.
+    /// \param[in] _url URL of the resource or of one of its files.
+    /// \return True if the resource was recorded.
+    public: bool RecordUsage(const common::URI &_url);
+
+    /// \brief Get the resources recorded under a usage tag, see
+    /// RecordUsage.
+    /// \param[in] _tag Usage tag, such as a world or job name.
+    /// \return URLs of the models and worlds, most used first.
+    public: std::vector<std::string> UsedResources(
+                const std::string &_tag) const;
+
+    /// \brief Download the resources recorded under a usage tag which
+    /// aren't cached yet, e.g. while a container image is built or a job is
+    /// queued, so that the next run finds them in the cache. Resources
+    /// recorded without a version count as cached if any version is. An
+    /// interrupted prefetch resumes where it stopped, see
+    /// DownloadCollection.
+    /// \param[in] _tag Usage tag, such as a world or job name.
+    /// \param[out] _stats Counts, bytes and elapsed time of the operation.
+    /// \param[in] _jobs Number of parallel downloads. Zero enables the
+    /// automatic concurrency mode, see DownloadModels.
+    /// \param[in] _priority Priority class of the transfers.
+    /// \return FETCH if every resource was downloaded or already cached,
+    /// CANCELLED if the client was cancelled, FETCH_ERROR if nothing was
+    /// recorded under the tag or a download failed.
+    public: Result Prefetch(const std::string &_tag,
+                BulkDownloadStats &_stats, size_t _jobs = 4,
+                DownloadPriority _priority = DownloadPriority::BACKGROUND);
+
+    /// \brief Check whether newer versions of the cached resources used the
+    /// most exist, and download them at background priority. Resources are
+    /// ranked by the sessions that recorded them in the usage history, see
+    /// RecordUsage, plus the uses seen by this client. Each resource is
+    /// checked at most once per ClientConfig::RevalidationInterval, with a
+    /// conditional request when the server returned an entity tag before.
+    /// Resources pinned to a version are never revalidated.
+    /// Clients whose configuration sets a revalidation interval call this
+    /// function in the background while no interactive or regular transfer
+    /// is running.
+    /// \param[out] _stats Summary of the pass: resources checked (listed),
+    /// updated (downloaded), up to date (skipped) and failed.
+    /// \param[in] _max Maximum number of cached resources to check.
+    /// \return FETCH if every resource was checked, CANCELLED if the client
+    /// was cancelled, FETCH_ERROR if a check or a download failed.
+    public: Result Revalidate(BulkDownloadStats &_stats,
+                std::size_t _max = 8);
+
+    /// \brief Get statistics about the archives downloaded by this client,
+    /// including the decisions taken by the automatic concurrency mode.
+    /// \return Download statistics since the client was created.
+    public: DownloadStats DownloadStatistics() const;
+
+    /// \brief Get statistics about the files served from memory by
+    /// CachedModelFileView and CachedWorldFileView.
+    /// \return Memory tier statistics since the client was created.
+    /// \sa ClientConfig::SetMemoryCacheBudget
+    public: MemoryCacheStats MemoryCacheStatistics() const;
 
     /// \brief Check if a model is already present in the local cache.
     /// \param[in] _id The model identifier
@@ -367,6 +592,75 @@ namespace gz::fuel_tools
     public: Result CachedWorldFile(const common::URI &_fileUrl,
                                    std::string &_path);
 
+    /// \brief Get a read-only, memory-mapped view of a file belonging to a
+    /// model in the local cache. Loaders can read the bytes from the view
+    /// instead of opening and reading the file again.
+    /// \param[in] _fileUrl The unique URL of the file on a Fuel server. E.g.:
+    /// https://server.org/1.0/owner/models/model/files/meshes/mesh.dae
+    /// \param[out] _view View of the cached file.
+    /// \return FETCH_ERROR if not cached, FETCH_ALREADY_EXISTS if cached.
+    /// \sa CachedModelFile
+    /// \sa ClientConfig::SetMemoryCacheBudget
+    public: Result CachedModelFileView(const common::URI &_fileUrl,
+                                       FileView &_view);
+
+    /// \brief Get a read-only, memory-mapped view of a file belonging to a
+    /// world in the local cache.
+    /// \param[in] _fileUrl The unique URL of the file on a Fuel server. E.g.:
+    /// https://server.org/1.0/owner/worlds/world/files/name.world
+    /// \param[out] _view View of the cached file.
+    /// \return FETCH_ERROR if not cached, FETCH_ALREADY_EXISTS if cached.
+    /// \sa CachedWorldFile
+    /// \sa ClientConfig::SetMemoryCacheBudget
+    public: Result CachedWorldFileView(const common::URI &_fileUrl,
+                                       FileView &_view);
+
+    /// \brief Get the SHA-256 digests of the files of a cached model. They
+    /// are computed while the model is extracted, so they describe the
+    /// files as served, before model.config is rewritten to use Fuel URLs.
+    /// \param[in] _modelUrl The unique URL of the model on a Fuel server.
+    /// E.g.: https://fuel.gazebosim.org/1.0/caguero/models/Beer
+    /// \param[out] _hashes Hexadecimal digests by path within the model.
+    /// \return FETCH_ERROR if not cached or cached without digests,
+    /// FETCH_ALREADY_EXISTS otherwise.
+    public: Result CachedModelManifest(const common::URI &_modelUrl,
+                std::map<std::string, std::string> &_hashes);
+
+    /// \brief Get the SHA-256 digests of the files of a cached world, as
+    /// they were served.
+    /// \param[in] _worldUrl The unique URL of the world on a Fuel server.
+    /// E.g.: https://fuel.gazebosim.org/1.0/OpenRobotics/worlds/Empty
+    /// \param[out] _hashes Hexadecimal digests by path within the world.
+    /// \return FETCH_ERROR if not cached or cached without digests,
+    /// FETCH_ALREADY_EXISTS otherwise.
+    public: Result CachedWorldManifest(const common::URI &_worldUrl,
+                std::map<std::string, std::string> &_hashes);
+
+    /// \brief Refresh the offline search index of a server from its model
+    /// listing. The index is stored in the cache, next to the models of the
+    /// server, and is only rewritten when the listing changed.
+    ///
+    /// The first call lists all the models. Later calls only list the
+    /// models modified since, newest first, so models deleted from the
+    /// server stay indexed until the index file is removed.
+    /// \param[in] _server The server to index.
+    /// \return FETCH_ERROR if any page of the listing couldn't be
+    /// retrieved, in which case the index is left unchanged, or if the
+    /// index couldn't be saved. FETCH_ALREADY_EXISTS if the index was up to
+    /// date, FETCH otherwise.
+    /// \sa SearchModels
+    public: Result UpdateSearchIndex(const ServerConfig &_server);
+
+    /// \brief Search the models of the configured servers without any
+    /// network access, using the indexes built by UpdateSearchIndex.
+    /// \param[in] _query Words to look for, case insensitive. All the
+    /// words must match the name, owner, tags, description or license of a
+    /// model, either fully or as a prefix.
+    /// \param[in] _limit Maximum number of results, 0 for no limit.
+    /// \return The matching models, best matches first.
+    public: std::vector<ModelIdentifier> SearchModels(
+                const std::string &_query, std::size_t _limit = 20) const;
+
     /// \brief Parse model identifier from model URL or unique name.
     /// \param[in] _modelUrl The unique URL of a model. It may also be a
     /// unique name, which is a URL without the server version.
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_HTTPHEADERS_HH_
+#define GZ_FUEL_TOOLS_HTTPHEADERS_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief forward declaration
+  class HttpHeadersPrivate;
+
+  /// \brief Headers of an HTTP response. Names are compared without regard
+  /// to case, since HTTP/2 servers send them in lower case. All the names
+  /// and values share a single buffer, and raw header lines are parsed
+  /// without copying them first.
+  ///
+  /// Views returned by Value, Name and ETag remain valid until the headers
+  /// are modified or destroyed.
+  class GZ_FUEL_TOOLS_VISIBLE HttpHeaders
+  {
+    /// \brief Constructor of an empty set of headers.
+    public: HttpHeaders();
+
+    /// \brief Copy constructor.
+    /// \param[in] _orig The headers to copy.
+    public: HttpHeaders(const HttpHeaders &_orig);
+
+    /// \brief Move constructor.
+    /// \param[in] _orig The headers to move.
+    public: HttpHeaders(HttpHeaders &&_orig) noexcept;
+
+    /// \brief Assignment operator overload.
+    /// \param[in] _orig The headers to copy.
+    public: HttpHeaders &operator=(const HttpHeaders &_orig);
+
+    /// \brief Move assignment operator overload.
+    /// \param[in] _orig The headers to move.
+    public: HttpHeaders &operator=(HttpHeaders &&_orig) noexcept;
+
+    /// \brief Destructor.
+    public: ~HttpHeaders();
+
+    /// \brief Parse a raw header line, as received from the server, e.g.
+    /// "Content-Type: application/zip\r\n". The line doesn't need to be
+    /// null-terminated. A status line, such as "HTTP/2 200", starts a new
+    /// response and clears the headers of the previous one, so that only
+    /// the headers of the last response are kept when redirects are
+    /// followed.
+    /// \param[in] _line Raw header line.
+    /// \return True if the line was a header and was added.
+    public: bool Parse(std::string_view _line);
+
+    /// \brief Add a header. Existing headers with the same name are kept.
+    /// \param[in] _name Name of the header.
+    /// \param[in] _value Value of the header.
+    public: void Add(std::string_view _name, std::string_view _value);
+
+    /// \brief Remove all the headers.
+    public: void Clear();
+
+    /// \brief Get the number of headers.
+    /// \return Number of headers.
+    public: std::size_t Size() const;
+
+    /// \brief Get whether there are no headers.
+    /// \return True if there are no headers.
+    public: bool Empty() const;
+
+    /// \brief Get the name of a header, as sent by the server.
+    /// \param[in] _index Index of the header, smaller than Size().
+    /// \return Name of the header.
+    public: std::string_view Name(std::size_t _index) const;
+
+    /// \brief Get the value of a header.
+    /// \param[in] _index Index of the header, smaller than Size().
+    /// \return Value of the header.
+    public: std::string_view Value(std::size_t _index) const;
+
+    /// \brief Get whether a header is present.
+    /// \param[in] _name Name of the header, in any case.
+    /// \return True if the header is present.
+    public: bool Has(std::string_view _name) const;
+
+    /// \brief Get the value of the first header with a name.
+    /// \param[in] _name Name of the header, in any case.
+    /// \return Value of the header, empty if missing.
+    public: std::string_view Value(std::string_view _name) const;
+
+    /// \brief Get the value of a header holding an unsigned integer.
+    /// \param[in] _name Name of the header, in any case.
+    /// \param[out] _value Value of the header. Unchanged on failure.
+    /// \return True if the header is present and holds an integer.
+    public: bool UInt(std::string_view _name, std::uint64_t &_value) const;
+
+    /// \brief Get the version of a Fuel resource, from the
+    /// X-Ign-Resource-Version header.
+    /// \param[out] _version Version of the resource. Unchanged on failure.
+    /// \return True if the header is present and holds a version.
+    public: bool ResourceVersion(unsigned int &_version) const;
+
+    /// \brief Get the size of the body, from the Content-Length header.
+    /// \param[out] _length Size of the body in bytes. Unchanged on failure.
+    /// \return True if the header is present and holds a size.
+    public: bool ContentLength(std::uint64_t &_length) const;
+
+    /// \brief Get the media type of the body, from the Content-Type header,
+    /// without parameters such as the charset, e.g. "application/zip".
+    /// \return Media type in lower case, empty if missing.
+    public: std::string ContentType() const;
+
+    /// \brief Get the entity tag of the response, from the ETag header,
+    /// e.g. "\"5d8c72a5\"" or "W/\"5d8c72a5\"".
+    /// \return Entity tag, quotes included, empty if missing.
+    public: std::string_view ETag() const;
+
+    /// \brief Get the target of a link from the Link headers, e.g. the URL
+    /// of the next page of a listing with LinkUrl("next").
+    /// \param[in] _rel Relation type of the link, in any case.
+    /// \return URL of the first link with the relation, empty if missing.
+    public: std::string LinkUrl(std::string_view _rel) const;
+
+    /// \brief PIMPL
+    private: std::unique_ptr<HttpHeadersPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_HTTPHEADERS_HH_
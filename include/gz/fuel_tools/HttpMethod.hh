@@ -49,7 +49,10 @@ namespace gz::fuel_tools
     POST_FORM,
 
     /// \brief Patch form method.
-    PATCH_FORM
+    PATCH_FORM,
+
+    /// \brief Head method.
+    HEAD
   };
 }  // namespace gz::fuel_tools
 
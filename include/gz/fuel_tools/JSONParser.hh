@@ -19,6 +19,7 @@
 #define GZ_FUEL_TOOLS_JSONPARSER_HH_
 
 #include <map>
+#include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,6 +87,25 @@ namespace gz::fuel_tools
     /// \return A JSON string representing a single world
     public: static std::string BuildWorld(WorldIter _worldIt);
 
+    /// \brief Write all the models of an iterator as a compact JSON array.
+    /// Unlike BuildModel, no document is built in memory: the models are
+    /// serialized one at a time into a small buffer that is flushed to the
+    /// stream, so catalogs of any size can be exported. Each element holds
+    /// the description, name, owner and version of a model. Strings are
+    /// written as UTF-8, only the characters JSON requires are escaped.
+    /// \param[in] _modelIt Models to write.
+    /// \param[out] _out Stream to write to.
+    /// \return True if the stream is still good after writing.
+    public: static bool WriteModels(ModelIter _modelIt, std::ostream &_out);
+
+    /// \brief Write all the worlds of an iterator as a compact JSON array,
+    /// without building a document in memory, see WriteModels. Each element
+    /// holds the name, owner and version of a world.
+    /// \param[in] _worldIt Worlds to write.
+    /// \param[out] _out Stream to write to.
+    /// \return True if the stream is still good after writing.
+    public: static bool WriteWorlds(WorldIter _worldIt, std::ostream &_out);
+
     /// \brief Parse a license array JSON string and return a map of
     /// licenses.
     /// \param[in] _json JSON string containing an array of models
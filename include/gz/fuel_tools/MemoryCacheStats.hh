@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_MEMORYCACHESTATS_HH_
+#define GZ_FUEL_TOOLS_MEMORYCACHESTATS_HH_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "gz/fuel_tools/Export.hh"
+
+namespace gz::fuel_tools
+{
+  /// \brief Statistics about the in-memory tier of the local cache, see
+  /// ClientConfig::SetMemoryCacheBudget.
+  struct GZ_FUEL_TOOLS_VISIBLE MemoryCacheStats
+  {
+    /// \brief Number of lookups served from memory.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t hits = 0;
+
+    /// \brief Number of lookups that had to read the file.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t misses = 0;
+
+    /// \brief Number of files dropped to stay within the budget.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t evictions = 0;
+
+    /// \brief Number of files currently held.
+    // cppcheck-suppress unusedStructMember
+    public: std::size_t entries = 0;
+
+    /// \brief Number of bytes currently held.
+    // cppcheck-suppress unusedStructMember
+    public: std::uint64_t bytes = 0;
+  };
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_MEMORYCACHESTATS_HH_
@@ -18,6 +18,7 @@
 #ifndef GZ_FUEL_TOOLS_MODELIDENTIFIER_HH_
 #define GZ_FUEL_TOOLS_MODELIDENTIFIER_HH_
 
+#include <array>
 #include <cstdint>
 #include <ctime>
 #include <memory>
@@ -232,14 +233,15 @@ namespace gz::fuel_tools
     /// \sa SetVersion
     public: bool SetVersionStr(const std::string &_version);
 
-    // /// \brief returns a SHA 2 256 hash of the model
-    // /// \remarks fulfills versioning requirement
-    // public: std::array<std::uint8_t, 32> SHA_256() const;
+    /// \brief Returns a SHA 2 256 hash of the model archive, computed
+    /// while it was downloaded, see FuelClient::DownloadModels.
+    /// \return The hash, all zeros if unknown.
+    public: std::array<std::uint8_t, 32> SHA_256() const;
 
-    // /// \brief Sets the SHA 2 256 hash of the model
-    // /// \param[in] _hash a 256 bit SHA 2 hash
-    // /// \returns true if successful
-    // public: bool SHA_256(const std::array<std::uint8_t, 32> &_hash);
+    /// \brief Sets the SHA 2 256 hash of the model archive.
+    /// \param[in] _hash a 256 bit SHA 2 hash
+    /// \returns true if successful
+    public: bool SHA_256(const std::array<std::uint8_t, 32> &_hash);
 
     /// \brief Returns all the model information as a string. Convenient for
     /// debugging.
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_RESOURCEQUERY_HH_
+#define GZ_FUEL_TOOLS_RESOURCEQUERY_HH_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief forward declaration
+  class ResourceQueryPrivate;
+
+  /// \brief Filters, sort order and page size of a model or world listing.
+  /// They are sent to the server as query parameters, so that only the
+  /// matching resources are transferred.
+  ///
+  /// Example, the 10 most downloaded models matching "vehicle":
+  ///
+  /// \code
+  /// ResourceQuery query;
+  /// query.SetSearch("vehicle");
+  /// query.SetSort("downloads", ResourceQuery::SortOrder::DESCENDING);
+  /// query.SetPerPage(10);
+  /// for (auto iter = client.Models(server, query); iter; ++iter)
+  /// \endcode
+  class GZ_FUEL_TOOLS_VISIBLE ResourceQuery
+  {
+    /// \brief Sort order of the results.
+    public: enum class SortOrder
+    {
+      /// \brief Smallest values first.
+      ASCENDING,
+
+      /// \brief Largest values first.
+      DESCENDING
+    };
+
+    /// \brief Constructor of an empty query, which lists everything in the
+    /// server's default order.
+    public: ResourceQuery();
+
+    /// \brief Copy constructor.
+    /// \param[in] _orig The query to copy.
+    public: ResourceQuery(const ResourceQuery &_orig);
+
+    /// \brief Assignment operator overload.
+    /// \param[in] _orig The query to copy.
+    public: ResourceQuery &operator=(const ResourceQuery &_orig);
+
+    /// \brief Destructor.
+    public: ~ResourceQuery();
+
+    /// \brief Reset the query to an empty query.
+    public: void Clear();
+
+    /// \brief Set the search terms. The server matches them against names,
+    /// descriptions and tags. Sent as the "q" parameter.
+    /// \param[in] _search Search terms, empty for no search.
+    public: void SetSearch(const std::string &_search);
+
+    /// \brief Get the search terms.
+    /// \return Search terms, empty if not set.
+    public: std::string Search() const;
+
+    /// \brief Set the field to sort the results by. Sent as the "sort" and
+    /// "order" parameters.
+    /// \param[in] _field Field name, such as "name", "downloads", "likes",
+    /// "createdAt" or "updatedAt". Empty for the server's default order.
+    /// \param[in] _order Sort order.
+    public: void SetSort(const std::string &_field,
+                         SortOrder _order = SortOrder::ASCENDING);
+
+    /// \brief Get the field the results are sorted by.
+    /// \return Field name, empty if not set.
+    public: std::string SortField() const;
+
+    /// \brief Get the sort order.
+    /// \return Sort order.
+    public: SortOrder Order() const;
+
+    /// \brief Set the number of results returned by each request. Larger
+    /// pages mean fewer round trips, smaller pages mean less data when only
+    /// the first results are used. Sent as the "per_page" parameter.
+    /// \param[in] _perPage Results per page, 0 for the server's default.
+    public: void SetPerPage(std::size_t _perPage);
+
+    /// \brief Get the number of results returned by each request.
+    /// \return Results per page, 0 for the server's default.
+    public: std::size_t PerPage() const;
+
+    /// \brief Set any other query parameter supported by the server, e.g.
+    /// SetFilter("tags", "vehicle").
+    /// \param[in] _key Name of the parameter. The "page" parameter is
+    /// reserved for pagination and ignored.
+    /// \param[in] _value Value of the parameter, empty to remove it.
+    public: void SetFilter(const std::string &_key, const std::string &_value);
+
+    /// \brief Get the additional query parameters.
+    /// \return Values by parameter name.
+    public: std::map<std::string, std::string> Filters() const;
+
+    /// \brief Get the query parameters sent to the server, percent-encoded,
+    /// in the form "key=value".
+    /// \return Query parameters, empty for an empty query.
+    public: std::vector<std::string> QueryStrings() const;
+
+    /// \brief PIMPL
+    private: std::unique_ptr<ResourceQueryPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_RESOURCEQUERY_HH_
@@ -17,12 +17,16 @@
 #ifndef GZ_FUEL_TOOLS_RESTCLIENT_HH_
 #define GZ_FUEL_TOOLS_RESTCLIENT_HH_
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "gz/fuel_tools/CancellationToken.hh"
 #include "gz/fuel_tools/Export.hh"
+#include "gz/fuel_tools/HttpHeaders.hh"
 #include "gz/fuel_tools/HttpMethod.hh"
 
 #ifdef _WIN32
@@ -34,6 +38,9 @@
 
 namespace gz::fuel_tools
 {
+  /// \brief Forward declaration
+  class RestPrivate;
+
   /// \brief Stores a response to a RESTful request
   struct GZ_FUEL_TOOLS_VISIBLE RestResponse
   {
@@ -44,17 +51,41 @@ namespace gz::fuel_tools
     /// \brief The data received.
     public: std::string data = "";
 
-    /// \brief Map of headers where the key is the header type.
-    /// For example, a raw header of the form "Content-Type: json" would
-    /// use "Content-Type" as a key and "json" as the key's data.
-    public: std::map<std::string, std::string> headers;
+    /// \brief Headers of the response. Names are case-insensitive, e.g.
+    /// headers.Value("content-type") and headers.Value("Content-Type") both
+    /// return "json" for a raw header of the form "Content-Type: json".
+    /// Only the headers of the last response are kept when redirects are
+    /// followed.
+    public: HttpHeaders headers;
+
+    /// \brief Path of the file holding the data received, when the body
+    /// was streamed to disk by Rest::Download instead of being kept in
+    /// memory. Empty otherwise, in which case the body is in `data`.
+    public: std::string dataPath = "";
+
+    /// \brief SHA-256 digest of the data received, computed as it arrived,
+    /// whether it was kept in memory or streamed to disk. All zeros if
+    /// unknown, e.g. for responses that didn't come from Rest.
+    public: std::array<std::uint8_t, 32> sha256{};
   };
 
   /// \brief A helper class for making REST requests.
   class GZ_FUEL_TOOLS_VISIBLE Rest
   {
     /// \brief Default constructor.
-    public: Rest() = default;
+    public: Rest();
+
+    /// \brief Copy constructor.
+    /// \param[in] _orig Rest to copy.
+    public: Rest(const Rest &_orig);
+
+    /// \brief Destructor.
+    public: virtual ~Rest();
+
+    /// \brief Assignment operator.
+    /// \param[in] _orig Rest to copy.
+    /// \return Reference to this object.
+    public: Rest &operator=(const Rest &_orig);
 
     /// \brief Trigger a REST request.
     /// \param[in] _method The HTTP method. Use all uppercase letters.
@@ -90,6 +121,42 @@ namespace gz::fuel_tools
         const std::multimap<std::string, std::string> &_form =
         std::multimap<std::string, std::string>()) const;
 
+    /// \brief Trigger a GET request whose body may be too large to hold in
+    /// memory. The body is kept in RestResponse::data while it is smaller
+    /// than _spillThreshold. Bodies announced larger than the threshold
+    /// through their Content-Length, or that grow past it, are streamed to
+    /// _spillPath instead and RestResponse::dataPath is set. The caller owns
+    /// the spilled file.
+    ///
+    /// When _resume is true and _spillPath already holds the beginning of
+    /// the body, such as after an interrupted transfer, only the rest is
+    /// requested. When the server sends it, the response looks as if the
+    /// whole body was received: the status is 200, and the hash and
+    /// Content-Length cover the whole file. A server that ignores the range
+    /// sends the whole body again, and one that rejects it answers with a
+    /// status of 416, which the caller may handle by removing _spillPath
+    /// and downloading again.
+    /// \param[in] _url The url to request.
+    /// \param[in] _version The protocol version.
+    /// \param[in] _path The path to request.
+    /// \param[in] _queryStrings All the query strings to be requested.
+    /// \param[in] _headers All the headers to be included in the request.
+    /// \param[in] _spillPath File the body is written to once it exceeds
+    /// _spillThreshold. When empty, the body is always kept in memory.
+    /// \param[in] _spillThreshold Largest body, in bytes, kept in memory.
+    /// \param[in] _resume True to continue the body from the end of
+    /// _spillPath. Only set it for requests answered with the file itself,
+    /// e.g. not for one answered with a referral link to the file.
+    /// \return The response.
+    public: virtual RestResponse Download(const std::string &_url,
+        const std::string &_version,
+        const std::string &_path,
+        const std::vector<std::string> &_queryStrings,
+        const std::vector<std::string> &_headers,
+        const std::string &_spillPath,
+        std::uint64_t _spillThreshold,
+        bool _resume = false) const;
+
     /// \brief Set the user agent name.
     /// \param[in] _agent User agent name.
     public: void SetUserAgent(const std::string &_agent);
@@ -98,8 +165,36 @@ namespace gz::fuel_tools
     /// \return Name of the user agent.
     public: const std::string &UserAgent() const;
 
+    /// \brief Enable or disable HTTP/2 mode. When enabled, requests
+    /// negotiate HTTP/2 over TLS and are driven by a process-wide transfer
+    /// engine, so that concurrent requests to the same server are
+    /// multiplexed over a single connection instead of each paying for its
+    /// own TCP and TLS handshake. Servers, or libcurl builds, without
+    /// HTTP/2 support transparently fall back to HTTP/1.1 with connection
+    /// reuse. Disabled by default.
+    /// \param[in] _enable True to enable HTTP/2 mode.
+    public: void SetHttp2(bool _enable);
+
+    /// \brief Get whether HTTP/2 mode is enabled.
+    /// \return True if HTTP/2 mode is enabled.
+    /// \sa SetHttp2
+    public: bool Http2() const;
+
+    /// \brief Set the token used to cancel requests. Copies of this client
+    /// share the token. Requests issued while it is cancelled fail right
+    /// away with a status code of 0, and requests in flight are aborted.
+    /// \param[in] _token Cancellation token.
+    public: void SetCancellationToken(const CancellationToken &_token);
+
+    /// \brief Get the token used to cancel requests.
+    /// \return The cancellation token.
+    public: const CancellationToken &Cancellation() const;
+
     /// \brief The user agent name.
     private: std::string userAgent;
+
+    /// \brief Private data.
+    private: std::unique_ptr<RestPrivate> dataPtr;
   };
 }  // namespace gz::fuel_tools
 
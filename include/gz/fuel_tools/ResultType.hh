@@ -72,6 +72,9 @@ namespace gz::fuel_tools
 
     /// \brief Patch successful.
     PATCH,
+
+    /// \brief Operation cancelled through a CancellationToken.
+    CANCELLED,
   };
 }  // namespace gz::fuel_tools
 
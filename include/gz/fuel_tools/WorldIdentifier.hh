@@ -18,6 +18,8 @@
 #ifndef GZ_FUEL_TOOLS_WORLDIDENTIFIER_HH_
 #define GZ_FUEL_TOOLS_WORLDIDENTIFIER_HH_
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -135,10 +137,15 @@ namespace gz::fuel_tools
     /// \remarks this is Server/Owner/Name.
     public: gz::common::URI Url() const;
 
-    // /// \brief Sets the SHA 2 256 hash of the world
-    // /// \param[in] _hash a 256 bit SHA 2 hash
-    // /// \returns true if successful
-    // public: bool SHA_256(const std::array<std::uint8_t, 32> &_hash);
+    /// \brief Returns a SHA 2 256 hash of the world archive, computed
+    /// while it was downloaded, see FuelClient::DownloadWorld.
+    /// \return The hash, all zeros if unknown.
+    public: std::array<std::uint8_t, 32> SHA_256() const;
+
+    /// \brief Sets the SHA 2 256 hash of the world archive.
+    /// \param[in] _hash a 256 bit SHA 2 hash
+    /// \returns true if successful
+    public: bool SHA_256(const std::array<std::uint8_t, 32> &_hash);
 
     /// \brief Returns all the world information as a string. Convenient for
     /// debugging.
@@ -162,6 +169,15 @@ namespace gz::fuel_tools
     /// false indicates the world is public.
     public: void SetPrivate(bool _private);
 
+    /// \brief Returns the file size of the world in bytes.
+    /// \return World file size in bytes, 0 if unknown.
+    public: unsigned int FileSize() const;
+
+    /// \brief Set the file size of the world in bytes.
+    /// \param[in] _fileSize The world's file size in bytes.
+    /// \return True if successful.
+    public: bool SetFileSize(const unsigned int _fileSize);
+
     /// \brief PIMPL
     private: std::unique_ptr<WorldIdentifierPrivate> dataPtr;
   };
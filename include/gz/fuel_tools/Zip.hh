@@ -17,6 +17,8 @@
 #ifndef GZ_FUEL_TOOLS_ZIP_HH_
 #define GZ_FUEL_TOOLS_ZIP_HH_
 
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,8 +39,27 @@ namespace gz::fuel_tools
     /// \brief Extract a compressed file
     /// \param[in] _src Path to compressed file
     /// \param[in] _dst Output extracted file path
+    /// \param[in] _sync True to flush every extracted file to storage
+    /// \param[out] _hashes Optional hexadecimal SHA-256 digests of the
+    /// extracted files by entry name, computed as they are extracted
     public: static bool Extract(const std::string &_src,
-        const std::string &_dst);
+        const std::string &_dst, bool _sync = false,
+        std::map<std::string, std::string> *_hashes = nullptr);
+
+    /// \brief Extract an archive held in memory, e.g. a downloaded archive
+    /// or a shared mapping of a file. The memory isn't copied.
+    /// \param[in] _data Content of the archive
+    /// \param[in] _size Size of the archive in bytes
+    /// \param[in] _dst Output extracted file path
+    /// \param[in] _sync True to flush every extracted file to storage
+    /// \param[out] _hashes Optional hexadecimal SHA-256 digests of the
+    /// extracted files by entry name, computed as they are extracted
+    /// \return True on success. False if any entry is unreadable, truncated
+    /// or fails its checksum, or can't be written, in which case _dst may
+    /// hold a partial tree and should be discarded.
+    public: static bool ExtractBuffer(const char *_data, std::size_t _size,
+        const std::string &_dst, bool _sync = false,
+        std::map<std::string, std::string> *_hashes = nullptr);
   };
 }  // namespace gz::fuel_tools
 
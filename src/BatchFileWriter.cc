@@ -0,0 +1,581 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+// io_uring is driven through raw system calls, which avoids a dependency
+// on liburing. Opening and closing files through the ring needs Linux 5.6.
+#if defined(__linux__) && defined(IORING_FEAT_RW_CUR_POS)
+#define GZ_FUEL_TOOLS_HAVE_IO_URING
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Util.hh>
+
+#include "BatchFileWriter.hh"
+#include "FileSync.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Largest number of files written in one batch.
+static constexpr std::size_t kBatchFiles = 128;
+
+/// \brief Number of queued bytes that triggers writing a batch.
+static constexpr std::size_t kBatchBytes = 8 * 1024 * 1024;
+
+/// \brief A file waiting to be written.
+struct PendingFile
+{
+  /// \brief Path of the file.
+  std::string path;
+
+  /// \brief Content of the file.
+  std::string data;
+};
+
+#ifdef GZ_FUEL_TOOLS_HAVE_IO_URING
+/// \brief Minimal io_uring instance, set up without liburing.
+class IoUring
+{
+  /// \brief Destructor.
+  public: ~IoUring()
+          {
+            if (this->sqes)
+              munmap(this->sqes, this->sqesSize);
+            if (this->cqPtr && this->cqPtr != this->sqPtr)
+              munmap(this->cqPtr, this->cqSize);
+            if (this->sqPtr)
+              munmap(this->sqPtr, this->sqSize);
+            if (this->fd >= 0)
+              close(this->fd);
+          }
+
+  /// \brief Set up the ring and check that the kernel supports the
+  /// operations used to write files.
+  /// \param[in] _entries Number of submission queue entries.
+  /// \return True on success.
+  public: bool Init(unsigned _entries)
+          {
+            io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            this->fd = static_cast<int>(
+                syscall(__NR_io_uring_setup, _entries, &params));
+            if (this->fd < 0)
+              return false;
+
+            this->sqSize =
+              params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            this->cqSize =
+              params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (singleMmap)
+              this->sqSize = this->cqSize = std::max(this->sqSize, this->cqSize);
+
+            this->sqPtr = mmap(nullptr, this->sqSize, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, this->fd, IORING_OFF_SQ_RING);
+            if (this->sqPtr == MAP_FAILED)
+            {
+              this->sqPtr = nullptr;
+              return false;
+            }
+
+            if (singleMmap)
+            {
+              this->cqPtr = this->sqPtr;
+            }
+            else
+            {
+              this->cqPtr = mmap(nullptr, this->cqSize,
+                  PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                  this->fd, IORING_OFF_CQ_RING);
+              if (this->cqPtr == MAP_FAILED)
+              {
+                this->cqPtr = nullptr;
+                return false;
+              }
+            }
+
+            this->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void *sqesPtr = mmap(nullptr, this->sqesSize,
+                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd,
+                IORING_OFF_SQES);
+            if (sqesPtr == MAP_FAILED)
+              return false;
+            this->sqes = static_cast<io_uring_sqe *>(sqesPtr);
+
+            auto *sq = static_cast<char *>(this->sqPtr);
+            this->sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+            this->sqMask =
+              *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+            this->sqArray =
+              reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+            this->sqEntries = params.sq_entries;
+
+            auto *cq = static_cast<char *>(this->cqPtr);
+            this->cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+            this->cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+            this->cqMask =
+              *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+            this->cqes =
+              reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+            return this->Supports({IORING_OP_OPENAT, IORING_OP_WRITE,
+                IORING_OP_FSYNC, IORING_OP_CLOSE});
+          }
+
+  /// \brief Get the number of submission queue entries.
+  /// \return Number of entries.
+  public: unsigned Entries() const
+          {
+            return this->sqEntries;
+          }
+
+  /// \brief Get the next submission queue entry, cleared. At most Entries()
+  /// entries may be queued before calling Submit.
+  /// \return The entry.
+  public: io_uring_sqe *NextSqe()
+          {
+            const unsigned tail = this->localTail++;
+            const unsigned index = tail & this->sqMask;
+            io_uring_sqe *sqe = &this->sqes[index];
+            std::memset(sqe, 0, sizeof(*sqe));
+            this->sqArray[index] = index;
+            return sqe;
+          }
+
+  /// \brief Submit the queued entries and wait for all their completions.
+  /// \param[out] _cqes Completions, in completion order.
+  /// \return False if the ring failed, in which case it must not be used
+  /// anymore.
+  public: bool SubmitAndWait(std::vector<io_uring_cqe> &_cqes)
+          {
+            _cqes.clear();
+            unsigned toSubmit = this->localTail - this->submittedTail;
+            const unsigned expected = toSubmit;
+            __atomic_store_n(this->sqTail, this->localTail, __ATOMIC_RELEASE);
+            this->submittedTail = this->localTail;
+
+            while (_cqes.size() < expected)
+            {
+              int ret = static_cast<int>(syscall(__NR_io_uring_enter,
+                  this->fd, toSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+              if (ret < 0)
+              {
+                if (errno == EINTR)
+                  continue;
+                return false;
+              }
+              toSubmit -= std::min<unsigned>(ret, toSubmit);
+
+              unsigned head = *this->cqHead;
+              const unsigned tail =
+                __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE);
+              for (; head != tail; ++head)
+                _cqes.push_back(this->cqes[head & this->cqMask]);
+              __atomic_store_n(this->cqHead, head, __ATOMIC_RELEASE);
+            }
+            return true;
+          }
+
+  /// \brief Check that the kernel supports a set of operations.
+  /// \param[in] _ops Operations to check.
+  /// \return True if all of them are supported.
+  private: bool Supports(std::initializer_list<int> _ops) const
+           {
+             constexpr unsigned kProbeOps = 256;
+             std::vector<char> buffer(sizeof(io_uring_probe) +
+                 kProbeOps * sizeof(io_uring_probe_op), 0);
+             auto *probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+             if (syscall(__NR_io_uring_register, this->fd,
+                   IORING_REGISTER_PROBE, probe, kProbeOps) < 0)
+             {
+               return false;
+             }
+
+             for (int op : _ops)
+             {
+               if (op > probe->last_op ||
+                   !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+               {
+                 return false;
+               }
+             }
+             return true;
+           }
+
+  /// \brief Ring file descriptor.
+  private: int fd = -1;
+
+  /// \brief Submission ring mapping.
+  private: void *sqPtr = nullptr;
+
+  /// \brief Completion ring mapping, may alias sqPtr.
+  private: void *cqPtr = nullptr;
+
+  /// \brief Size of the submission ring mapping.
+  private: std::size_t sqSize = 0;
+
+  /// \brief Size of the completion ring mapping.
+  private: std::size_t cqSize = 0;
+
+  /// \brief Size of the submission queue entries mapping.
+  private: std::size_t sqesSize = 0;
+
+  /// \brief Submission queue entries.
+  private: io_uring_sqe *sqes = nullptr;
+
+  /// \brief Submission ring tail, shared with the kernel.
+  private: unsigned *sqTail = nullptr;
+
+  /// \brief Submission ring index array, shared with the kernel.
+  private: unsigned *sqArray = nullptr;
+
+  /// \brief Submission ring mask.
+  private: unsigned sqMask = 0;
+
+  /// \brief Number of submission queue entries.
+  private: unsigned sqEntries = 0;
+
+  /// \brief Tail including the entries not submitted yet.
+  private: unsigned localTail = 0;
+
+  /// \brief Tail as of the last submission.
+  private: unsigned submittedTail = 0;
+
+  /// \brief Completion ring head, shared with the kernel.
+  private: unsigned *cqHead = nullptr;
+
+  /// \brief Completion ring tail, shared with the kernel.
+  private: unsigned *cqTail = nullptr;
+
+  /// \brief Completion ring mask.
+  private: unsigned cqMask = 0;
+
+  /// \brief Completion queue entries.
+  private: io_uring_cqe *cqes = nullptr;
+};
+#endif
+
+/// \brief Private data class
+class BatchFileWriterPrivate
+{
+  /// \brief Write the queued files.
+  /// \return False if any of them failed.
+  public: bool WriteBatch()
+          {
+            bool result = true;
+#ifdef GZ_FUEL_TOOLS_HAVE_IO_URING
+            if (this->ring)
+            {
+              result = this->WriteBatchIoUring();
+              this->pending.clear();
+              this->pendingBytes = 0;
+              return result;
+            }
+#endif
+            for (const auto &file : this->pending)
+              result = WriteFile(file) && result;
+            this->pending.clear();
+            this->pendingBytes = 0;
+            return result;
+          }
+
+  /// \brief Write a file with a regular stream.
+  /// \param[in] _file File to write.
+  /// \return True on success.
+  public: bool WriteFile(const PendingFile &_file) const
+          {
+            std::ofstream out(_file.path, std::ios::out | std::ios::binary);
+            out.write(_file.data.data(), _file.data.size());
+            out.close();
+            if (out.fail() || (this->sync && !syncFile(_file.path)))
+            {
+              gzerr << "Failed to write file [" << _file.path << "]"
+                    << std::endl;
+              return false;
+            }
+            gzdbg << "Created file [" << _file.path << "]" << std::endl;
+            return true;
+          }
+
+#ifdef GZ_FUEL_TOOLS_HAVE_IO_URING
+  /// \brief Write the queued files through io_uring.
+  /// \return False if any of them failed.
+  public: bool WriteBatchIoUring()
+          {
+            const std::size_t count = this->pending.size();
+            std::vector<int> fds(count, -1);
+            std::vector<io_uring_cqe> cqes;
+
+            // Open all the files.
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              io_uring_sqe *sqe = this->ring->NextSqe();
+              sqe->opcode = IORING_OP_OPENAT;
+              sqe->fd = AT_FDCWD;
+              sqe->addr = reinterpret_cast<std::uint64_t>(
+                  this->pending[i].path.c_str());
+              sqe->len = 0666;
+              sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+              sqe->user_data = i;
+            }
+            if (!this->ring->SubmitAndWait(cqes))
+            {
+              // Some files may have been opened before the failure.
+              for (const auto &cqe : cqes)
+                fds[cqe.user_data] = cqe.res;
+              return this->Abandon(fds);
+            }
+
+            for (const auto &cqe : cqes)
+              fds[cqe.user_data] = cqe.res;
+
+            // Write, optionally flush, and close the files that could be
+            // opened. The entries of a file are linked, so each one only
+            // runs once the previous one completed in full.
+            enum Step { kWrite, kSync, kClose };
+            std::vector<int> written(count, 0);
+            std::vector<int> closed(count, -ECANCELED);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              if (fds[i] < 0)
+                continue;
+
+              const std::string &data = this->pending[i].data;
+              io_uring_sqe *sqe = this->ring->NextSqe();
+              sqe->opcode = IORING_OP_WRITE;
+              sqe->fd = fds[i];
+              sqe->addr = reinterpret_cast<std::uint64_t>(data.data());
+              sqe->len = static_cast<unsigned>(data.size());
+              sqe->off = 0;
+              sqe->flags = IOSQE_IO_LINK;
+              sqe->user_data = (i << 2) | kWrite;
+
+              if (this->sync)
+              {
+                sqe = this->ring->NextSqe();
+                sqe->opcode = IORING_OP_FSYNC;
+                sqe->fd = fds[i];
+                sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+                sqe->flags = IOSQE_IO_LINK;
+                sqe->user_data = (i << 2) | kSync;
+              }
+
+              sqe = this->ring->NextSqe();
+              sqe->opcode = IORING_OP_CLOSE;
+              sqe->fd = fds[i];
+              sqe->user_data = (i << 2) | kClose;
+            }
+            if (!this->ring->SubmitAndWait(cqes))
+            {
+              // Only a cancelled close leaves its descriptor open.
+              for (const auto &cqe : cqes)
+              {
+                if ((cqe.user_data & 3) == kClose && cqe.res != -ECANCELED)
+                  fds[cqe.user_data >> 2] = -1;
+              }
+              return this->Abandon(fds);
+            }
+
+            for (const auto &cqe : cqes)
+            {
+              const std::size_t i = cqe.user_data >> 2;
+              if ((cqe.user_data & 3) == kClose)
+                closed[i] = cqe.res;
+              else if ((cqe.user_data & 3) == kWrite)
+                written[i] = cqe.res;
+            }
+
+            bool result = true;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              const PendingFile &file = this->pending[i];
+              if (fds[i] < 0)
+              {
+                gzerr << "Failed to open file [" << file.path << "]: "
+                      << std::strerror(-fds[i]) << std::endl;
+                result = false;
+                continue;
+              }
+
+              // A failed close still releases the descriptor.
+              if (closed[i] < 0 && closed[i] != -ECANCELED)
+              {
+                gzerr << "Failed to write file [" << file.path << "]: "
+                      << std::strerror(-closed[i]) << std::endl;
+                result = false;
+                continue;
+              }
+
+              // A short write or a failed flush cancels the linked close,
+              // finish the file synchronously.
+              if (closed[i] == -ECANCELED)
+              {
+                std::size_t offset = std::max(written[i], 0);
+                while (offset < file.data.size())
+                {
+                  ssize_t n = pwrite(fds[i], file.data.data() + offset,
+                      file.data.size() - offset, offset);
+                  if (n < 0 && errno == EINTR)
+                    continue;
+                  if (n <= 0)
+                    break;
+                  offset += n;
+                }
+                bool ok = offset == file.data.size() &&
+                  (!this->sync || fdatasync(fds[i]) == 0);
+                ok = close(fds[i]) == 0 && ok;
+                if (!ok)
+                {
+                  gzerr << "Failed to write file [" << file.path << "]"
+                        << std::endl;
+                  result = false;
+                  continue;
+                }
+              }
+              gzdbg << "Created file [" << file.path << "]" << std::endl;
+            }
+            return result;
+          }
+
+  /// \brief Stop using a ring that failed, and write the batch with
+  /// regular streams.
+  /// \param[in] _fds Descriptors opened through the ring that are still
+  /// open, negative entries are skipped.
+  /// \return False if any file failed.
+  public: bool Abandon(const std::vector<int> &_fds)
+          {
+            gzwarn << "io_uring failed, falling back to regular file writes."
+                   << std::endl;
+            // Tearing the ring down first makes sure none of its requests
+            // still uses the descriptors.
+            this->ring.reset();
+            for (int fd : _fds)
+            {
+              if (fd >= 0)
+                close(fd);
+            }
+
+            bool result = true;
+            for (const auto &file : this->pending)
+              result = WriteFile(file) && result;
+            return result;
+          }
+
+  /// \brief The ring, null when io_uring isn't used.
+  public: std::unique_ptr<IoUring> ring;
+#endif
+
+  /// \brief True to flush each file to storage.
+  public: bool sync = false;
+
+  /// \brief Files waiting to be written.
+  public: std::vector<PendingFile> pending;
+
+  /// \brief Number of bytes waiting to be written.
+  public: std::size_t pendingBytes = 0;
+
+  /// \brief False once a file failed to be written.
+  public: bool ok = true;
+};
+
+//////////////////////////////////////////////////
+BatchFileWriter::BatchFileWriter(bool _allowIoUring)
+  : dataPtr(new BatchFileWriterPrivate)
+{
+  this->dataPtr->pending.reserve(kBatchFiles);
+
+#ifdef GZ_FUEL_TOOLS_HAVE_IO_URING
+  std::string disable;
+  if (_allowIoUring && !gz::common::env("GZ_FUEL_DISABLE_IO_URING", disable))
+  {
+    // Each file of a batch needs up to three entries: write, flush and
+    // close.
+    auto ring = std::make_unique<IoUring>();
+    if (ring->Init(4 * kBatchFiles) && ring->Entries() >= 3 * kBatchFiles)
+      this->dataPtr->ring = std::move(ring);
+  }
+#else
+  (void)_allowIoUring;
+#endif
+}
+
+//////////////////////////////////////////////////
+BatchFileWriter::~BatchFileWriter()
+{
+  this->Flush();
+}
+
+//////////////////////////////////////////////////
+bool BatchFileWriter::Write(const std::string &_path, std::string _data)
+{
+  this->dataPtr->pendingBytes += _data.size();
+  this->dataPtr->pending.push_back({_path, std::move(_data)});
+
+  if (this->dataPtr->pending.size() >= kBatchFiles ||
+      this->dataPtr->pendingBytes >= kBatchBytes)
+  {
+    this->dataPtr->ok = this->dataPtr->WriteBatch() && this->dataPtr->ok;
+  }
+  return this->dataPtr->ok;
+}
+
+//////////////////////////////////////////////////
+bool BatchFileWriter::Flush()
+{
+  if (!this->dataPtr->pending.empty())
+    this->dataPtr->ok = this->dataPtr->WriteBatch() && this->dataPtr->ok;
+
+  bool result = this->dataPtr->ok;
+  this->dataPtr->ok = true;
+  return result;
+}
+
+//////////////////////////////////////////////////
+void BatchFileWriter::SetSync(bool _sync)
+{
+  this->dataPtr->sync = _sync;
+}
+
+//////////////////////////////////////////////////
+bool BatchFileWriter::UsingIoUring() const
+{
+#ifdef GZ_FUEL_TOOLS_HAVE_IO_URING
+  return this->dataPtr->ring != nullptr;
+#else
+  return false;
+#endif
+}
+}  // namespace gz::fuel_tools
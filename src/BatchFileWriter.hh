@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_BATCHFILEWRITER_HH_
+#define GZ_FUEL_TOOLS_BATCHFILEWRITER_HH_
+
+#include <memory>
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class BatchFileWriterPrivate;
+
+  /// \brief Writes many small files with as few system calls as possible.
+  ///
+  /// Files are queued in memory and written in batches. On Linux, each
+  /// batch goes through io_uring: the files of a batch are opened with one
+  /// submission, then written and closed with a second one, instead of
+  /// three system calls per file. When io_uring is unavailable, e.g. on
+  /// older kernels, other platforms, or sandboxes that forbid it, or when
+  /// the GZ_FUEL_DISABLE_IO_URING environment variable is set, the files
+  /// are written one by one with regular streams.
+  ///
+  /// Files are only guaranteed to exist once Flush returned. The parent
+  /// directories must exist beforehand.
+  class GZ_FUEL_TOOLS_VISIBLE BatchFileWriter
+  {
+    /// \brief Constructor.
+    /// \param[in] _allowIoUring False to always use the portable path.
+    public: explicit BatchFileWriter(bool _allowIoUring = true);
+
+    /// \brief Destructor. Flushes the files still queued.
+    public: ~BatchFileWriter();
+
+    /// \brief Queue a file. A full batch is written right away.
+    /// \param[in] _path Path of the file, replaced if it exists.
+    /// \param[in] _data Content of the file.
+    /// \return False if writing a batch failed.
+    public: bool Write(const std::string &_path, std::string _data);
+
+    /// \brief Write all the queued files.
+    /// \return False if any file of this batch, or of an earlier batch
+    /// written by Write, failed.
+    public: bool Flush();
+
+    /// \brief Flush each file to storage before closing it, so that it
+    /// survives a power loss once Flush returned. Disabled by default.
+    /// \param[in] _sync True to flush the files.
+    public: void SetSync(bool _sync);
+
+    /// \brief Get whether the files are written through io_uring.
+    /// \return True if io_uring is used.
+    public: bool UsingIoUring() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<BatchFileWriterPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_BATCHFILEWRITER_HH_
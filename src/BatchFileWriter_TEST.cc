@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "BatchFileWriter.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+/// \brief Read a whole file.
+/// \param[in] _path Path of the file.
+/// \return Content of the file.
+static std::string readFile(const std::string &_path)
+{
+  std::ifstream in(_path, std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+class BatchFileWriterTest : public ::testing::TestWithParam<bool>
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+/// \brief Write more files than fit in one batch, with both backends.
+TEST_P(BatchFileWriterTest, WriteFiles)
+{
+  const std::string dir = common::joinPaths(this->tempDir->Path(), "files");
+  ASSERT_TRUE(common::createDirectories(dir));
+
+  BatchFileWriter writer(GetParam());
+  if (!GetParam())
+  {
+    EXPECT_FALSE(writer.UsingIoUring());
+  }
+
+  std::vector<std::string> paths;
+  std::vector<std::string> contents;
+  for (int i = 0; i < 300; ++i)
+  {
+    paths.push_back(common::joinPaths(dir, "file" + std::to_string(i)));
+    // Include empty and multi-page files.
+    contents.push_back(std::string((i * 97) % 9000, 'a' + i % 26));
+    EXPECT_TRUE(writer.Write(paths.back(), contents.back()));
+  }
+  EXPECT_TRUE(writer.Flush());
+
+  for (std::size_t i = 0; i < paths.size(); ++i)
+  {
+    ASSERT_TRUE(common::isFile(paths[i])) << paths[i];
+    EXPECT_EQ(contents[i], readFile(paths[i])) << paths[i];
+  }
+
+  // Existing files are truncated.
+  EXPECT_TRUE(writer.Write(paths[10], "short"));
+  EXPECT_TRUE(writer.Flush());
+  EXPECT_EQ("short", readFile(paths[10]));
+}
+
+/////////////////////////////////////////////////
+/// \brief A failed file is reported, and doesn't prevent writing the others.
+TEST_P(BatchFileWriterTest, MissingDirectory)
+{
+  BatchFileWriter writer(GetParam());
+
+  const std::string good = common::joinPaths(this->tempDir->Path(), "good");
+  const std::string bad =
+    common::joinPaths(this->tempDir->Path(), "missing", "bad");
+  writer.Write(bad, "bad");
+  writer.Write(good, "good");
+  EXPECT_FALSE(writer.Flush());
+
+  EXPECT_FALSE(common::exists(bad));
+  EXPECT_EQ("good", readFile(good));
+
+  // The failure is only reported once.
+  writer.Write(good, "again");
+  EXPECT_TRUE(writer.Flush());
+  EXPECT_EQ("again", readFile(good));
+}
+
+/////////////////////////////////////////////////
+/// \brief Files flushed to storage are written the same way.
+TEST_P(BatchFileWriterTest, Sync)
+{
+  BatchFileWriter writer(GetParam());
+  writer.SetSync(true);
+
+  std::vector<std::string> paths;
+  for (int i = 0; i < 200; ++i)
+  {
+    paths.push_back(common::joinPaths(this->tempDir->Path(),
+        "file" + std::to_string(i)));
+    EXPECT_TRUE(writer.Write(paths.back(), std::to_string(i)));
+  }
+  EXPECT_TRUE(writer.Flush());
+
+  for (std::size_t i = 0; i < paths.size(); ++i)
+    EXPECT_EQ(std::to_string(i), readFile(paths[i]));
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, BatchFileWriterTest,
+    ::testing::Values(true, false));
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "BatchOrder.hh"
+
+namespace gz::fuel_tools
+{
+//////////////////////////////////////////////////
+std::vector<std::size_t> largestFirst(const std::vector<std::uint64_t> &_sizes)
+{
+  std::uint64_t total = 0;
+  std::size_t known = 0;
+  for (auto size : _sizes)
+  {
+    if (size > 0)
+    {
+      total += size;
+      ++known;
+    }
+  }
+  const std::uint64_t mean = known > 0 ? total / known : 0;
+
+  std::vector<std::size_t> order(_sizes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+      [&](std::size_t _a, std::size_t _b)
+      {
+        auto sizeA = _sizes[_a] > 0 ? _sizes[_a] : mean;
+        auto sizeB = _sizes[_b] > 0 ? _sizes[_b] : mean;
+        return sizeA > sizeB;
+      });
+  return order;
+}
+}  // namespace gz::fuel_tools
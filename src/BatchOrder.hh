@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_BATCHORDER_HH_
+#define GZ_FUEL_TOOLS_BATCHORDER_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Order the items of a batch download largest first, i.e. the
+/// longest processing time rule. Workers taking the next item from that
+/// order finish within 4/3 of the shortest possible time, whereas in
+/// listing order a large item near the end keeps one worker busy long
+/// after the others ran out of work.
+///
+/// Items of unknown size count as the mean of the known sizes. Items of
+/// equal size keep their listing order.
+/// \param[in] _sizes Size of each item in bytes, 0 if unknown.
+/// \return Indices of the items, in download order.
+GZ_FUEL_TOOLS_VISIBLE
+std::vector<std::size_t> largestFirst(const std::vector<std::uint64_t> &_sizes);
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_BATCHORDER_HH_
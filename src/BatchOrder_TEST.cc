@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "BatchOrder.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+TEST(BatchOrder, LargestFirst)
+{
+  EXPECT_TRUE(largestFirst({}).empty());
+
+  // Ties keep the listing order.
+  EXPECT_EQ((std::vector<std::size_t>{3, 1, 0, 2}),
+      largestFirst({10, 20, 10, 500}));
+
+  // Unknown sizes count as the mean known size, 100 here.
+  EXPECT_EQ((std::vector<std::size_t>{1, 0, 3, 2}),
+      largestFirst({0, 150, 50, 100}));
+
+  // Without any size the listing order is kept.
+  EXPECT_EQ((std::vector<std::size_t>{0, 1, 2}), largestFirst({0, 0, 0}));
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+
+#include "gz/fuel_tools/CancellationToken.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Private data class
+class CancellationTokenPrivate
+{
+  /// \brief True once cancellation was requested.
+  public: std::atomic<bool> cancelled{false};
+};
+
+//////////////////////////////////////////////////
+CancellationToken::CancellationToken()
+  : dataPtr(std::make_shared<CancellationTokenPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+void CancellationToken::Cancel()
+{
+  this->dataPtr->cancelled = true;
+}
+
+//////////////////////////////////////////////////
+void CancellationToken::Reset()
+{
+  this->dataPtr->cancelled = false;
+}
+
+//////////////////////////////////////////////////
+bool CancellationToken::Cancelled() const
+{
+  return this->dataPtr->cancelled;
+}
+}  // namespace gz::fuel_tools
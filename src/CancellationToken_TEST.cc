@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "gz/fuel_tools/CancellationToken.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+TEST(CancellationToken, CancelAndReset)
+{
+  CancellationToken token;
+  EXPECT_FALSE(token.Cancelled());
+
+  token.Cancel();
+  EXPECT_TRUE(token.Cancelled());
+
+  // Cancelling twice is harmless.
+  token.Cancel();
+  EXPECT_TRUE(token.Cancelled());
+
+  token.Reset();
+  EXPECT_FALSE(token.Cancelled());
+}
+
+/////////////////////////////////////////////////
+TEST(CancellationToken, CopiesShareState)
+{
+  CancellationToken token;
+  CancellationToken copy(token);
+  CancellationToken other;
+
+  std::thread canceller([copy]() mutable
+  {
+    copy.Cancel();
+  });
+  canceller.join();
+
+  EXPECT_TRUE(token.Cancelled());
+  EXPECT_TRUE(copy.Cancelled());
+  EXPECT_FALSE(other.Cancelled());
+
+  other = token;
+  token.Reset();
+  EXPECT_FALSE(other.Cancelled());
+}
@@ -16,6 +16,8 @@
 */
 
 #include <yaml.h>
+#include <chrono>
+#include <cstdint>
 #include <cstdio>
 #include <sstream>
 #include <stack>
@@ -53,6 +55,13 @@ class ClientConfigPrivate
             this->configPath = "";
             this->userAgent =
               "GazeboFuelTools-" GZ_FUEL_TOOLS_VERSION_FULL;
+            this->http2 = false;
+            this->downloadMemoryBudget = 0;
+            this->prewarm = false;
+            this->durability = DurabilityPolicy::NONE;
+            this->memoryCacheBudget = 0;
+            this->usageTag = "";
+            this->revalidationInterval = std::chrono::seconds(0);
           }
 
   /// \brief A list of servers.
@@ -67,11 +76,34 @@ class ClientConfigPrivate
   /// \brief Name of the user agent.
   public: std::string userAgent =
           "GazeboFuelTools-" GZ_FUEL_TOOLS_VERSION_FULL;
+
+  /// \brief True if HTTP/2 mode is enabled.
+  public: bool http2 = false;
+
+  /// \brief Memory budget for archive downloads in bytes, 0 for no limit.
+  public: std::uint64_t downloadMemoryBudget = 0;
+
+  /// \brief True if clients warm up their connections when constructed.
+  public: bool prewarm = false;
+
+  /// \brief Durability policy of the local cache.
+  public: DurabilityPolicy durability = DurabilityPolicy::NONE;
+
+  /// \brief Memory tier budget of the local cache in bytes, 0 to disable.
+  public: std::uint64_t memoryCacheBudget = 0;
+
+  /// \brief Tag of the recorded resource usage, empty to disable.
+  public: std::string usageTag = "";
+
+  /// \brief Interval of the background revalidation, 0 to disable.
+  public: std::chrono::seconds revalidationInterval{0};
 };
 
 //////////////////////////////////////////////////
 ClientConfig::ClientConfig() : dataPtr(new ClientConfigPrivate)
 {
+  gz::common::env("GZ_FUEL_USAGE_TAG", this->dataPtr->usageTag);
+
   std::string gzFuelPath = "";
   if (!gz::common::env("GZ_FUEL_CACHE_PATH", gzFuelPath))
   {
@@ -358,6 +390,90 @@ void ClientConfig::SetCacheLocation(const std::string &_path)
   this->dataPtr->cacheLocation = _path;
 }
 
+//////////////////////////////////////////////////
+void ClientConfig::SetHttp2(bool _enable)
+{
+  this->dataPtr->http2 = _enable;
+}
+
+//////////////////////////////////////////////////
+bool ClientConfig::Http2() const
+{
+  return this->dataPtr->http2;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetDownloadMemoryBudget(std::uint64_t _bytes)
+{
+  this->dataPtr->downloadMemoryBudget = _bytes;
+}
+
+//////////////////////////////////////////////////
+std::uint64_t ClientConfig::DownloadMemoryBudget() const
+{
+  return this->dataPtr->downloadMemoryBudget;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetPrewarm(bool _enable)
+{
+  this->dataPtr->prewarm = _enable;
+}
+
+//////////////////////////////////////////////////
+bool ClientConfig::Prewarm() const
+{
+  return this->dataPtr->prewarm;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetDurability(DurabilityPolicy _policy)
+{
+  this->dataPtr->durability = _policy;
+}
+
+//////////////////////////////////////////////////
+DurabilityPolicy ClientConfig::Durability() const
+{
+  return this->dataPtr->durability;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetMemoryCacheBudget(std::uint64_t _bytes)
+{
+  this->dataPtr->memoryCacheBudget = _bytes;
+}
+
+//////////////////////////////////////////////////
+std::uint64_t ClientConfig::MemoryCacheBudget() const
+{
+  return this->dataPtr->memoryCacheBudget;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetUsageTag(const std::string &_tag)
+{
+  this->dataPtr->usageTag = _tag;
+}
+
+//////////////////////////////////////////////////
+std::string ClientConfig::UsageTag() const
+{
+  return this->dataPtr->usageTag;
+}
+
+//////////////////////////////////////////////////
+void ClientConfig::SetRevalidationInterval(std::chrono::seconds _interval)
+{
+  this->dataPtr->revalidationInterval = _interval;
+}
+
+//////////////////////////////////////////////////
+std::chrono::seconds ClientConfig::RevalidationInterval() const
+{
+  return this->dataPtr->revalidationInterval;
+}
+
 //////////////////////////////////////////////////
 void ClientConfig::SetUserAgent(const std::string &_agent)
 {
@@ -259,6 +259,102 @@ TEST_F(ClientConfigTest, UserAgent)
   EXPECT_EQ("my_user_agent", config.UserAgent());
 }
 
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, Http2)
+{
+  ClientConfig config;
+  EXPECT_FALSE(config.Http2());
+
+  config.SetHttp2(true);
+  EXPECT_TRUE(config.Http2());
+
+  ClientConfig copy(config);
+  EXPECT_TRUE(copy.Http2());
+
+  config.Clear();
+  EXPECT_FALSE(config.Http2());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, DownloadMemoryBudget)
+{
+  ClientConfig config;
+  EXPECT_EQ(0u, config.DownloadMemoryBudget());
+
+  config.SetDownloadMemoryBudget(64u * 1024u * 1024u);
+  EXPECT_EQ(64u * 1024u * 1024u, config.DownloadMemoryBudget());
+
+  ClientConfig copy(config);
+  EXPECT_EQ(64u * 1024u * 1024u, copy.DownloadMemoryBudget());
+
+  config.Clear();
+  EXPECT_EQ(0u, config.DownloadMemoryBudget());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, Prewarm)
+{
+  ClientConfig config;
+  EXPECT_FALSE(config.Prewarm());
+
+  config.SetPrewarm(true);
+  EXPECT_TRUE(config.Prewarm());
+
+  ClientConfig copy(config);
+  EXPECT_TRUE(copy.Prewarm());
+
+  config.Clear();
+  EXPECT_FALSE(config.Prewarm());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, RevalidationInterval)
+{
+  ClientConfig config;
+  EXPECT_EQ(std::chrono::seconds(0), config.RevalidationInterval());
+
+  config.SetRevalidationInterval(std::chrono::hours(1));
+  EXPECT_EQ(std::chrono::seconds(3600), config.RevalidationInterval());
+
+  ClientConfig copy(config);
+  EXPECT_EQ(std::chrono::seconds(3600), copy.RevalidationInterval());
+
+  config.Clear();
+  EXPECT_EQ(std::chrono::seconds(0), config.RevalidationInterval());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, Durability)
+{
+  ClientConfig config;
+  EXPECT_EQ(DurabilityPolicy::NONE, config.Durability());
+
+  config.SetDurability(DurabilityPolicy::PER_FILE);
+  EXPECT_EQ(DurabilityPolicy::PER_FILE, config.Durability());
+
+  ClientConfig copy(config);
+  EXPECT_EQ(DurabilityPolicy::PER_FILE, copy.Durability());
+
+  config.Clear();
+  EXPECT_EQ(DurabilityPolicy::NONE, config.Durability());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ClientConfigTest, MemoryCacheBudget)
+{
+  ClientConfig config;
+  EXPECT_EQ(0u, config.MemoryCacheBudget());
+
+  config.SetMemoryCacheBudget(1024u);
+  EXPECT_EQ(1024u, config.MemoryCacheBudget());
+
+  ClientConfig copy(config);
+  EXPECT_EQ(1024u, copy.MemoryCacheBudget());
+
+  config.Clear();
+  EXPECT_EQ(0u, config.MemoryCacheBudget());
+}
+
 /////////////////////////////////////////////////
 TEST_F(ClientConfigTest, AsString)
 {
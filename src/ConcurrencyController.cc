@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ConcurrencyController.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Fraction of failed transfers in a round above which the limit is
+/// halved.
+static constexpr double kMaxErrorRate = 0.1;
+
+/// \brief Minimum relative throughput gain for an increase of the limit to
+/// be considered useful.
+static constexpr double kMinGain = 0.05;
+
+/// \brief Growth of the mean latency, relative to the lowest observed,
+/// above which a stalled throughput is attributed to congestion.
+static constexpr double kMaxLatencyGrowth = 2.0;
+
+/// \brief Number of rounds to hold the limit after backing off, before
+/// probing a higher limit again.
+static constexpr int kHoldRounds = 4;
+
+/// \brief Number of rounds to wait before probing again a limit at which
+/// transfers failed.
+static constexpr int kCeilingRounds = 16;
+
+/// \brief Private data class
+class ConcurrencyControllerPrivate
+{
+  /// \brief Close the current round and compute the new limit.
+  /// \param[in] _now Time at which the round ends.
+  /// \return True if the limit changed.
+  public: bool EndRound(std::chrono::steady_clock::time_point _now);
+
+  /// \brief Minimum limit.
+  public: std::size_t min = 1;
+
+  /// \brief Maximum limit.
+  public: std::size_t max = 16;
+
+  /// \brief Current limit.
+  public: std::size_t limit = 2;
+
+  /// \brief True once the first transfer completed.
+  public: bool started = false;
+
+  /// \brief Time at which the first measured transfer started.
+  public: std::chrono::steady_clock::time_point start;
+
+  /// \brief Time at which the current round started.
+  public: std::chrono::steady_clock::time_point roundStart;
+
+  /// \brief Bytes received in the current round.
+  public: std::uint64_t roundBytes = 0;
+
+  /// \brief Transfers completed in the current round.
+  public: std::size_t roundCount = 0;
+
+  /// \brief Transfers failed in the current round.
+  public: std::size_t roundFailures = 0;
+
+  /// \brief Sum of the latencies of the current round.
+  public: std::chrono::steady_clock::duration roundLatency{0};
+
+  /// \brief True if a round was completed before.
+  public: bool hasLastRound = false;
+
+  /// \brief Throughput of the previous round, in bytes per second.
+  public: double lastThroughput = 0;
+
+  /// \brief Limit in effect during the previous round.
+  public: std::size_t lastLimit = 0;
+
+  /// \brief Lowest mean latency of a round seen so far.
+  public: std::chrono::steady_clock::duration minLatency =
+          std::chrono::steady_clock::duration::max();
+
+  /// \brief True while holding the limit after backing off.
+  public: bool holding = false;
+
+  /// \brief Number of rounds spent holding.
+  public: int holdRounds = 0;
+
+  /// \brief Lowest limit at which transfers failed, 0 if none did.
+  public: std::size_t ceiling = 0;
+
+  /// \brief Number of rounds since transfers failed.
+  public: int ceilingRounds = 0;
+
+  /// \brief Decisions taken so far.
+  public: std::vector<ConcurrencyDecision> decisions;
+};
+
+//////////////////////////////////////////////////
+bool ConcurrencyControllerPrivate::EndRound(
+    std::chrono::steady_clock::time_point _now)
+{
+  double seconds =
+    std::chrono::duration<double>(_now - this->roundStart).count();
+  double throughput = seconds > 0 ? this->roundBytes / seconds : 0;
+  std::chrono::steady_clock::duration latency = this->roundLatency /
+    static_cast<std::chrono::steady_clock::rep>(this->roundCount);
+  double errorRate =
+    static_cast<double>(this->roundFailures) / this->roundCount;
+
+  std::size_t newLimit = this->limit;
+  std::string reason;
+
+  // Don't go back to a limit at which transfers failed too soon.
+  ++this->ceilingRounds;
+  std::size_t maxLimit = this->max;
+  if (this->ceiling > 0 && this->ceilingRounds < kCeilingRounds)
+    maxLimit = std::max(this->min, this->ceiling - 1);
+
+  if (errorRate > kMaxErrorRate)
+  {
+    newLimit = std::max(this->min, this->limit / 2);
+    reason = "transfers failed";
+    this->holding = true;
+    this->holdRounds = 0;
+    this->ceiling = this->limit;
+    this->ceilingRounds = 0;
+  }
+  else if (this->hasLastRound && this->limit > this->lastLimit &&
+      throughput < this->lastThroughput * (1 + kMinGain))
+  {
+    newLimit = this->lastLimit;
+    reason = "no throughput gain";
+    this->holding = true;
+    this->holdRounds = 0;
+  }
+  else if (this->hasLastRound &&
+      this->minLatency != std::chrono::steady_clock::duration::max() &&
+      latency > this->minLatency * kMaxLatencyGrowth &&
+      throughput < this->lastThroughput * (1 + kMinGain))
+  {
+    newLimit = std::max(this->min, this->limit - 1);
+    reason = "latency increased";
+    this->holding = true;
+    this->holdRounds = 0;
+  }
+  else if (this->holding)
+  {
+    if (++this->holdRounds >= kHoldRounds && this->limit < maxLimit)
+    {
+      newLimit = this->limit + 1;
+      reason = "probing";
+      this->holding = false;
+    }
+  }
+  else if (this->limit < maxLimit)
+  {
+    newLimit = this->limit + 1;
+    reason = "throughput increased";
+  }
+
+  this->minLatency = std::min(this->minLatency, latency);
+  this->hasLastRound = true;
+  this->lastThroughput = throughput;
+  this->lastLimit = this->limit;
+
+  this->roundStart = _now;
+  this->roundBytes = 0;
+  this->roundCount = 0;
+  this->roundFailures = 0;
+  this->roundLatency = std::chrono::steady_clock::duration::zero();
+
+  if (newLimit == this->limit)
+    return false;
+
+  ConcurrencyDecision decision;
+  decision.time = _now - this->start;
+  decision.previousLimit = this->limit;
+  decision.limit = newLimit;
+  decision.throughput = throughput;
+  decision.latency = latency;
+  decision.errorRate = errorRate;
+  decision.reason = reason;
+  this->decisions.push_back(decision);
+
+  this->limit = newLimit;
+  return true;
+}
+
+//////////////////////////////////////////////////
+ConcurrencyController::ConcurrencyController(std::size_t _min,
+    std::size_t _max, std::size_t _initial)
+  : dataPtr(new ConcurrencyControllerPrivate)
+{
+  this->dataPtr->min = std::max<std::size_t>(1, _min);
+  this->dataPtr->max = std::max(this->dataPtr->min, _max);
+  this->dataPtr->limit =
+    std::clamp(_initial, this->dataPtr->min, this->dataPtr->max);
+}
+
+//////////////////////////////////////////////////
+ConcurrencyController::~ConcurrencyController() = default;
+
+//////////////////////////////////////////////////
+std::size_t ConcurrencyController::Limit() const
+{
+  return this->dataPtr->limit;
+}
+
+//////////////////////////////////////////////////
+bool ConcurrencyController::OnTransferComplete(std::uint64_t _bytes,
+    std::chrono::steady_clock::duration _latency, bool _success,
+    std::chrono::steady_clock::time_point _now)
+{
+  if (!this->dataPtr->started)
+  {
+    this->dataPtr->started = true;
+    this->dataPtr->start = _now - _latency;
+    this->dataPtr->roundStart = this->dataPtr->start;
+  }
+
+  this->dataPtr->roundBytes += _bytes;
+  this->dataPtr->roundLatency += _latency;
+  ++this->dataPtr->roundCount;
+  if (!_success)
+    ++this->dataPtr->roundFailures;
+
+  // A round needs enough samples to cover every transfer slot.
+  if (this->dataPtr->roundCount <
+      std::max<std::size_t>(2, this->dataPtr->limit))
+  {
+    return false;
+  }
+
+  return this->dataPtr->EndRound(_now);
+}
+
+//////////////////////////////////////////////////
+const std::vector<ConcurrencyDecision> &ConcurrencyController::Decisions()
+    const
+{
+  return this->dataPtr->decisions;
+}
+}  // namespace gz::fuel_tools
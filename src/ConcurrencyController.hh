@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_CONCURRENCYCONTROLLER_HH_
+#define GZ_FUEL_TOOLS_CONCURRENCYCONTROLLER_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gz/fuel_tools/DownloadStats.hh"
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class ConcurrencyControllerPrivate;
+
+  /// \brief Decides how many transfers should be in flight, based on the
+  /// throughput, latency and error rate observed on completed transfers.
+  ///
+  /// Measurements are grouped in rounds of at least as many transfers as
+  /// the current limit. At the end of each round the controller:
+  ///   * halves the limit if too many transfers failed (multiplicative
+  ///     decrease),
+  ///   * goes back to the previous limit if the last increase didn't raise
+  ///     the throughput, or lowers the limit if the throughput stalled
+  ///     while latency grew,
+  ///   * otherwise adds one transfer (additive increase).
+  /// After backing off, the controller holds the limit for a few rounds
+  /// before probing a higher value again, so it follows changes of the
+  /// available bandwidth. A limit at which transfers failed is only probed
+  /// again after a longer wait.
+  ///
+  /// This class is not thread safe.
+  class GZ_FUEL_TOOLS_VISIBLE ConcurrencyController
+  {
+    /// \brief Constructor.
+    /// \param[in] _min Minimum number of concurrent transfers.
+    /// \param[in] _max Maximum number of concurrent transfers.
+    /// \param[in] _initial Initial number of concurrent transfers.
+    public: ConcurrencyController(std::size_t _min = 1,
+                std::size_t _max = 16, std::size_t _initial = 2);
+
+    /// \brief Destructor.
+    public: ~ConcurrencyController();
+
+    /// \brief Get the current number of concurrent transfers allowed.
+    /// \return The limit.
+    public: std::size_t Limit() const;
+
+    /// \brief Record a completed transfer.
+    /// \param[in] _bytes Number of bytes received.
+    /// \param[in] _latency Time taken by the transfer.
+    /// \param[in] _success False if the transfer failed.
+    /// \param[in] _now Time at which the transfer completed.
+    /// \return True if the limit changed.
+    public: bool OnTransferComplete(std::uint64_t _bytes,
+                std::chrono::steady_clock::duration _latency, bool _success,
+                std::chrono::steady_clock::time_point _now);
+
+    /// \brief Get the decisions taken so far.
+    /// \return Changes of the limit in chronological order.
+    public: const std::vector<ConcurrencyDecision> &Decisions() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<ConcurrencyControllerPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_CONCURRENCYCONTROLLER_HH_
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "ConcurrencyController.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Size of each simulated transfer, in bytes.
+static constexpr std::uint64_t kTransferSize = 1000000;
+
+/////////////////////////////////////////////////
+/// \brief Simulate transfers against a server where each connection is
+/// capped to _perConnection bytes per second, all connections share
+/// _total bytes per second and transfers fail when more than _throttle are
+/// in flight. Every step runs as many transfers as the controller allows.
+/// \param[in] _controller Controller under test.
+/// \param[in] _perConnection Bandwidth of a single connection.
+/// \param[in] _total Total bandwidth.
+/// \param[in] _throttle Maximum concurrent transfers the server accepts.
+/// \param[in] _steps Number of steps to simulate.
+/// \param[in,out] _now Simulated clock.
+/// \return The limit in effect at each step.
+std::vector<std::size_t> Simulate(ConcurrencyController &_controller,
+    double _perConnection, double _total, std::size_t _throttle, int _steps,
+    std::chrono::steady_clock::time_point &_now)
+{
+  std::vector<std::size_t> limits;
+  for (int i = 0; i < _steps; ++i)
+  {
+    std::size_t inFlight = _controller.Limit();
+    double rate = std::min(_perConnection, _total / inFlight);
+    auto latency = std::chrono::duration_cast<
+      std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(kTransferSize / rate));
+    _now += latency;
+
+    bool success = inFlight <= _throttle;
+    for (std::size_t j = 0; j < inFlight; ++j)
+    {
+      _controller.OnTransferComplete(success ? kTransferSize : 0, latency,
+          success, _now);
+    }
+    limits.push_back(inFlight);
+  }
+  return limits;
+}
+
+/////////////////////////////////////////////////
+TEST(ConcurrencyController, Bounds)
+{
+  ConcurrencyController controller(2, 4, 10);
+  EXPECT_EQ(4u, controller.Limit());
+  EXPECT_TRUE(controller.Decisions().empty());
+
+  ConcurrencyController low(0, 0, 0);
+  EXPECT_EQ(1u, low.Limit());
+
+  auto now = std::chrono::steady_clock::time_point();
+  auto limits = Simulate(controller, 1e6, 1e9, 100, 50, now);
+  for (auto limit : limits)
+  {
+    EXPECT_GE(limit, 2u);
+    EXPECT_LE(limit, 4u);
+  }
+  EXPECT_EQ(4u, controller.Limit());
+}
+
+/////////////////////////////////////////////////
+TEST(ConcurrencyController, ConvergesToBandwidthCap)
+{
+  // Six connections saturate the link, more only add latency.
+  ConcurrencyController controller;
+  auto now = std::chrono::steady_clock::time_point();
+  auto limits = Simulate(controller, 1e6, 6e6, 100, 300, now);
+
+  for (auto it = limits.begin() + 100; it != limits.end(); ++it)
+  {
+    EXPECT_GE(*it, 6u);
+    EXPECT_LE(*it, 7u);
+  }
+
+  ASSERT_FALSE(controller.Decisions().empty());
+  EXPECT_EQ("throughput increased", controller.Decisions().front().reason);
+  EXPECT_EQ(2u, controller.Decisions().front().previousLimit);
+  EXPECT_EQ(3u, controller.Decisions().front().limit);
+  EXPECT_GT(controller.Decisions().front().throughput, 0.0);
+  EXPECT_GT(controller.Decisions().front().time,
+      std::chrono::steady_clock::duration::zero());
+}
+
+/////////////////////////////////////////////////
+TEST(ConcurrencyController, BacksOffOnErrors)
+{
+  // The server rejects transfers above five concurrent requests.
+  ConcurrencyController controller;
+  auto now = std::chrono::steady_clock::time_point();
+  auto limits = Simulate(controller, 1e6, 1e9, 5, 300, now);
+
+  std::size_t failingSteps = 0;
+  for (auto it = limits.begin() + 100; it != limits.end(); ++it)
+  {
+    EXPECT_GE(*it, 2u);
+    EXPECT_LE(*it, 6u);
+    if (*it > 5u)
+      ++failingSteps;
+  }
+  // Most of the time is spent below the throttling threshold.
+  EXPECT_LT(failingSteps, 20u);
+
+  bool backedOff = false;
+  for (const auto &decision : controller.Decisions())
+  {
+    if (decision.reason == "transfers failed")
+    {
+      backedOff = true;
+      EXPECT_DOUBLE_EQ(1.0, decision.errorRate);
+      EXPECT_EQ(decision.previousLimit / 2, decision.limit);
+    }
+  }
+  EXPECT_TRUE(backedOff);
+}
+
+/////////////////////////////////////////////////
+TEST(ConcurrencyController, FollowsBandwidthChanges)
+{
+  ConcurrencyController controller;
+  auto now = std::chrono::steady_clock::time_point();
+
+  auto limits = Simulate(controller, 1e6, 3e6, 100, 200, now);
+  EXPECT_GE(limits.back(), 3u);
+  EXPECT_LE(limits.back(), 4u);
+
+  // More bandwidth becomes available.
+  limits = Simulate(controller, 1e6, 10e6, 100, 300, now);
+  EXPECT_GE(limits.back(), 10u);
+  EXPECT_LE(limits.back(), 11u);
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+
+#include "DownloadJournal.hh"
+#include "Sha256.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Extension of the journal files.
+static const char kExtension[] = ".journal";
+
+/// \brief Extension of the partial archives.
+static const char kPartialExtension[] = ".part";
+
+/// \brief Progress of an item.
+enum class JournalState
+{
+  /// \brief Part of the batch.
+  PLANNED,
+
+  /// \brief Transfer started.
+  STARTED,
+
+  /// \brief Downloaded.
+  COMPLETED
+};
+
+/// \brief Journal line tag of each state.
+static const char kTags[] = {'P', 'S', 'C'};
+
+/// \brief Private data class
+class DownloadJournalPrivate
+{
+  /// \brief Move an item forward and append a line for it to the journal,
+  /// unless it is that far already. The mutex must be locked.
+  /// \param[in] _item Item.
+  /// \param[in] _state New state of the item.
+  /// \return False if the item is invalid or the journal couldn't be
+  /// written.
+  public: bool Advance(const std::string &_item, JournalState _state);
+
+  /// \brief Directory of the journals.
+  public: std::string dir;
+
+  /// \brief Name of the batch.
+  public: std::string batch;
+
+  /// \brief Journal file name, without extension, derived from the batch.
+  public: std::string name;
+
+  /// \brief Protects the members below.
+  public: mutable std::mutex mutex;
+
+  /// \brief Items in the order they were planned.
+  public: std::vector<std::string> order;
+
+  /// \brief Progress of each item.
+  public: std::unordered_map<std::string, JournalState> states;
+
+  /// \brief Number of items completed.
+  public: std::size_t completed = 0;
+
+  /// \brief Journal file, opened by the first line appended.
+  public: std::ofstream out;
+};
+
+//////////////////////////////////////////////////
+/// \brief Get a short hexadecimal digest of a string, to name files.
+/// \param[in] _str String to hash.
+/// \return 16 hexadecimal digits.
+static std::string shortHash(const std::string &_str)
+{
+  return Sha256::Hex(Sha256::Hash(_str.data(), _str.size())).substr(0, 16);
+}
+
+//////////////////////////////////////////////////
+bool DownloadJournalPrivate::Advance(const std::string &_item,
+    JournalState _state)
+{
+  if (_item.empty() || _item.find_first_of("\n\r") != std::string::npos)
+    return false;
+
+  auto it = this->states.find(_item);
+  if (it != this->states.end() && it->second >= _state)
+    return true;
+
+  if (!this->out.is_open())
+  {
+    if (!common::isDirectory(this->dir) &&
+        !common::createDirectories(this->dir))
+    {
+      gzerr << "Unable to create download journal directory ["
+            << this->dir << "]" << std::endl;
+      return false;
+    }
+
+    // Start from a compact copy of the journal of an earlier run, which
+    // also drops a line cut short by a crash.
+    const std::string path = common::joinPaths(this->dir,
+        this->name + kExtension);
+    const std::string tmpPath = path + ".tmp";
+    {
+      std::ofstream tmp(tmpPath, std::ios::binary | std::ios::trunc);
+      tmp << "B\t" << this->batch << '\n';
+      for (const auto &item : this->order)
+        tmp << kTags[static_cast<int>(this->states[item])] << '\t' << item
+            << '\n';
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+      common::removeFile(tmpPath);
+      gzerr << "Unable to write download journal [" << path << "]"
+            << std::endl;
+      return false;
+    }
+    this->out.open(path, std::ios::binary | std::ios::app);
+  }
+
+  this->out << kTags[static_cast<int>(_state)] << '\t' << _item << '\n'
+            << std::flush;
+  if (!this->out.good())
+  {
+    gzerr << "Unable to journal [" << _item << "] in ["
+          << common::joinPaths(this->dir, this->name + kExtension) << "]"
+          << std::endl;
+    this->out.close();
+    return false;
+  }
+
+  if (it == this->states.end())
+  {
+    this->order.push_back(_item);
+    it = this->states.emplace(_item, _state).first;
+  }
+  it->second = _state;
+  if (_state == JournalState::COMPLETED)
+    ++this->completed;
+  return true;
+}
+
+//////////////////////////////////////////////////
+DownloadJournal::DownloadJournal(const std::string &_dir,
+    const std::string &_batch)
+  : dataPtr(new DownloadJournalPrivate)
+{
+  this->dataPtr->dir = _dir;
+  this->dataPtr->batch = _batch;
+  this->dataPtr->name = shortHash(_batch);
+
+  // Each line is "<state>\t<item>", where the state is P, S or C, after a
+  // "B\t<batch>" line.
+  std::ifstream in(this->Path(), std::ios::binary);
+  std::string line;
+  while (std::getline(in, line))
+  {
+    // Only the last line can lack its line break, if it was cut short.
+    if (in.eof())
+      break;
+
+    if (line.size() < 3 || line[1] != '\t')
+      continue;
+
+    const std::string item = line.substr(2);
+    JournalState state;
+    switch (line[0])
+    {
+      case 'B':
+        if (item != _batch)
+        {
+          gzwarn << "Journal [" << this->Path() << "] belongs to batch ["
+                 << item << "], ignoring it" << std::endl;
+          this->dataPtr->order.clear();
+          this->dataPtr->states.clear();
+          this->dataPtr->completed = 0;
+          return;
+        }
+        continue;
+      case 'P':
+        state = JournalState::PLANNED;
+        break;
+      case 'S':
+        state = JournalState::STARTED;
+        break;
+      case 'C':
+        state = JournalState::COMPLETED;
+        break;
+      default:
+        continue;
+    }
+
+    auto [it, inserted] = this->dataPtr->states.emplace(item, state);
+    if (inserted)
+      this->dataPtr->order.push_back(item);
+    else if (it->second < state)
+      it->second = state;
+    else
+      continue;
+    if (state == JournalState::COMPLETED)
+      ++this->dataPtr->completed;
+  }
+}
+
+//////////////////////////////////////////////////
+DownloadJournal::~DownloadJournal() = default;
+
+//////////////////////////////////////////////////
+std::string DownloadJournal::Path() const
+{
+  return common::joinPaths(this->dataPtr->dir,
+      this->dataPtr->name + kExtension);
+}
+
+//////////////////////////////////////////////////
+bool DownloadJournal::Plan(const std::string &_item)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Advance(_item, JournalState::PLANNED);
+}
+
+//////////////////////////////////////////////////
+bool DownloadJournal::Start(const std::string &_item)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Advance(_item, JournalState::STARTED);
+}
+
+//////////////////////////////////////////////////
+bool DownloadJournal::Complete(const std::string &_item)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Advance(_item, JournalState::COMPLETED);
+}
+
+//////////////////////////////////////////////////
+bool DownloadJournal::Completed(const std::string &_item) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->states.find(_item);
+  return it != this->dataPtr->states.end() &&
+    it->second == JournalState::COMPLETED;
+}
+
+//////////////////////////////////////////////////
+std::size_t DownloadJournal::PlannedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->order.size();
+}
+
+//////////////////////////////////////////////////
+std::size_t DownloadJournal::CompletedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->completed;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> DownloadJournal::Pending() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::vector<std::string> result;
+  for (const auto &item : this->dataPtr->order)
+  {
+    if (this->dataPtr->states.at(item) != JournalState::COMPLETED)
+      result.push_back(item);
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> DownloadJournal::InFlight() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::vector<std::string> result;
+  for (const auto &item : this->dataPtr->order)
+  {
+    if (this->dataPtr->states.at(item) == JournalState::STARTED)
+      result.push_back(item);
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::string DownloadJournal::PartialPath(const std::string &_transfer) const
+{
+  return common::joinPaths(this->dataPtr->dir,
+      this->dataPtr->name + "-" + shortHash(_transfer) + kPartialExtension);
+}
+
+//////////////////////////////////////////////////
+void DownloadJournal::Finish()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->out.close();
+  this->dataPtr->order.clear();
+  this->dataPtr->states.clear();
+  this->dataPtr->completed = 0;
+
+  if (!common::isDirectory(this->dataPtr->dir))
+    return;
+
+  const std::string prefix = this->dataPtr->name;
+  const std::string extension = kPartialExtension;
+  std::vector<std::string> remove;
+  common::DirIter end;
+  for (common::DirIter file(this->dataPtr->dir); file != end; ++file)
+  {
+    std::string name = common::basename(*file);
+    if (name == prefix + kExtension ||
+        (name.size() > prefix.size() + extension.size() &&
+         name.compare(0, prefix.size() + 1, prefix + "-") == 0 &&
+         name.compare(name.size() - extension.size(), extension.size(),
+           extension) == 0))
+    {
+      remove.push_back(*file);
+    }
+  }
+  for (const auto &path : remove)
+    common::removeFile(path);
+}
+}  // namespace gz::fuel_tools
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_DOWNLOADJOURNAL_HH_
+#define GZ_FUEL_TOOLS_DOWNLOADJOURNAL_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class DownloadJournalPrivate;
+
+  /// \brief Progress of a batch download, such as a collection, kept next
+  /// to the cache so that running the batch again after a crash or a
+  /// cancellation resumes it where it stopped.
+  ///
+  /// The journal is an append-only file with one short line per item that
+  /// is planned, started or completed. Lines are flushed as they are
+  /// written, which survives the process dying, but not synced to storage.
+  /// Each run starts from a compact copy of the journal, with one line per
+  /// item, and drops a line cut short by a crash.
+  ///
+  /// Interrupted transfers keep their partial archive in a file named after
+  /// the journal and the transfer, see PartialPath. Its size is the offset
+  /// the transfer resumes from.
+  class GZ_FUEL_TOOLS_VISIBLE DownloadJournal
+  {
+    /// \brief Constructor, reads the journal of a batch if there is one.
+    /// \param[in] _dir Directory of the journals, created when the first
+    /// item is journaled.
+    /// \param[in] _batch Name of the batch, the same for every run of it.
+    public: DownloadJournal(const std::string &_dir,
+                const std::string &_batch);
+
+    /// \brief Destructor.
+    public: ~DownloadJournal();
+
+    /// \brief Get the path of the journal file.
+    /// \return Path of the file.
+    public: std::string Path() const;
+
+    /// \brief Record that an item is part of the batch.
+    /// \param[in] _item Item, such as a resource URL.
+    /// \return False if the item is empty or contains a line break, or the
+    /// journal couldn't be written.
+    public: bool Plan(const std::string &_item);
+
+    /// \brief Record that the transfer of an item started.
+    /// \param[in] _item Item, see Plan.
+    /// \return False if the journal couldn't be written.
+    public: bool Start(const std::string &_item);
+
+    /// \brief Record that an item was downloaded.
+    /// \param[in] _item Item, see Plan.
+    /// \return False if the journal couldn't be written.
+    public: bool Complete(const std::string &_item);
+
+    /// \brief Get whether an item was downloaded, by this or an earlier run.
+    /// \param[in] _item Item, see Plan.
+    /// \return True if the item was completed.
+    public: bool Completed(const std::string &_item) const;
+
+    /// \brief Get the number of items planned, by this or an earlier run.
+    /// \return Number of items.
+    public: std::size_t PlannedCount() const;
+
+    /// \brief Get the number of items completed, by this or an earlier run.
+    /// \return Number of items.
+    public: std::size_t CompletedCount() const;
+
+    /// \brief Get the items planned and not completed yet.
+    /// \return Items, in the order they were planned.
+    public: std::vector<std::string> Pending() const;
+
+    /// \brief Get the items whose transfer started and didn't complete,
+    /// such as the ones in flight when an earlier run stopped.
+    /// \return Items, in the order they were planned.
+    public: std::vector<std::string> InFlight() const;
+
+    /// \brief Get the file holding the partial archive of a transfer, the
+    /// same for every run of the batch.
+    /// \param[in] _transfer Transfer, such as the URL of the archive.
+    /// \return Path of the file, which may not exist.
+    public: std::string PartialPath(const std::string &_transfer) const;
+
+    /// \brief Remove the journal and the partial archives of the batch,
+    /// once it is done.
+    public: void Finish();
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<DownloadJournalPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_DOWNLOADJOURNAL_HH_
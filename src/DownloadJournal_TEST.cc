@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "DownloadJournal.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class DownloadJournalTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+    dir = common::joinPaths(tempDir->Path(), ".downloads");
+  }
+
+  /// \brief Directory of the journals.
+  public: std::string dir;
+
+  /// \brief Temporary directory of the test.
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(DownloadJournalTest, Resume)
+{
+  const std::string batch = "collection:openrobotics/depot";
+  {
+    DownloadJournal journal(dir, batch);
+    EXPECT_EQ(0u, journal.PlannedCount());
+    EXPECT_TRUE(journal.Pending().empty());
+
+    // Nothing is written until an item is journaled.
+    EXPECT_FALSE(common::exists(journal.Path()));
+
+    EXPECT_FALSE(journal.Plan(""));
+    EXPECT_FALSE(journal.Plan("bad\nitem"));
+
+    EXPECT_TRUE(journal.Plan("model:house"));
+    EXPECT_TRUE(journal.Plan("model:tree"));
+    EXPECT_TRUE(journal.Plan("world:depot"));
+    EXPECT_TRUE(journal.Start("model:house"));
+    EXPECT_TRUE(journal.Start("model:tree"));
+    EXPECT_TRUE(journal.Complete("model:house"));
+    EXPECT_TRUE(common::exists(journal.Path()));
+
+    // Going back is a no-op.
+    EXPECT_TRUE(journal.Plan("model:house"));
+    EXPECT_TRUE(journal.Completed("model:house"));
+    EXPECT_EQ(3u, journal.PlannedCount());
+    EXPECT_EQ(1u, journal.CompletedCount());
+  }
+
+  // The next run picks up where the first one stopped.
+  DownloadJournal journal(dir, batch);
+  EXPECT_EQ(3u, journal.PlannedCount());
+  EXPECT_EQ(1u, journal.CompletedCount());
+  EXPECT_TRUE(journal.Completed("model:house"));
+  EXPECT_FALSE(journal.Completed("model:tree"));
+  EXPECT_EQ(std::vector<std::string>({"model:tree", "world:depot"}),
+      journal.Pending());
+  EXPECT_EQ(std::vector<std::string>({"model:tree"}), journal.InFlight());
+
+  // Other batches have their own journal.
+  DownloadJournal other(dir, "collection:openrobotics/warehouse");
+  EXPECT_NE(journal.Path(), other.Path());
+  EXPECT_EQ(0u, other.PlannedCount());
+
+  // Partial archives are the same for every run, and removed with the
+  // journal once the batch is done.
+  const std::string partial = journal.PartialPath(
+      "https://fuel.gazebosim.org/1.0/openrobotics/models/tree/tip/tree.zip");
+  EXPECT_EQ(partial, DownloadJournal(dir, batch).PartialPath(
+      "https://fuel.gazebosim.org/1.0/openrobotics/models/tree/tip/tree.zip"));
+  EXPECT_NE(partial, other.PartialPath(
+      "https://fuel.gazebosim.org/1.0/openrobotics/models/tree/tip/tree.zip"));
+  std::ofstream(partial) << "PK";
+  EXPECT_TRUE(other.Plan("model:shelf"));
+
+  EXPECT_TRUE(journal.Complete("model:tree"));
+  EXPECT_TRUE(journal.Complete("world:depot"));
+  EXPECT_TRUE(journal.Pending().empty());
+  journal.Finish();
+  EXPECT_FALSE(common::exists(journal.Path()));
+  EXPECT_FALSE(common::exists(partial));
+  EXPECT_EQ(0u, journal.PlannedCount());
+  EXPECT_TRUE(common::exists(other.Path()));
+  EXPECT_EQ(0u, DownloadJournal(dir, batch).PlannedCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(DownloadJournalTest, TornLine)
+{
+  const std::string batch = "owner:openrobotics";
+  std::string path;
+  {
+    DownloadJournal journal(dir, batch);
+    EXPECT_TRUE(journal.Plan("model:house"));
+    EXPECT_TRUE(journal.Plan("model:tree"));
+    path = journal.Path();
+  }
+
+  // A crash in the middle of a line.
+  std::ofstream(path, std::ios::app) << "C\tmodel:ho";
+
+  {
+    DownloadJournal journal(dir, batch);
+    EXPECT_EQ(2u, journal.PlannedCount());
+    EXPECT_EQ(0u, journal.CompletedCount());
+    EXPECT_TRUE(journal.Complete("model:tree"));
+  }
+
+  DownloadJournal journal(dir, batch);
+  EXPECT_EQ(1u, journal.CompletedCount());
+  EXPECT_TRUE(journal.Completed("model:tree"));
+  EXPECT_FALSE(journal.Completed("model:ho"));
+  EXPECT_EQ(std::vector<std::string>({"model:house"}), journal.Pending());
+}
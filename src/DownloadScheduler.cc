@@ -0,0 +1,380 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+#include "ConcurrencyController.hh"
+#include "DownloadScheduler.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Number of transfer slots above the limit that only interactive
+/// transfers may use in adaptive mode.
+static constexpr std::size_t kInteractiveReserve = 2;
+
+/// \brief In fixed mode, the number of jobs divided by this value is left
+/// to interactive transfers.
+static constexpr std::size_t kInteractiveFraction = 4;
+
+/// \brief Number of priority classes.
+static constexpr std::size_t kPriorities = 3;
+
+/// \brief Archives larger than the memory budget divided by this value are
+/// streamed to disk. Keeps a few archives in memory at once without letting
+/// a single one starve the others.
+static constexpr std::uint64_t kSpillFraction = 4;
+
+/// \brief Private data class
+class DownloadSchedulerPrivate
+{
+  /// \brief Check whether a waiting transfer may start. The mutex must be
+  /// locked.
+  /// \param[in] _priority Priority class of the transfer.
+  /// \param[in] _ticket Ticket of the transfer within its class.
+  /// \param[in] _reserved Number of bytes the transfer reserves.
+  /// \return True if the transfer may start.
+  public: bool CanStart(std::size_t _priority, std::uint64_t _ticket,
+              std::uint64_t _reserved) const
+          {
+            // First come, first served within a class.
+            if (this->waiting[_priority].front() != _ticket)
+              return false;
+
+            // Stay within the memory budget, but always let a transfer run
+            // when nothing else holds memory, so that archives larger than
+            // the budget still make progress.
+            if (this->memoryBudget > 0 && this->reservedBytes > 0 &&
+                this->reservedBytes + _reserved > this->memoryBudget)
+            {
+              return false;
+            }
+
+            // Higher classes go first.
+            for (std::size_t i = 0; i < _priority; ++i)
+            {
+              if (!this->waiting[i].empty())
+                return false;
+            }
+
+            // Without a controller or fixed jobs the number of transfers is
+            // bounded by the callers' own jobs, which aren't known here.
+            std::size_t limit =
+              std::numeric_limits<std::size_t>::max() - kInteractiveReserve;
+            std::size_t reserve = kInteractiveReserve;
+            if (this->controller)
+            {
+              limit = this->controller->Limit();
+            }
+            else if (this->fixedJobs > 0)
+            {
+              reserve = this->FixedReserve();
+              limit = this->fixedJobs - reserve;
+            }
+            std::size_t inFlight = this->TotalInFlight();
+
+            switch (static_cast<DownloadPriority>(_priority))
+            {
+              case DownloadPriority::INTERACTIVE:
+                return inFlight < limit + reserve;
+              case DownloadPriority::NORMAL:
+                return inFlight < limit;
+              case DownloadPriority::BACKGROUND:
+              default:
+                return inFlight < limit && this->inFlight[0] == 0;
+            }
+          }
+
+  /// \brief Get the number of fixed jobs left to interactive transfers.
+  /// The mutex must be locked.
+  /// \return Number of slots, 0 if there is a single job.
+  public: std::size_t FixedReserve() const
+          {
+            if (this->fixedJobs <= 1)
+              return 0;
+            return std::max<std::size_t>(
+                this->fixedJobs / kInteractiveFraction, 1);
+          }
+
+  /// \brief Get the spill threshold. The mutex must be locked.
+  /// \return Size in bytes, 0 if there is no memory budget.
+  public: std::uint64_t SpillThreshold() const
+          {
+            if (this->memoryBudget == 0)
+              return 0;
+            return std::max<std::uint64_t>(
+                this->memoryBudget / kSpillFraction, 1);
+          }
+
+  /// \brief Get the number of bytes a transfer reserves. The mutex must be
+  /// locked.
+  /// \param[in] _expectedBytes Expected size of the archive, 0 if unknown.
+  /// \return Number of bytes to reserve.
+  public: std::uint64_t Reservation(std::uint64_t _expectedBytes) const
+          {
+            const std::uint64_t threshold = this->SpillThreshold();
+            if (_expectedBytes == 0)
+              return threshold;
+
+            // Large archives are streamed to disk.
+            return _expectedBytes > threshold ? 0 : _expectedBytes;
+          }
+
+  /// \brief Get the number of transfers in flight. The mutex must be
+  /// locked.
+  /// \return Number of transfers in flight.
+  public: std::size_t TotalInFlight() const
+          {
+            return this->inFlight[0] + this->inFlight[1] + this->inFlight[2];
+          }
+
+  /// \brief Check whether interactive or normal transfers are waiting or
+  /// in flight. The mutex must be locked.
+  /// \return True if such a transfer is waiting or in flight.
+  public: bool ForegroundBusy() const
+          {
+            const auto background =
+              static_cast<std::size_t>(DownloadPriority::BACKGROUND);
+            for (std::size_t i = 0; i < background; ++i)
+            {
+              if (this->inFlight[i] > 0 || !this->waiting[i].empty())
+                return true;
+            }
+            return false;
+          }
+
+  /// \brief Protects all members.
+  public: mutable std::mutex mutex;
+
+  /// \brief Signaled when a transfer finishes or the limit changes.
+  public: std::condition_variable cv;
+
+  /// \brief Number of transfers in flight, per priority class.
+  public: std::array<std::size_t, kPriorities> inFlight{};
+
+  /// \brief Tickets of the waiting transfers, per priority class.
+  public: std::array<std::deque<std::uint64_t>, kPriorities> waiting;
+
+  /// \brief Next ticket to hand out.
+  public: std::uint64_t nextTicket = 0;
+
+  /// \brief Memory budget in bytes, 0 for no limit.
+  public: std::uint64_t memoryBudget = 0;
+
+  /// \brief Number of bytes reserved by the transfers in flight.
+  public: std::uint64_t reservedBytes = 0;
+
+  /// \brief Number of nested EnableAdaptive calls.
+  public: std::size_t adaptiveUsers = 0;
+
+  /// \brief Sum of the jobs of the nested EnableFixed calls.
+  public: std::size_t fixedJobs = 0;
+
+  /// \brief Controller used in adaptive mode, null otherwise.
+  public: std::unique_ptr<ConcurrencyController> controller;
+
+  /// \brief Time at which inFlight became non zero.
+  public: std::chrono::steady_clock::time_point activeSince;
+
+  /// \brief Time at which the last interactive or normal transfer
+  /// finished.
+  public: std::chrono::steady_clock::time_point idleSince =
+          std::chrono::steady_clock::now();
+
+  /// \brief Statistics gathered so far.
+  public: DownloadStats stats;
+};
+
+//////////////////////////////////////////////////
+DownloadScheduler::DownloadScheduler()
+  : dataPtr(new DownloadSchedulerPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+DownloadScheduler::~DownloadScheduler() = default;
+
+//////////////////////////////////////////////////
+void DownloadScheduler::EnableAdaptive(std::size_t _maxTransfers)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->adaptiveUsers++ == 0)
+  {
+    this->dataPtr->controller =
+      std::make_unique<ConcurrencyController>(1, _maxTransfers);
+  }
+}
+
+//////////////////////////////////////////////////
+void DownloadScheduler::DisableAdaptive()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    if (this->dataPtr->adaptiveUsers == 0 ||
+        --this->dataPtr->adaptiveUsers > 0)
+    {
+      return;
+    }
+    this->dataPtr->controller.reset();
+  }
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void DownloadScheduler::EnableFixed(std::size_t _jobs)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->fixedJobs += _jobs;
+  }
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void DownloadScheduler::DisableFixed(std::size_t _jobs)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->fixedJobs -= std::min(_jobs, this->dataPtr->fixedJobs);
+  }
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void DownloadScheduler::SetMemoryBudget(std::uint64_t _bytes)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->memoryBudget = _bytes;
+  }
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+std::uint64_t DownloadScheduler::MemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->memoryBudget;
+}
+
+//////////////////////////////////////////////////
+std::uint64_t DownloadScheduler::SpillThreshold() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->SpillThreshold();
+}
+
+//////////////////////////////////////////////////
+std::uint64_t DownloadScheduler::Acquire(DownloadPriority _priority,
+    std::uint64_t _expectedBytes)
+{
+  const auto priority = static_cast<std::size_t>(_priority);
+
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  const std::uint64_t ticket = this->dataPtr->nextTicket++;
+  std::uint64_t reserved = 0;
+  this->dataPtr->waiting[priority].push_back(ticket);
+  this->dataPtr->cv.wait(lock, [&]
+      {
+        // The budget may change while waiting.
+        reserved = this->dataPtr->Reservation(_expectedBytes);
+        return this->dataPtr->CanStart(priority, ticket, reserved);
+      });
+  this->dataPtr->waiting[priority].pop_front();
+
+  this->dataPtr->reservedBytes += reserved;
+  this->dataPtr->stats.peakReservedBytes = std::max(
+      this->dataPtr->stats.peakReservedBytes, this->dataPtr->reservedBytes);
+
+  if (this->dataPtr->TotalInFlight() == 0)
+    this->dataPtr->activeSince = std::chrono::steady_clock::now();
+  ++this->dataPtr->inFlight[priority];
+  this->dataPtr->stats.peakConcurrency = std::max(
+      this->dataPtr->stats.peakConcurrency, this->dataPtr->TotalInFlight());
+
+  // Let the next transfer in line check whether it may start as well.
+  lock.unlock();
+  this->dataPtr->cv.notify_all();
+  return reserved;
+}
+
+//////////////////////////////////////////////////
+void DownloadScheduler::Release(DownloadPriority _priority,
+    std::uint64_t _reserved, std::uint64_t _bytes,
+    std::chrono::steady_clock::duration _latency, bool _success)
+{
+  const auto priority = static_cast<std::size_t>(_priority);
+  auto now = std::chrono::steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    auto &stats = this->dataPtr->stats;
+
+    if (this->dataPtr->inFlight[priority] > 0)
+    {
+      --this->dataPtr->inFlight[priority];
+      if (this->dataPtr->TotalInFlight() == 0)
+        stats.activeTime += now - this->dataPtr->activeSince;
+    }
+    this->dataPtr->reservedBytes -=
+      std::min(_reserved, this->dataPtr->reservedBytes);
+    if (_priority != DownloadPriority::BACKGROUND)
+      this->dataPtr->idleSince = now;
+
+    if (_success)
+      ++stats.transfers;
+    else
+      ++stats.failedTransfers;
+    stats.bytes += _bytes;
+
+    auto &controller = this->dataPtr->controller;
+    if (controller &&
+        controller->OnTransferComplete(_bytes, _latency, _success, now))
+    {
+      stats.decisions.push_back(controller->Decisions().back());
+    }
+  }
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+DownloadStats DownloadScheduler::Stats() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  DownloadStats stats = this->dataPtr->stats;
+
+  // Account for the transfers currently in flight.
+  if (this->dataPtr->TotalInFlight() > 0)
+  {
+    stats.activeTime +=
+      std::chrono::steady_clock::now() - this->dataPtr->activeSince;
+  }
+  return stats;
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration DownloadScheduler::IdleTime() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->ForegroundBusy())
+    return std::chrono::steady_clock::duration::zero();
+  return std::chrono::steady_clock::now() - this->dataPtr->idleSince;
+}
+}  // namespace gz::fuel_tools
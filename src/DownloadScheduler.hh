@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_DOWNLOADSCHEDULER_HH_
+#define GZ_FUEL_TOOLS_DOWNLOADSCHEDULER_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "gz/fuel_tools/DownloadPriority.hh"
+#include "gz/fuel_tools/DownloadStats.hh"
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class DownloadSchedulerPrivate;
+
+  /// \brief Client-wide gate for archive transfers. Every model or world
+  /// archive downloaded by a FuelClient is admitted by its scheduler,
+  /// which also gathers the download statistics.
+  ///
+  /// By default transfers are admitted right away and the number of
+  /// parallel transfers is given by the callers. While the adaptive mode
+  /// is enabled, a ConcurrencyController decides how many transfers may be
+  /// in flight. While the fixed mode is enabled, the callers' jobs bound
+  /// the number of transfers in flight.
+  ///
+  /// Waiting transfers are admitted by priority class, in arrival order
+  /// within a class, and background transfers don't start while
+  /// interactive ones are in flight. Interactive transfers have slots of
+  /// their own, so they never wait behind a saturated batch: in adaptive
+  /// mode a few slots above the controller's limit, and in fixed mode a
+  /// quarter of the jobs, at least one, when there is more than one job.
+  /// Outside of these modes the scheduler doesn't know the callers' job
+  /// counts, so it doesn't reserve slots: transfers only wait for the
+  /// memory budget or for higher classes.
+  ///
+  /// An optional memory budget bounds the bytes held by archives being
+  /// downloaded into memory. Each transfer reserves its expected size when
+  /// admitted, and waits while the reservation doesn't fit in the budget.
+  /// Archives larger than the spill threshold are expected to be streamed
+  /// to disk, so they reserve nothing.
+  ///
+  /// This class is thread safe.
+  class GZ_FUEL_TOOLS_VISIBLE DownloadScheduler
+  {
+    /// \brief Constructor.
+    public: DownloadScheduler();
+
+    /// \brief Destructor.
+    public: ~DownloadScheduler();
+
+    /// \brief Enable the adaptive mode. Calls can be nested, the mode stays
+    /// enabled until DisableAdaptive is called as many times.
+    /// \param[in] _maxTransfers Maximum number of concurrent transfers the
+    /// controller may allow.
+    public: void EnableAdaptive(std::size_t _maxTransfers);
+
+    /// \brief Disable the adaptive mode.
+    /// \sa EnableAdaptive
+    public: void DisableAdaptive();
+
+    /// \brief Enable the fixed mode, for callers running a given number of
+    /// jobs. Calls can be nested, the jobs of the nested calls add up. The
+    /// adaptive mode takes precedence while both are enabled.
+    /// \param[in] _jobs Number of jobs of the caller.
+    public: void EnableFixed(std::size_t _jobs);
+
+    /// \brief Disable the fixed mode for a caller.
+    /// \param[in] _jobs Number of jobs given to EnableFixed.
+    /// \sa EnableFixed
+    public: void DisableFixed(std::size_t _jobs);
+
+    /// \brief Set the memory budget.
+    /// \param[in] _bytes Maximum number of bytes reserved by transfers in
+    /// flight, 0 for no limit.
+    public: void SetMemoryBudget(std::uint64_t _bytes);
+
+    /// \brief Get the memory budget.
+    /// \return Maximum number of bytes reserved by transfers in flight, 0
+    /// if there is no limit.
+    public: std::uint64_t MemoryBudget() const;
+
+    /// \brief Get the largest archive that should be held in memory. Larger
+    /// archives should be streamed to disk, see Rest::Download.
+    /// \return Size in bytes, 0 if there is no memory budget.
+    public: std::uint64_t SpillThreshold() const;
+
+    /// \brief Block until a transfer may start.
+    /// \param[in] _priority Priority class of the transfer.
+    /// \param[in] _expectedBytes Expected size of the archive, 0 if unknown.
+    /// Transfers of unknown size reserve the spill threshold.
+    /// \return Number of bytes reserved for the transfer, to be handed back
+    /// to Release.
+    public: std::uint64_t Acquire(DownloadPriority _priority,
+                std::uint64_t _expectedBytes = 0);
+
+    /// \brief Signal that a transfer admitted with Acquire finished.
+    /// \param[in] _priority Priority class the transfer was admitted with.
+    /// \param[in] _reserved Number of bytes returned by Acquire.
+    /// \param[in] _bytes Number of bytes received.
+    /// \param[in] _latency Time taken by the transfer.
+    /// \param[in] _success False if the transfer failed.
+    public: void Release(DownloadPriority _priority, std::uint64_t _reserved,
+                std::uint64_t _bytes,
+                std::chrono::steady_clock::duration _latency,
+                bool _success);
+
+    /// \brief Get how long the scheduler has been idle, ignoring background
+    /// transfers, so that background work can wait for a quiet period.
+    /// \return Time since the last interactive or normal transfer finished,
+    /// or since construction. Zero while such a transfer is waiting or in
+    /// flight.
+    public: std::chrono::steady_clock::duration IdleTime() const;
+
+    /// \brief Get the statistics gathered so far.
+    /// \return Download statistics.
+    public: DownloadStats Stats() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<DownloadSchedulerPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_DOWNLOADSCHEDULER_HH_
@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DownloadScheduler.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, Stats)
+{
+  DownloadScheduler scheduler;
+  auto stats = scheduler.Stats();
+  EXPECT_EQ(0u, stats.transfers);
+  EXPECT_EQ(0u, stats.failedTransfers);
+  EXPECT_EQ(0u, stats.bytes);
+  EXPECT_EQ(0u, stats.peakConcurrency);
+  EXPECT_TRUE(stats.decisions.empty());
+
+  // Without adaptive mode transfers are admitted right away.
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 100,
+      std::chrono::milliseconds(10), true);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 50,
+      std::chrono::milliseconds(10), true);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(10), false);
+
+  stats = scheduler.Stats();
+  EXPECT_EQ(2u, stats.transfers);
+  EXPECT_EQ(1u, stats.failedTransfers);
+  EXPECT_EQ(150u, stats.bytes);
+  EXPECT_EQ(3u, stats.peakConcurrency);
+  EXPECT_GE(stats.activeTime, std::chrono::steady_clock::duration::zero());
+  EXPECT_TRUE(stats.decisions.empty());
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, AdaptiveLimit)
+{
+  DownloadScheduler scheduler;
+  scheduler.EnableAdaptive(16);
+
+  // The controller starts with two parallel transfers.
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  scheduler.Acquire(DownloadPriority::NORMAL);
+
+  std::atomic<bool> admitted = false;
+  std::thread thread([&]()
+  {
+    scheduler.Acquire(DownloadPriority::NORMAL);
+    admitted = true;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(admitted);
+
+  scheduler.Release(DownloadPriority::NORMAL, 0, 1000,
+      std::chrono::milliseconds(10), true);
+  thread.join();
+  EXPECT_TRUE(admitted);
+
+  scheduler.Release(DownloadPriority::NORMAL, 0, 1000,
+      std::chrono::milliseconds(10), true);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 1000,
+      std::chrono::milliseconds(10), true);
+  EXPECT_EQ(2u, scheduler.Stats().peakConcurrency);
+
+  // Once disabled, transfers are no longer limited.
+  scheduler.DisableAdaptive();
+  for (int i = 0; i < 4; ++i)
+    scheduler.Acquire(DownloadPriority::NORMAL);
+  EXPECT_EQ(4u, scheduler.Stats().peakConcurrency);
+  for (int i = 0; i < 4; ++i)
+    scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+        std::chrono::milliseconds(1), true);
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, AdaptiveDecisions)
+{
+  DownloadScheduler scheduler;
+  scheduler.EnableAdaptive(4);
+
+  // Keep the pipe full with fast transfers, the limit grows.
+  for (int i = 0; i < 20; ++i)
+  {
+    scheduler.Acquire(DownloadPriority::NORMAL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    scheduler.Release(DownloadPriority::NORMAL, 0, 1000000 * (i + 1),
+        std::chrono::milliseconds(1), true);
+  }
+
+  auto stats = scheduler.Stats();
+  ASSERT_FALSE(stats.decisions.empty());
+  EXPECT_EQ(2u, stats.decisions.front().previousLimit);
+  EXPECT_EQ(3u, stats.decisions.front().limit);
+  scheduler.DisableAdaptive();
+
+  // Decisions are kept after the adaptive mode is disabled.
+  EXPECT_EQ(stats.decisions.size(), scheduler.Stats().decisions.size());
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, FixedReserve)
+{
+  DownloadScheduler scheduler;
+  scheduler.EnableFixed(4);
+
+  // A quarter of the four jobs is left to interactive transfers.
+  for (int i = 0; i < 3; ++i)
+    scheduler.Acquire(DownloadPriority::NORMAL);
+
+  std::atomic<bool> normalAdmitted = false;
+  std::thread normal([&]()
+  {
+    scheduler.Acquire(DownloadPriority::NORMAL);
+    normalAdmitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(normalAdmitted);
+
+  scheduler.Acquire(DownloadPriority::INTERACTIVE);
+  EXPECT_EQ(4u, scheduler.Stats().peakConcurrency);
+
+  // The jobs bound interactive transfers as well.
+  std::atomic<bool> interactiveAdmitted = false;
+  std::thread interactive([&]()
+  {
+    scheduler.Acquire(DownloadPriority::INTERACTIVE);
+    interactiveAdmitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(interactiveAdmitted);
+
+  // A freed batch slot goes to the interactive transfer.
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), true);
+  interactive.join();
+  EXPECT_TRUE(interactiveAdmitted);
+  EXPECT_FALSE(normalAdmitted);
+
+  // Freeing the interactive slots doesn't admit more than three batch
+  // transfers.
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(normalAdmitted);
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+  normal.join();
+  EXPECT_TRUE(normalAdmitted);
+  for (int i = 0; i < 3; ++i)
+  {
+    scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+        std::chrono::milliseconds(1), true);
+  }
+
+  // A single job reserves nothing.
+  scheduler.DisableFixed(4);
+  scheduler.EnableFixed(1);
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  interactiveAdmitted = false;
+  interactive = std::thread([&]()
+  {
+    scheduler.Acquire(DownloadPriority::INTERACTIVE);
+    interactiveAdmitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(interactiveAdmitted);
+
+  // Once disabled, transfers are no longer limited.
+  scheduler.DisableFixed(1);
+  interactive.join();
+  EXPECT_TRUE(interactiveAdmitted);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), true);
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, Priorities)
+{
+  DownloadScheduler scheduler;
+  scheduler.EnableAdaptive(2);
+
+  // Saturate the two slots of the controller with a batch.
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  scheduler.Acquire(DownloadPriority::NORMAL);
+
+  std::mutex orderMutex;
+  std::vector<std::string> order;
+  auto waiter = [&](DownloadPriority _priority, const std::string &_name)
+  {
+    return std::thread([&, _priority, _name]()
+    {
+      scheduler.Acquire(_priority);
+      std::lock_guard<std::mutex> lock(orderMutex);
+      order.push_back(_name);
+    });
+  };
+  auto orderSize = [&]()
+  {
+    std::lock_guard<std::mutex> lock(orderMutex);
+    return order.size();
+  };
+
+  // Queue background work first, then normal work.
+  std::thread background = waiter(DownloadPriority::BACKGROUND, "background");
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  std::thread normal = waiter(DownloadPriority::NORMAL, "normal");
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(0u, orderSize());
+
+  // Interactive transfers don't wait behind the saturated batch.
+  std::thread interactive =
+    waiter(DownloadPriority::INTERACTIVE, "interactive");
+  interactive.join();
+  ASSERT_EQ(1u, orderSize());
+  EXPECT_EQ("interactive", order[0]);
+
+  // The interactive transfer used a reserved slot, freeing it doesn't
+  // admit batch transfers.
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(1u, orderSize());
+
+  // A freed slot goes to the normal transfer, even though the background
+  // one arrived first.
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), true);
+  normal.join();
+  ASSERT_EQ(2u, orderSize());
+  EXPECT_EQ("normal", order[1]);
+
+  // Background transfers yield while interactive ones are in flight.
+  scheduler.Acquire(DownloadPriority::INTERACTIVE);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), true);
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(2u, orderSize());
+
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+  background.join();
+  ASSERT_EQ(3u, orderSize());
+  EXPECT_EQ("background", order[2]);
+
+  scheduler.Release(DownloadPriority::BACKGROUND, 0, 0,
+      std::chrono::milliseconds(1), true);
+  scheduler.DisableAdaptive();
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, IdleTime)
+{
+  DownloadScheduler scheduler;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_GE(scheduler.IdleTime(), std::chrono::milliseconds(20));
+
+  // Background transfers don't count as activity.
+  scheduler.Acquire(DownloadPriority::BACKGROUND);
+  EXPECT_GE(scheduler.IdleTime(), std::chrono::milliseconds(20));
+  scheduler.Release(DownloadPriority::BACKGROUND, 0, 0,
+      std::chrono::milliseconds(1), true);
+  EXPECT_GE(scheduler.IdleTime(), std::chrono::milliseconds(20));
+
+  // Other transfers do, until they finish.
+  scheduler.Acquire(DownloadPriority::INTERACTIVE);
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      scheduler.IdleTime());
+  scheduler.Release(DownloadPriority::INTERACTIVE, 0, 0,
+      std::chrono::milliseconds(1), true);
+  EXPECT_LT(scheduler.IdleTime(), std::chrono::milliseconds(20));
+
+  scheduler.Acquire(DownloadPriority::NORMAL);
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      scheduler.IdleTime());
+  scheduler.Release(DownloadPriority::NORMAL, 0, 0,
+      std::chrono::milliseconds(1), false);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_GE(scheduler.IdleTime(), std::chrono::milliseconds(20));
+}
+
+/////////////////////////////////////////////////
+TEST(DownloadScheduler, MemoryBudget)
+{
+  DownloadScheduler scheduler;
+  EXPECT_EQ(0u, scheduler.MemoryBudget());
+  EXPECT_EQ(0u, scheduler.SpillThreshold());
+
+  // Without a budget nothing is reserved.
+  EXPECT_EQ(0u, scheduler.Acquire(DownloadPriority::NORMAL, 1000));
+  scheduler.Release(DownloadPriority::NORMAL, 0, 1000,
+      std::chrono::milliseconds(1), true);
+
+  scheduler.SetMemoryBudget(1000);
+  EXPECT_EQ(1000u, scheduler.MemoryBudget());
+  EXPECT_EQ(250u, scheduler.SpillThreshold());
+
+  // Small archives reserve their size, unknown ones the spill threshold and
+  // large ones nothing, since they are streamed to disk.
+  std::uint64_t small = scheduler.Acquire(DownloadPriority::NORMAL, 200);
+  std::uint64_t unknown = scheduler.Acquire(DownloadPriority::NORMAL);
+  std::uint64_t large = scheduler.Acquire(DownloadPriority::NORMAL, 5000);
+  EXPECT_EQ(200u, small);
+  EXPECT_EQ(250u, unknown);
+  EXPECT_EQ(0u, large);
+
+  std::uint64_t second = scheduler.Acquire(DownloadPriority::NORMAL, 250);
+  std::uint64_t third = scheduler.Acquire(DownloadPriority::NORMAL, 250);
+  EXPECT_EQ(950u, scheduler.Stats().peakReservedBytes);
+
+  // The next archive doesn't fit in the budget until memory is released.
+  std::atomic<bool> admitted{false};
+  std::thread waiter([&]()
+  {
+    scheduler.Release(DownloadPriority::NORMAL,
+        scheduler.Acquire(DownloadPriority::NORMAL, 100), 100,
+        std::chrono::milliseconds(1), true);
+    admitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(admitted);
+
+  // Releasing a transfer that reserved nothing doesn't help.
+  scheduler.Release(DownloadPriority::NORMAL, large, 5000,
+      std::chrono::milliseconds(1), true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(admitted);
+
+  scheduler.Release(DownloadPriority::NORMAL, small, 200,
+      std::chrono::milliseconds(1), true);
+  waiter.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(950u, scheduler.Stats().peakReservedBytes);
+
+  scheduler.Release(DownloadPriority::NORMAL, unknown, 300,
+      std::chrono::milliseconds(1), true);
+  scheduler.Release(DownloadPriority::NORMAL, second, 250,
+      std::chrono::milliseconds(1), true);
+  scheduler.Release(DownloadPriority::NORMAL, third, 250,
+      std::chrono::milliseconds(1), true);
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <cerrno>
+#endif
+
+#ifdef __APPLE__
+#include <sys/clonefile.h>
+#endif
+
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+
+#include "FileClone.hh"
+
+namespace gz::fuel_tools
+{
+#ifdef __linux__
+//////////////////////////////////////////////////
+/// \brief Clone a file with a reflink or an in-kernel copy.
+/// \param[in] _src Path of the file to clone.
+/// \param[in] _dst Path of the clone.
+/// \return REFLINK, COPY_RANGE, or FAILED if neither worked.
+static CloneMethod cloneInKernel(const std::string &_src,
+    const std::string &_dst)
+{
+  int in = open(_src.c_str(), O_RDONLY | O_CLOEXEC);
+  if (in < 0)
+    return CloneMethod::FAILED;
+
+  // Unlink the destination rather than truncating it, it may be a hard
+  // link to the source.
+  struct stat st;
+  int out = -1;
+  if (fstat(in, &st) == 0 && (unlink(_dst.c_str()) == 0 || errno == ENOENT))
+  {
+    out = open(_dst.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+        st.st_mode & 0777);
+  }
+  if (out < 0)
+  {
+    close(in);
+    return CloneMethod::FAILED;
+  }
+
+  CloneMethod method = CloneMethod::FAILED;
+#ifdef FICLONE
+  if (ioctl(out, FICLONE, in) == 0)
+    method = CloneMethod::REFLINK;
+#endif
+
+  if (method == CloneMethod::FAILED)
+  {
+    off_t remaining = st.st_size;
+    while (remaining > 0)
+    {
+      ssize_t n = copy_file_range(in, nullptr, out, nullptr, remaining, 0);
+      if (n < 0 && errno == EINTR)
+        continue;
+      // Unsupported by the filesystems, or the file shrank.
+      if (n <= 0)
+        break;
+      remaining -= n;
+    }
+    if (remaining == 0)
+      method = CloneMethod::COPY_RANGE;
+  }
+
+  close(in);
+  if (close(out) != 0)
+    method = CloneMethod::FAILED;
+  return method;
+}
+#endif
+
+//////////////////////////////////////////////////
+CloneMethod cloneFile(const std::string &_src, const std::string &_dst,
+    bool _allowHardlink)
+{
+  if (!common::isFile(_src))
+  {
+    gzerr << "Unable to clone [" << _src << "], not a file" << std::endl;
+    return CloneMethod::FAILED;
+  }
+
+  if (_src == _dst)
+  {
+    gzerr << "Unable to clone [" << _src << "] onto itself" << std::endl;
+    return CloneMethod::FAILED;
+  }
+
+#ifdef __linux__
+  CloneMethod method = cloneInKernel(_src, _dst);
+  if (method != CloneMethod::FAILED)
+    return method;
+#endif
+
+  // The following methods need the destination to be absent.
+  if (common::exists(_dst))
+    common::removeFile(_dst);
+
+#ifdef __APPLE__
+  if (clonefile(_src.c_str(), _dst.c_str(), 0) == 0)
+    return CloneMethod::REFLINK;
+#endif
+
+  if (_allowHardlink)
+  {
+#ifdef _WIN32
+    if (CreateHardLinkA(_dst.c_str(), _src.c_str(), nullptr))
+      return CloneMethod::HARDLINK;
+#else
+    if (link(_src.c_str(), _dst.c_str()) == 0)
+      return CloneMethod::HARDLINK;
+#endif
+  }
+
+  if (common::copyFile(_src, _dst))
+    return CloneMethod::COPY;
+
+  gzerr << "Unable to clone [" << _src << "] to [" << _dst << "]"
+        << std::endl;
+  return CloneMethod::FAILED;
+}
+
+//////////////////////////////////////////////////
+bool cloneDirectory(const std::string &_src, const std::string &_dst,
+    bool _allowHardlink)
+{
+  if (!common::isDirectory(_src))
+  {
+    gzerr << "Unable to clone [" << _src << "], not a directory"
+          << std::endl;
+    return false;
+  }
+
+  if (!common::createDirectories(_dst))
+  {
+    gzerr << "Unable to create directory [" << _dst << "]" << std::endl;
+    return false;
+  }
+
+  bool result = true;
+  common::DirIter endIt;
+  for (common::DirIter dirIt(_src); dirIt != endIt; ++dirIt)
+  {
+    const std::string path = *dirIt;
+    const std::string dst =
+      common::joinPaths(_dst, common::basename(path));
+
+    if (common::isDirectory(path))
+    {
+      result = cloneDirectory(path, dst, _allowHardlink) && result;
+    }
+    else if (cloneFile(path, dst, _allowHardlink) == CloneMethod::FAILED)
+    {
+      result = false;
+    }
+  }
+  return result;
+}
+}  // namespace gz::fuel_tools
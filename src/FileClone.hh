@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_FILECLONE_HH_
+#define GZ_FUEL_TOOLS_FILECLONE_HH_
+
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief How a file was cloned, from the cheapest to the most expensive.
+enum class CloneMethod
+{
+  /// \brief The file couldn't be cloned.
+  FAILED,
+
+  /// \brief Copy-on-write clone sharing the data blocks, e.g. on btrfs,
+  /// XFS or APFS.
+  REFLINK,
+
+  /// \brief In-kernel copy, without going through userspace buffers.
+  COPY_RANGE,
+
+  /// \brief Hard link to the same inode.
+  HARDLINK,
+
+  /// \brief Regular copy.
+  COPY,
+};
+
+/// \brief Clone a file with the cheapest method the filesystem supports:
+/// a reflink, then an in-kernel copy, then a hard link if allowed, then a
+/// regular copy.
+///
+/// Hard links share the inode, so writing to the clone also changes the
+/// source. Only allow them when neither file is modified in place.
+/// \param[in] _src Path of the file to clone.
+/// \param[in] _dst Path of the clone, replaced if it exists. Its parent
+/// directory must exist.
+/// \param[in] _allowHardlink True to allow hard links.
+/// \return The method that was used.
+GZ_FUEL_TOOLS_VISIBLE
+CloneMethod cloneFile(const std::string &_src, const std::string &_dst,
+    bool _allowHardlink = false);
+
+/// \brief Clone a directory tree file by file with cloneFile.
+/// \param[in] _src Path of the directory to clone.
+/// \param[in] _dst Path of the clone, created if needed.
+/// \param[in] _allowHardlink True to allow hard links.
+/// \return True if every file was cloned.
+GZ_FUEL_TOOLS_VISIBLE
+bool cloneDirectory(const std::string &_src, const std::string &_dst,
+    bool _allowHardlink = false);
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_FILECLONE_HH_
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "FileClone.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+/// \brief Read a whole file.
+/// \param[in] _path Path of the file.
+/// \return Content of the file.
+static std::string readFile(const std::string &_path)
+{
+  std::ifstream in(_path, std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+class FileCloneTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+
+    src = common::joinPaths(tempDir->Path(), "src");
+    ASSERT_TRUE(common::createDirectories(common::joinPaths(src, "sub")));
+    std::ofstream(common::joinPaths(src, "a.txt")) << "first";
+    std::ofstream(common::joinPaths(src, "sub", "b.txt"))
+      << std::string(100000, 'b');
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+
+  public: std::string src;
+};
+
+/////////////////////////////////////////////////
+TEST_F(FileCloneTest, CloneFile)
+{
+  const std::string srcFile = common::joinPaths(this->src, "a.txt");
+  const std::string dst = common::joinPaths(this->tempDir->Path(), "a.txt");
+
+  CloneMethod method = cloneFile(srcFile, dst);
+  EXPECT_NE(CloneMethod::FAILED, method);
+  EXPECT_NE(CloneMethod::HARDLINK, method);
+  EXPECT_EQ("first", readFile(dst));
+
+  // Clones without hard links are independent.
+  std::ofstream(dst) << "changed";
+  EXPECT_EQ("first", readFile(srcFile));
+
+  // An existing destination is replaced, even if it's a hard link to the
+  // source.
+  EXPECT_NE(CloneMethod::FAILED, cloneFile(srcFile, dst, true));
+  EXPECT_EQ("first", readFile(dst));
+  EXPECT_NE(CloneMethod::FAILED, cloneFile(srcFile, dst));
+  EXPECT_EQ("first", readFile(srcFile));
+  EXPECT_EQ("first", readFile(dst));
+
+  EXPECT_EQ(CloneMethod::FAILED, cloneFile(srcFile, srcFile));
+  EXPECT_EQ(CloneMethod::FAILED, cloneFile(this->src, dst));
+  EXPECT_EQ(CloneMethod::FAILED, cloneFile(
+      common::joinPaths(this->src, "missing"), dst));
+}
+
+/////////////////////////////////////////////////
+TEST_F(FileCloneTest, CloneDirectory)
+{
+  const std::string dst = common::joinPaths(this->tempDir->Path(), "dst");
+  EXPECT_TRUE(cloneDirectory(this->src, dst));
+  EXPECT_EQ("first", readFile(common::joinPaths(dst, "a.txt")));
+  EXPECT_EQ(std::string(100000, 'b'),
+      readFile(common::joinPaths(dst, "sub", "b.txt")));
+
+  EXPECT_FALSE(cloneDirectory(
+      common::joinPaths(this->src, "a.txt"), dst));
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+
+#include "FileSync.hh"
+
+namespace gz::fuel_tools
+{
+//////////////////////////////////////////////////
+bool syncFile(const std::string &_path)
+{
+  bool result = false;
+#ifdef _WIN32
+  HANDLE file = CreateFileA(_path.c_str(), GENERIC_WRITE,
+      FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file != INVALID_HANDLE_VALUE)
+  {
+    result = FlushFileBuffers(file);
+    CloseHandle(file);
+  }
+#else
+  int fd = open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0)
+  {
+#ifdef __APPLE__
+    result = fsync(fd) == 0;
+#else
+    result = fdatasync(fd) == 0;
+#endif
+    close(fd);
+  }
+#endif
+
+  if (!result)
+    gzerr << "Unable to flush [" << _path << "]" << std::endl;
+  return result;
+}
+
+//////////////////////////////////////////////////
+bool syncDirectory(const std::string &_path)
+{
+#ifdef _WIN32
+  (void)_path;
+  return true;
+#else
+  bool result = false;
+  int fd = open(_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd >= 0)
+  {
+    result = fsync(fd) == 0;
+    close(fd);
+  }
+
+  if (!result)
+    gzerr << "Unable to flush directory [" << _path << "]" << std::endl;
+  return result;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool syncTree(const std::string &_path)
+{
+  bool result = true;
+  common::DirIter endIt;
+  for (common::DirIter dirIt(_path); dirIt != endIt; ++dirIt)
+  {
+    const std::string path = *dirIt;
+    if (common::isDirectory(path))
+      result = syncTree(path) && result;
+    else
+      result = syncFile(path) && result;
+  }
+  return syncDirectory(_path) && result;
+}
+
+//////////////////////////////////////////////////
+bool syncDirectories(const std::string &_path)
+{
+  bool result = true;
+  common::DirIter endIt;
+  for (common::DirIter dirIt(_path); dirIt != endIt; ++dirIt)
+  {
+    const std::string path = *dirIt;
+    if (common::isDirectory(path))
+      result = syncDirectories(path) && result;
+  }
+  return syncDirectory(_path) && result;
+}
+
+//////////////////////////////////////////////////
+bool syncFilesystem(const std::string &_path)
+{
+#ifdef __linux__
+  int fd = open(_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd >= 0)
+  {
+    const bool result = syncfs(fd) == 0;
+    close(fd);
+    if (result)
+      return true;
+  }
+#endif
+  return syncTree(_path);
+}
+}  // namespace gz::fuel_tools
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_FILESYNC_HH_
+#define GZ_FUEL_TOOLS_FILESYNC_HH_
+
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Flush the content of a file to storage.
+/// \param[in] _path Path of the file.
+/// \return True on success.
+GZ_FUEL_TOOLS_VISIBLE
+bool syncFile(const std::string &_path);
+
+/// \brief Flush a directory to storage, which persists the creation,
+/// removal and renaming of its entries. Does nothing on Windows, where
+/// directories can't be flushed.
+/// \param[in] _path Path of the directory.
+/// \return True on success.
+GZ_FUEL_TOOLS_VISIBLE
+bool syncDirectory(const std::string &_path);
+
+/// \brief Flush every file and directory of a tree to storage, one by one.
+/// \param[in] _path Root of the tree.
+/// \return True on success.
+GZ_FUEL_TOOLS_VISIBLE
+bool syncTree(const std::string &_path);
+
+/// \brief Flush every directory of a tree to storage, but not the files,
+/// e.g. once the files were flushed as they were written.
+/// \param[in] _path Root of the tree.
+/// \return True on success.
+GZ_FUEL_TOOLS_VISIBLE
+bool syncDirectories(const std::string &_path);
+
+/// \brief Flush a tree to storage with as few flushes as possible. On
+/// Linux, a single syncfs flushes the whole filesystem holding the tree,
+/// elsewhere this falls back to syncTree.
+/// \param[in] _path Root of the tree.
+/// \return True on success.
+GZ_FUEL_TOOLS_VISIBLE
+bool syncFilesystem(const std::string &_path);
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_FILESYNC_HH_
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "FileSync.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class FileSyncTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(FileSyncTest, Sync)
+{
+  const std::string root = this->tempDir->Path();
+  const std::string dir = common::joinPaths(root, "a", "b");
+  ASSERT_TRUE(common::createDirectories(dir));
+  const std::string file = common::joinPaths(dir, "file");
+  std::ofstream(file) << "content";
+
+  EXPECT_TRUE(syncFile(file));
+  EXPECT_TRUE(syncDirectory(dir));
+  EXPECT_TRUE(syncTree(root));
+  EXPECT_TRUE(syncDirectories(root));
+  EXPECT_TRUE(syncFilesystem(root));
+
+  const std::string missing = common::joinPaths(root, "missing");
+  EXPECT_FALSE(syncFile(missing));
+#ifndef _WIN32
+  EXPECT_FALSE(syncDirectory(missing));
+  EXPECT_FALSE(syncDirectories(missing));
+#endif
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "gz/fuel_tools/FileView.hh"
+
+#include "MappedFile.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Identifies a version of a file on disk.
+struct FileStamp
+{
+  /// \brief Inode number, 0 where unsupported.
+  std::uint64_t inode = 0;
+
+  /// \brief Size in bytes.
+  std::uint64_t size = 0;
+
+  /// \brief Modification time, in nanoseconds where supported.
+  std::int64_t mtime = 0;
+
+  /// \brief Equality operator.
+  /// \param[in] _other Stamp to compare to.
+  /// \return True if both stamps are equal.
+  bool operator==(const FileStamp &_other) const
+  {
+    return this->inode == _other.inode && this->size == _other.size &&
+      this->mtime == _other.mtime;
+  }
+};
+
+/// \brief Private data class
+class FileViewPrivate
+{
+  /// \brief Path of the file.
+  public: std::string path;
+
+  /// \brief Mapping of the file, null for empty or loaded files.
+  public: std::unique_ptr<MappedFile> file;
+
+  /// \brief Content of loaded files.
+  public: std::string content;
+};
+
+/// \brief Mapping shared by all the views of a file.
+struct SharedView
+{
+  /// \brief The view, expired once all its copies are gone.
+  std::weak_ptr<const FileViewPrivate> view;
+
+  /// \brief Version of the file that was mapped.
+  FileStamp stamp;
+};
+
+/// \brief Views of all the files currently viewed in this process.
+class ViewRegistry
+{
+  /// \brief Protects the members.
+  public: std::mutex mutex;
+
+  /// \brief Views by path.
+  public: std::unordered_map<std::string, SharedView> views;
+
+  /// \brief Size of views that triggers the removal of expired views.
+  public: std::size_t pruneSize = 64;
+};
+
+//////////////////////////////////////////////////
+/// \brief Get the views of the process.
+/// \return The registry, never destroyed, so that views can outlive
+/// static objects.
+static ViewRegistry &Registry()
+{
+  static ViewRegistry *registry = new ViewRegistry;
+  return *registry;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the stamp of a file.
+/// \param[in] _path Path of the file.
+/// \param[out] _stamp Stamp of the file.
+/// \return False if the file doesn't exist or isn't a regular file.
+static bool Stamp(const std::string &_path, FileStamp &_stamp)
+{
+  struct stat st;
+  if (stat(_path.c_str(), &st) != 0 || (st.st_mode & S_IFMT) != S_IFREG)
+    return false;
+
+  _stamp.inode = st.st_ino;
+  _stamp.size = st.st_size;
+#ifdef __linux__
+  _stamp.mtime = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#else
+  _stamp.mtime = st.st_mtime;
+#endif
+  return true;
+}
+
+//////////////////////////////////////////////////
+FileView::FileView() = default;
+
+//////////////////////////////////////////////////
+FileView::FileView(const std::string &_path)
+{
+  FileStamp stamp;
+  if (!Stamp(_path, stamp))
+    return;
+
+  ViewRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  // Reuse the mapping of an unchanged file.
+  auto it = registry.views.find(_path);
+  if (it != registry.views.end() && it->second.stamp == stamp)
+  {
+    this->dataPtr = it->second.view.lock();
+    if (this->dataPtr)
+      return;
+  }
+
+  auto view = std::make_shared<FileViewPrivate>();
+  view->path = _path;
+  if (stamp.size > 0)
+  {
+    view->file = std::make_unique<MappedFile>(_path);
+    if (!view->file->Valid())
+      return;
+  }
+  this->dataPtr = view;
+
+  if (registry.views.size() >= registry.pruneSize)
+  {
+    for (auto iter = registry.views.begin(); iter != registry.views.end();)
+    {
+      if (iter->second.view.expired())
+        iter = registry.views.erase(iter);
+      else
+        ++iter;
+    }
+    registry.pruneSize = 2 * registry.views.size() + 64;
+  }
+  registry.views[_path] = {view, stamp};
+}
+
+//////////////////////////////////////////////////
+FileView FileView::Load(const std::string &_path)
+{
+  FileView result;
+  FileStamp stamp;
+  if (!Stamp(_path, stamp))
+    return result;
+
+  std::ifstream in(_path, std::ios::binary);
+  if (!in)
+    return result;
+
+  auto view = std::make_shared<FileViewPrivate>();
+  view->path = _path;
+  view->content.reserve(stamp.size);
+  view->content.assign(std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+  if (in.bad())
+    return result;
+
+  result.dataPtr = view;
+  return result;
+}
+
+//////////////////////////////////////////////////
+bool FileView::Valid() const
+{
+  return this->dataPtr != nullptr;
+}
+
+//////////////////////////////////////////////////
+FileView::operator bool() const
+{
+  return this->Valid();
+}
+
+//////////////////////////////////////////////////
+const char *FileView::Data() const
+{
+  if (!this->dataPtr)
+    return nullptr;
+  return this->dataPtr->file ? this->dataPtr->file->Data() :
+    this->dataPtr->content.c_str();
+}
+
+//////////////////////////////////////////////////
+std::size_t FileView::Size() const
+{
+  if (!this->dataPtr)
+    return 0;
+  return this->dataPtr->file ? this->dataPtr->file->Size() :
+    this->dataPtr->content.size();
+}
+
+//////////////////////////////////////////////////
+std::string FileView::Path() const
+{
+  return this->dataPtr ? this->dataPtr->path : "";
+}
+}  // namespace gz::fuel_tools
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "gz/fuel_tools/FileView.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class FileViewTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(FileViewTest, View)
+{
+  const std::string path = common::joinPaths(this->tempDir->Path(), "mesh");
+  std::ofstream(path, std::ios::binary) << "vertices";
+
+  FileView view(path);
+  ASSERT_TRUE(view);
+  EXPECT_EQ(path, view.Path());
+  EXPECT_EQ("vertices", std::string(view.Data(), view.Size()));
+
+  // Copies and new views of the same file share the mapping.
+  FileView copy = view;
+  FileView again(path);
+  EXPECT_EQ(view.Data(), copy.Data());
+  EXPECT_EQ(view.Data(), again.Data());
+
+  // Views can be read from other threads.
+  std::vector<std::thread> readers;
+  std::vector<int> matches(4, 0);
+  for (std::size_t i = 0; i < matches.size(); ++i)
+  {
+    readers.emplace_back([copy, &matches, i]()
+    {
+      matches[i] = std::string(copy.Data(), copy.Size()) == "vertices";
+    });
+  }
+  for (auto &reader : readers)
+    reader.join();
+  for (int match : matches)
+    EXPECT_TRUE(match);
+
+  // A changed file is mapped again, existing views are left untouched.
+  common::removeFile(path);
+  std::ofstream(path, std::ios::binary) << "more vertices";
+  FileView changed(path);
+  ASSERT_TRUE(changed);
+  EXPECT_EQ("more vertices", std::string(changed.Data(), changed.Size()));
+  EXPECT_EQ("vertices", std::string(view.Data(), view.Size()));
+}
+
+/////////////////////////////////////////////////
+TEST_F(FileViewTest, Invalid)
+{
+  FileView empty;
+  EXPECT_FALSE(empty);
+  EXPECT_EQ(nullptr, empty.Data());
+  EXPECT_EQ(0u, empty.Size());
+  EXPECT_TRUE(empty.Path().empty());
+
+  FileView missing(common::joinPaths(this->tempDir->Path(), "missing"));
+  EXPECT_FALSE(missing);
+
+  FileView directory(this->tempDir->Path());
+  EXPECT_FALSE(directory);
+
+  // Empty files are valid.
+  const std::string path = common::joinPaths(this->tempDir->Path(), "empty");
+  std::ofstream(path).close();
+  FileView emptyFile(path);
+  ASSERT_TRUE(emptyFile);
+  EXPECT_NE(nullptr, emptyFile.Data());
+  EXPECT_EQ(0u, emptyFile.Size());
+}
+
+/////////////////////////////////////////////////
+TEST_F(FileViewTest, Load)
+{
+  const std::string path = common::joinPaths(this->tempDir->Path(), "mesh");
+  std::ofstream(path, std::ios::binary) << "vertices";
+
+  FileView view = FileView::Load(path);
+  ASSERT_TRUE(view);
+  EXPECT_EQ(path, view.Path());
+  EXPECT_EQ("vertices", std::string(view.Data(), view.Size()));
+
+  // The content doesn't follow the file.
+  common::removeFile(path);
+  EXPECT_EQ("vertices", std::string(view.Data(), view.Size()));
+
+  EXPECT_FALSE(FileView::Load(path));
+  EXPECT_FALSE(FileView::Load(this->tempDir->Path()));
+
+  const std::string emptyPath =
+    common::joinPaths(this->tempDir->Path(), "empty");
+  std::ofstream(emptyPath).close();
+  FileView emptyFile = FileView::Load(emptyPath);
+  ASSERT_TRUE(emptyFile);
+  EXPECT_NE(nullptr, emptyFile.Data());
+  EXPECT_EQ(0u, emptyFile.Size());
+}
@@ -25,12 +25,22 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
+#include <unordered_set>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -50,8 +60,15 @@
 #include "gz/fuel_tools/WorldIdentifier.hh"
 #include "gz/fuel_tools/WorldIter.hh"
 
+#include "BatchOrder.hh"
+#include "DownloadJournal.hh"
+#include "DownloadScheduler.hh"
 #include "LocalCache.hh"
+#include "MemoryCache.hh"
 #include "ModelIterPrivate.hh"
+#include "RevalidationQueue.hh"
+#include "SearchIndex.hh"
+#include "UsageHistory.hh"
 #include "WorldIterPrivate.hh"
 
 namespace std
@@ -68,6 +85,94 @@ namespace std
 
 namespace gz::fuel_tools
 {
+/// \brief Maximum number of parallel transfers used by the automatic
+/// concurrency mode of DownloadModels and DownloadWorlds.
+static constexpr std::size_t kMaxDownloadJobs = 16;
+
+/// \brief Time without interactive or regular transfers after which the
+/// background revalidation may run.
+static constexpr std::chrono::seconds kRevalidationQuiet{5};
+
+/// \brief Maximum number of resources checked by a background
+/// revalidation pass.
+static constexpr std::size_t kRevalidationBatch = 8;
+
+/// \brief Archives larger than this are streamed to a partial file by the
+/// transfers of a journaled batch, so that they resume after an
+/// interruption. Smaller ones are downloaded again.
+static constexpr std::uint64_t kResumableBytes = 4 * 1024 * 1024;
+
+//////////////////////////////////////////////////
+/// \brief Get the item of a model in the journal of a batch download.
+/// \param[in] _id The model.
+/// \return Kind, unique name and version of the model.
+static std::string journalItem(const ModelIdentifier &_id)
+{
+  return "model:" + _id.UniqueName() + "@" + _id.VersionStr();
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the item of a world in the journal of a batch download.
+/// \param[in] _id The world.
+/// \return Kind, unique name and version of the world.
+static std::string journalItem(const WorldIdentifier &_id)
+{
+  return "world:" + _id.UniqueName() + "@" + _id.VersionStr();
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the version of a downloaded resource from the response
+/// headers.
+/// \param[in] _resp Response of the download request.
+/// \return The version, 1 if the header is missing or invalid.
+static unsigned int ResourceVersion(const RestResponse &_resp)
+{
+  unsigned int version = 1;
+  if (!_resp.headers.Has("X-Ign-Resource-Version"))
+  {
+    gzwarn << "Missing X-Ign-Resource-Version in REST response headers."
+            << " Hardcoding version 1." << std::endl;
+  }
+  else if (!_resp.headers.ResourceVersion(version))
+  {
+    gzwarn << "Failed to convert X-Ign-Resource-Version header value ["
+            << _resp.headers.Value("X-Ign-Resource-Version")
+            << "] to integer. Hardcoding version 1." << std::endl;
+  }
+  return version;
+}
+
+//////////////////////////////////////////////////
+/// \brief Check that the whole body of a response was received, when the
+/// server announced its size.
+/// \param[in] _resp Response holding an archive.
+/// \return False if the body is shorter or longer than announced.
+static bool CompleteBody(const RestResponse &_resp)
+{
+  // The announced size is the encoded size of compressed bodies.
+  std::uint64_t expected = 0;
+  if (!_resp.headers.ContentLength(expected) ||
+      _resp.headers.Has("Content-Encoding"))
+  {
+    return true;
+  }
+
+  std::uint64_t received = _resp.data.size();
+  if (!_resp.dataPath.empty())
+  {
+    std::ifstream file(_resp.dataPath, std::ios::binary | std::ios::ate);
+    received = std::max<std::streamoff>(file.tellg(), 0);
+  }
+
+  if (received != expected)
+  {
+    gzerr << "Received [" << received << "] bytes instead of the ["
+          << expected << "] announced. Unable to download.\n";
+    return false;
+  }
+  return true;
+}
+
 /// \brief Private Implementation
 class FuelClientPrivate
 {
@@ -212,10 +317,199 @@ class FuelClientPrivate
   /// license information.
   public: void PopulateLicenses(const ServerConfig &_server);
 
+  /// \brief Download an archive, admitting the transfer through the
+  /// scheduler, and hand it to _save while the transfer still holds its
+  /// share of the memory budget.
+  /// \param[in] _rest REST client.
+  /// \param[in] _server Server to download from.
+  /// \param[in] _route Route of the archive.
+  /// \param[in] _headers Headers of the request.
+  /// \param[in] _priority Priority class of the transfer.
+  /// \param[in] _expectedBytes Expected size of the archive, 0 if unknown.
+  /// \param[out] _resp Response of the request.
+  /// \param[in] _save Callback receiving either the zip data, or the path
+  /// of the zip file when the archive was streamed to disk. It returns
+  /// false if the archive couldn't be saved.
+  /// \return True if the archive was downloaded and saved.
+  public: bool DownloadArchive(const Rest &_rest,
+              const ServerConfig &_server, const std::string &_route,
+              const std::vector<std::string> &_headers,
+              DownloadPriority _priority, std::uint64_t _expectedBytes,
+              RestResponse &_resp,
+              const std::function<bool(const std::string &_zip,
+                const std::string &_zipPath)> &_save);
+
+  /// \brief Download a model, see FuelClient::DownloadModel.
+  /// \param[in] _client Client reading the dependencies of the model.
+  /// \param[in] _rest REST client, whose cancellation token aborts the
+  /// transfer.
+  /// \param[in] _id The model identifier.
+  /// \param[in] _headers Headers of the request, including the API key of
+  /// the server.
+  /// \param[out] _dependencies Dependencies of the model.
+  /// \param[in] _priority Priority class of the transfer.
+  /// \param[out] _downloaded If not null, set to the identifier of the
+  /// saved model, with its version and the SHA-256 of its archive.
+  /// \return Result of the download operation.
+  public: Result DownloadModel(FuelClient &_client, const Rest &_rest,
+              const ModelIdentifier &_id,
+              const std::vector<std::string> &_headers,
+              std::vector<ModelIdentifier> &_dependencies,
+              DownloadPriority _priority,
+              ModelIdentifier *_downloaded = nullptr);
+
+  /// \brief Download a world, see FuelClient::DownloadWorld.
+  /// \param[in] _rest REST client, whose cancellation token aborts the
+  /// transfer.
+  /// \param[in,out] _id The world identifier.
+  /// \param[in] _headers Headers of the request, including the API key of
+  /// the server.
+  /// \param[in] _priority Priority class of the transfer.
+  /// \return Result of the download operation.
+  public: Result DownloadWorld(const Rest &_rest, WorldIdentifier &_id,
+              const std::vector<std::string> &_headers,
+              DownloadPriority _priority);
+
+  /// \brief Drop the files of a version of a model or world from the
+  /// memory cache, as a version downloaded again may have other files.
+  /// \param[in] _uniqueName Unique name of the model or world.
+  /// \param[in] _version Version that was installed.
+  /// \param[in] _localPath Path of the version in the local cache.
+  public: void InvalidateMemoryCache(const std::string &_uniqueName,
+              const std::string &_version, const std::string &_localPath);
+
   /// \brief Get zip data from a REST response. This is used by world and
   /// model download.
-  public: void ZipFromResponse(const RestResponse &_resp,
-              std::string &_zip);
+  /// \param[in] _resp The response, its data is moved out.
+  /// \param[out] _zip The zip data, empty if the zip was streamed to disk
+  /// or on failure.
+  /// \param[out] _zipPath Path of the zip file when it was streamed to
+  /// disk, empty otherwise.
+  /// \param[in] _spillPath File a referred archive is streamed to.
+  /// \param[in] _spillThreshold Largest archive kept in memory, 0 for no
+  /// limit.
+  /// \param[in] _resume True to resume a referred archive from the end of
+  /// _spillPath, see Rest::Download.
+  public: void ZipFromResponse(RestResponse &_resp, std::string &_zip,
+              std::string &_zipPath, const std::string &_spillPath,
+              std::uint64_t _spillThreshold, bool _resume);
+
+  /// \brief Warm up the connections to a set of servers.
+  /// \param[in] _rest REST client.
+  /// \param[in] _servers Servers to connect to.
+  /// \sa FuelClient::Warmup
+  public: static void Warmup(const Rest &_rest,
+              const std::vector<ServerConfig> &_servers);
+
+  /// \brief Download the models and worlds of listings while the listings
+  /// are still being fetched. The calling thread walks the iterators, which
+  /// request a page at a time, and queues each resource as soon as its page
+  /// is parsed. Workers download from the queue, together with the
+  /// dependencies of the models.
+  /// \param[in] _client Client used to download.
+  /// \param[in] _models Models to download.
+  /// \param[in] _worlds Worlds to download.
+  /// \param[in] _jobs Number of parallel downloads, zero for the automatic
+  /// concurrency mode.
+  /// \param[in] _priority Priority class of the transfers.
+  /// \param[in] _cacheCheck How the resources and the dependencies of the
+  /// models are checked against the local cache before downloading them.
+  /// The dependencies of cached models are read from the cache.
+  /// \param[out] _stats Summary of the operation, may be null.
+  /// \param[in] _batch Name of the batch, the same for every run of it,
+  /// which journals its progress to resume it after an interruption. Empty
+  /// to not journal it.
+  /// \return FETCH if everything listed was downloaded or skipped,
+  /// CANCELLED if the client was cancelled, FETCH_ERROR otherwise.
+  public: Result PipelinedDownload(FuelClient &_client, ModelIter _models,
+              WorldIter _worlds, std::size_t _jobs,
+              DownloadPriority _priority,
+              CacheCheck _cacheCheck = CacheCheck::NONE,
+              BulkDownloadStats *_stats = nullptr,
+              const std::string &_batch = "");
+
+  /// \brief Run background revalidation passes until stopped, see
+  /// FuelClient::Revalidate. A pass starts once the scheduler has been idle
+  /// for a while, and the next one an interval later, or as soon as the
+  /// scheduler is idle again if the pass had more due resources than it
+  /// could check.
+  /// \param[in] _client Client to revalidate.
+  /// \param[in] _config Copy of the client configuration taken when the
+  /// loop started. The loop never reads the configuration of the client,
+  /// which may be changed through FuelClient::Config in the meantime.
+  /// \param[in] _rest REST client of the loop, cancelled by revalidationStop
+  /// so that destroying the client aborts the transfer in progress.
+  public: void RevalidationLoop(FuelClient &_client,
+              ClientConfig _config, Rest _rest);
+
+  /// \brief Run a revalidation pass, see FuelClient::Revalidate.
+  /// \param[in] _client Client to revalidate.
+  /// \param[in] _config Configuration giving the servers and the
+  /// revalidation interval.
+  /// \param[in] _rest REST client of the requests and downloads.
+  /// \param[out] _stats Summary of the pass.
+  /// \param[in] _max Maximum number of cached resources to check.
+  /// \return Result of the pass.
+  public: Result Revalidate(FuelClient &_client,
+              const ClientConfig &_config, const Rest &_rest,
+              BulkDownloadStats &_stats, std::size_t _max);
+
+  /// \brief Parse a model URL, see FuelClient::ParseModelUrl.
+  /// \param[in] _modelUrl The unique URL of a model.
+  /// \param[out] _id The model identifier.
+  /// \param[in] _servers Servers whose configuration completes the
+  /// identifier.
+  /// \return True if parsed successfully.
+  public: bool ParseModelUrl(const common::URI &_modelUrl,
+              ModelIdentifier &_id,
+              const std::vector<ServerConfig> &_servers) const;
+
+  /// \brief Parse a world URL, see FuelClient::ParseWorldUrl.
+  /// \param[in] _worldUrl The unique URL of a world.
+  /// \param[out] _id The world identifier.
+  /// \param[in] _servers Servers whose configuration completes the
+  /// identifier.
+  /// \return True if parsed successfully.
+  public: bool ParseWorldUrl(const common::URI &_worldUrl,
+              WorldIdentifier &_id,
+              const std::vector<ServerConfig> &_servers) const;
+
+  /// \brief Check whether the local cache satisfies a model that a batch
+  /// download is about to fetch.
+  /// \param[in] _client Client, used to ask for the latest version.
+  /// \param[in,out] _id The model. Under CacheCheck::TIP, a model without
+  /// version gets the latest version on the server, when it's known.
+  /// \param[in] _check How to check the cache.
+  /// \return True if the model doesn't need to be downloaded.
+  public: bool SatisfiedByCache(const FuelClient &_client,
+              ModelIdentifier &_id, CacheCheck _check) const;
+
+  /// \brief Check whether the local cache satisfies a world that a batch
+  /// download is about to fetch.
+  /// \param[in] _client Client, used to ask for the latest version.
+  /// \param[in,out] _id The world. Under CacheCheck::TIP, a world without
+  /// version gets the latest version on the server, when it's known.
+  /// \param[in] _check How to check the cache.
+  /// \return True if the world doesn't need to be downloaded.
+  public: bool SatisfiedByCache(const FuelClient &_client,
+              WorldIdentifier &_id, CacheCheck _check) const;
+
+  /// \brief Get the path of the search index of a server.
+  /// \param[in] _server The server.
+  /// \return Path of the index, in the cache directory of the server.
+  public: std::string SearchIndexPath(const ServerConfig &_server) const;
+
+  /// \brief Get a new path for an archive streamed to disk.
+  /// \return Path of a file in the download directory of the cache.
+  public: std::string SpillPath();
+
+  /// \brief Get the partial file of an archive of the journaled batch
+  /// being downloaded, see DownloadJournal::PartialPath.
+  /// \param[in] _server Server of the archive.
+  /// \param[in] _route Route of the archive.
+  /// \return Path of the file, empty if no batch is journaled.
+  public: std::string PartialPath(const ServerConfig &_server,
+              const std::string &_route) const;
 
   /// \brief Client configuration
   public: ClientConfig config;
@@ -226,6 +520,56 @@ class FuelClientPrivate
   /// \brief Local Cache
   public: std::shared_ptr<LocalCache> cache;
 
+  /// \brief Admits archive transfers and gathers download statistics.
+  public: DownloadScheduler scheduler;
+
+  /// \brief Keeps hot cached files in memory, see
+  /// ClientConfig::SetMemoryCacheBudget.
+  public: MemoryCache memoryCache;
+
+  /// \brief Search indexes loaded by SearchModels, by path.
+  public: std::map<std::string, std::shared_ptr<SearchIndex>> searchIndexes;
+
+  /// \brief Protects searchIndexes.
+  public: mutable std::mutex searchMutex;
+
+  /// \brief Resources used under each usage tag, see RecordUsage.
+  public: std::unique_ptr<UsageHistory> usageHistory;
+
+  /// \brief Ranks the resources to revalidate and remembers their checks.
+  public: RevalidationQueue revalidation;
+
+  /// \brief Background revalidation started by the constructor, if any.
+  public: std::thread revalidationThread;
+
+  /// \brief Protects stopRevalidation.
+  public: std::mutex revalidationMutex;
+
+  /// \brief Signaled when stopRevalidation is set.
+  public: std::condition_variable revalidationCv;
+
+  /// \brief True when the background revalidation must stop.
+  public: std::atomic<bool> stopRevalidation{false};
+
+  /// \brief Cancellation token of the background revalidation, cancelled
+  /// together with stopRevalidation to abort its transfer in progress.
+  public: CancellationToken revalidationStop;
+
+  /// \brief Background warm-up started by the constructor, if any.
+  public: std::thread warmupThread;
+
+  /// \brief Cancellation token of the background warm-up, cancelled by the
+  /// destructor so that it doesn't wait for unresponsive servers.
+  public: CancellationToken warmupStop;
+
+  /// \brief Journal of the batch being downloaded, whose transfers keep
+  /// their partial archive when interrupted. Batches downloaded at the same
+  /// time as the first one aren't resumable.
+  public: std::shared_ptr<DownloadJournal> journal;
+
+  /// \brief Protects journal.
+  public: mutable std::mutex journalMutex;
+
   /// \brief Regex to parse Gazebo Fuel model URLs.
   public: std::unique_ptr<std::regex> urlModelRegex;
 
@@ -247,6 +591,21 @@ class FuelClientPrivate
   public: std::map<std::string, unsigned int> licenses;
 };
 
+//////////////////////////////////////////////////
+/// \brief Get the key of a cached file in the memory tier.
+/// \param[in] _uniqueName Unique name of the model or world.
+/// \param[in] _version Version of the model or world.
+/// \param[in] _filePath Path of the file within the model or world.
+/// \return Key of the file.
+static std::string MemoryCacheKey(const std::string &_uniqueName,
+    const std::string &_version, const std::string &_filePath)
+{
+  std::string key = _uniqueName + "/" + _version;
+  for (const auto &token : common::split(_filePath, "/"))
+    key += "/" + token;
+  return key;
+}
+
 //////////////////////////////////////////////////
 FuelClient::FuelClient()
   : FuelClient(ClientConfig(), Rest())
@@ -260,8 +619,25 @@ FuelClient::FuelClient(const ClientConfig &_config, const Rest &_rest)
   this->dataPtr->config = _config;
   this->dataPtr->rest = _rest;
   this->dataPtr->rest.SetUserAgent(this->dataPtr->config.UserAgent());
+  if (this->dataPtr->config.Http2())
+    this->dataPtr->rest.SetHttp2(true);
+  this->dataPtr->scheduler.SetMemoryBudget(
+      this->dataPtr->config.DownloadMemoryBudget());
+  this->dataPtr->memoryCache.SetBudget(
+      this->dataPtr->config.MemoryCacheBudget());
 
   this->dataPtr->cache = std::make_unique<LocalCache>(&(this->dataPtr->config));
+  this->dataPtr->usageHistory = std::make_unique<UsageHistory>(
+      common::joinPaths(this->dataPtr->config.CacheLocation(), ".usage"));
+
+  if (this->dataPtr->config.Prewarm())
+  {
+    // Work on copies, the configuration may be changed in the meantime.
+    Rest rest(this->dataPtr->rest);
+    rest.SetCancellationToken(this->dataPtr->warmupStop);
+    this->dataPtr->warmupThread = std::thread(&FuelClientPrivate::Warmup,
+        std::move(rest), this->dataPtr->config.Servers());
+  }
 
   this->dataPtr->urlModelRegex.reset(new std::regex(
     this->dataPtr->kModelUrlRegexStr));
@@ -273,11 +649,77 @@ FuelClient::FuelClient(const ClientConfig &_config, const Rest &_rest)
     this->dataPtr->kWorldFileUrlRegexStr));
   this->dataPtr->urlCollectionRegex.reset(new std::regex(
     this->dataPtr->kCollectionUrlRegexStr));
+
+  if (this->dataPtr->config.RevalidationInterval().count() > 0)
+  {
+    // Work on a copy, the configuration may be changed in the meantime.
+    Rest rest(this->dataPtr->rest);
+    rest.SetCancellationToken(this->dataPtr->revalidationStop);
+    this->dataPtr->revalidationThread = std::thread(
+        &FuelClientPrivate::RevalidationLoop, this->dataPtr.get(),
+        std::ref(*this), this->dataPtr->config, std::move(rest));
+  }
 }
 
 //////////////////////////////////////////////////
 FuelClient::~FuelClient()
 {
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->revalidationMutex);
+    this->dataPtr->stopRevalidation = true;
+  }
+  this->dataPtr->revalidationStop.Cancel();
+  this->dataPtr->revalidationCv.notify_all();
+  if (this->dataPtr->revalidationThread.joinable())
+    this->dataPtr->revalidationThread.join();
+
+  this->dataPtr->warmupStop.Cancel();
+  if (this->dataPtr->warmupThread.joinable())
+    this->dataPtr->warmupThread.join();
+}
+
+//////////////////////////////////////////////////
+void FuelClient::SetCancellationToken(const CancellationToken &_token)
+{
+  this->dataPtr->rest.SetCancellationToken(_token);
+}
+
+//////////////////////////////////////////////////
+const CancellationToken &FuelClient::Cancellation() const
+{
+  return this->dataPtr->rest.Cancellation();
+}
+
+//////////////////////////////////////////////////
+void FuelClient::Warmup()
+{
+  FuelClientPrivate::Warmup(this->dataPtr->rest,
+      this->dataPtr->config.Servers());
+}
+
+//////////////////////////////////////////////////
+void FuelClientPrivate::Warmup(const Rest &_rest,
+    const std::vector<ServerConfig> &_servers)
+{
+  std::vector<std::thread> threads;
+  for (const auto &server : _servers)
+  {
+    if (!server.Url().Valid())
+      continue;
+
+    threads.emplace_back([&_rest, url = server.Url().Str()]()
+    {
+      auto start = std::chrono::steady_clock::now();
+      RestResponse resp = _rest.Request(HttpMethod::HEAD, url, "", "", {},
+          {}, "");
+      gzdbg << "Warmed up connection to [" << url << "] in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - start).count()
+            << " ms (status " << resp.statusCode << ")" << std::endl;
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
 }
 
 //////////////////////////////////////////////////
@@ -297,7 +739,7 @@ Result FuelClient::ModelDetails(const ModelIdentifier &_id,
 Result FuelClient::ModelDetails(const ModelIdentifier &_id,
     ModelIdentifier &_model, const std::vector<std::string> &_headers) const
 {
-  gz::fuel_tools::Rest rest;
+  Rest rest(this->dataPtr->rest);
   RestResponse resp;
 
   auto serverUrl = _id.Server().Url().Str();
@@ -361,7 +803,7 @@ Result FuelClient::WorldDetails(const WorldIdentifier &_id,
   if (serverUrl.empty() || _id.Owner().empty() || _id.Name().empty())
     return Result(ResultType::FETCH_ERROR);
 
-  gz::fuel_tools::Rest rest;
+  Rest rest(this->dataPtr->rest);
   RestResponse resp;
 
   auto version = _id.Server().Version();
@@ -485,6 +927,50 @@ WorldIter FuelClient::Worlds(const CollectionIdentifier &_id) const
       common::joinPaths(_id.Owner(), "collections", _id.Name(), "worlds"));
 }
 
+//////////////////////////////////////////////////
+ModelIter FuelClient::Models(const ServerConfig &_server,
+    const ResourceQuery &_query) const
+{
+  return ModelIterFactory::Create(this->dataPtr->rest, _server, "models",
+      _query);
+}
+
+//////////////////////////////////////////////////
+ModelIter FuelClient::Models(const ModelIdentifier &_id,
+    const ResourceQuery &_query) const
+{
+  if (_id.Owner().empty())
+    return this->Models(_id.Server(), _query);
+
+  // Note: gz-fuel-server doesn't like URLs ending in /
+  common::URIPath path;
+  path = path / _id.Owner() / "models";
+  return ModelIterFactory::Create(this->dataPtr->rest, _id.Server(),
+      path.Str(), _query);
+}
+
+//////////////////////////////////////////////////
+WorldIter FuelClient::Worlds(const ServerConfig &_server,
+    const ResourceQuery &_query) const
+{
+  return WorldIterFactory::Create(this->dataPtr->rest, _server, "worlds",
+      _query);
+}
+
+//////////////////////////////////////////////////
+WorldIter FuelClient::Worlds(const WorldIdentifier &_id,
+    const ResourceQuery &_query) const
+{
+  if (_id.Owner().empty())
+    return this->Worlds(_id.Server(), _query);
+
+  // Note: gz-fuel-server doesn't like URLs ending in /
+  common::URIPath path;
+  path = path / _id.Owner() / "worlds";
+  return WorldIterFactory::Create(this->dataPtr->rest, _id.Server(),
+      path.Str(), _query);
+}
+
 //////////////////////////////////////////////////
 Result FuelClient::UploadModel(const std::string &_pathToModelDir,
     const ModelIdentifier &_id, const std::vector<std::string> &_headers,
@@ -498,7 +984,7 @@ Result FuelClient::UploadModel(const std::string &_pathToModelDir,
     const ModelIdentifier &_id, const std::vector<std::string> &_headers,
     bool _private, const std::string &_owner)
 {
-  gz::fuel_tools::Rest rest;
+  Rest rest(this->dataPtr->rest);
   RestResponse resp;
 
   std::multimap<std::string, std::string> form;
@@ -516,6 +1002,9 @@ Result FuelClient::UploadModel(const std::string &_pathToModelDir,
       _id.Server().Version(), "models", {},
       headersIncludingServerConfig, "", form);
 
+  if (rest.Cancellation().Cancelled())
+    return Result(ResultType::CANCELLED);
+
   if (resp.statusCode != 200)
   {
     std::string categories;
@@ -570,7 +1059,7 @@ void FuelClient::AddServerConfigParametersToHeaders(
 Result FuelClient::DeleteUrl(const gz::common::URI &_uri,
     const std::vector<std::string> &_headers)
 {
-  gz::fuel_tools::Rest rest;
+  Rest rest(this->dataPtr->rest);
 
   RestResponse resp;
 
@@ -664,8 +1153,25 @@ Result FuelClient::DownloadModel(const ModelIdentifier &_id,
 //////////////////////////////////////////////////
 Result FuelClient::DownloadModel(const ModelIdentifier &_id,
     const std::vector<std::string> &_headers,
-    std::vector<ModelIdentifier> &_dependencies)
+    std::vector<ModelIdentifier> &_dependencies, DownloadPriority _priority)
+{
+  std::vector<std::string> headersIncludingServerConfig = _headers;
+  AddServerConfigParametersToHeaders(
+    _id.Server(), headersIncludingServerConfig);
+  return this->dataPtr->DownloadModel(*this, this->dataPtr->rest, _id,
+      headersIncludingServerConfig, _dependencies, _priority);
+}
+
+//////////////////////////////////////////////////
+Result FuelClientPrivate::DownloadModel(FuelClient &_client,
+    const Rest &_rest, const ModelIdentifier &_id,
+    const std::vector<std::string> &_headers,
+    std::vector<ModelIdentifier> &_dependencies, DownloadPriority _priority,
+    ModelIdentifier *_downloaded)
 {
+  if (_rest.Cancellation().Cancelled())
+    return Result(ResultType::CANCELLED);
+
   // Server config
   if (!_id.Server().Url().Valid() || _id.Server().Version().empty())
   {
@@ -681,15 +1187,33 @@ Result FuelClient::DownloadModel(const ModelIdentifier &_id,
 
   gzmsg << "Downloading model [" << _id.UniqueName() << "]" << std::endl;
 
-  std::vector<std::string> headersIncludingServerConfig = _headers;
-  AddServerConfigParametersToHeaders(
-    _id.Server(), headersIncludingServerConfig);
   // Request
-  gz::fuel_tools::Rest rest;
   RestResponse resp;
-  resp = rest.Request(HttpMethod::GET, _id.Server().Url().Str(),
-      _id.Server().Version(), route.Str(), {"link=true"},
-      headersIncludingServerConfig, "");
+  ModelIdentifier newId = _id;
+  bool saved = this->DownloadArchive(_rest, _id.Server(),
+      route.Str(), _headers, _priority, _id.FileSize(),
+      resp, [&](const std::string &_zip, const std::string &_zipPath)
+      {
+        newId.SetVersion(ResourceVersion(resp));
+        newId.SHA_256(resp.sha256);
+
+        // Save
+        // Note that the save function doesn't return the path
+        return _zipPath.empty() ?
+          this->cache->SaveModel(newId, _zip, true) :
+          this->cache->SaveModelArchive(newId, _zipPath, true);
+      });
+  if (saved)
+  {
+    this->InvalidateMemoryCache(newId.UniqueName(), newId.VersionStr(),
+        this->cache->MatchingModel(newId).PathToModel());
+    if (_downloaded)
+      *_downloaded = newId;
+  }
+
+  if (_rest.Cancellation().Cancelled() && !saved)
+    return Result(ResultType::CANCELLED);
+
   if (resp.statusCode != 200)
   {
     gzerr << "Failed to download model." << std::endl
@@ -699,38 +1223,10 @@ Result FuelClient::DownloadModel(const ModelIdentifier &_id,
     return Result(ResultType::FETCH_ERROR);
   }
 
-  // Get version from header
-  ModelIdentifier newId = _id;
-  unsigned int version = 1;
-  if (resp.headers.find("X-Ign-Resource-Version") != resp.headers.end())
-  {
-    try
-    {
-      version = std::stoi(resp.headers["X-Ign-Resource-Version"]);
-    }
-    catch(std::invalid_argument &)
-    {
-      gzwarn << "Failed to convert X-Ign-Resource-Version header value ["
-              << resp.headers["X-Ign-Resource-Version"]
-              << "] to integer. Hardcoding version 1." << std::endl;
-    }
-  }
-  else
-  {
-    gzwarn << "Missing X-Ign-Resource-Version in REST response headers."
-            << " Hardcoding version 1." << std::endl;
-  }
-  newId.SetVersion(version);
-
-  std::string zipData;
-  this->dataPtr->ZipFromResponse(resp, zipData);
-
-  // Save
-  // Note that the save function doesn't return the path
-  if (zipData.empty() || !this->dataPtr->cache->SaveModel(newId, zipData, true))
+  if (!saved)
     return Result(ResultType::FETCH_ERROR);
 
-  return this->ModelDependencies(_id, _dependencies);
+  return _client.ModelDependencies(_id, _dependencies);
 }
 
 //////////////////////////////////////////////////
@@ -836,8 +1332,23 @@ Result FuelClient::DownloadWorld(WorldIdentifier &_id)
 
 //////////////////////////////////////////////////
 Result FuelClient::DownloadWorld(WorldIdentifier &_id,
-    const std::vector<std::string> &_headers)
+    const std::vector<std::string> &_headers, DownloadPriority _priority)
 {
+  std::vector<std::string> headersIncludingServerConfig = _headers;
+  AddServerConfigParametersToHeaders(
+    _id.Server(), headersIncludingServerConfig);
+  return this->dataPtr->DownloadWorld(this->dataPtr->rest, _id,
+      headersIncludingServerConfig, _priority);
+}
+
+//////////////////////////////////////////////////
+Result FuelClientPrivate::DownloadWorld(const Rest &_rest,
+    WorldIdentifier &_id, const std::vector<std::string> &_headers,
+    DownloadPriority _priority)
+{
+  if (_rest.Cancellation().Cancelled())
+    return Result(ResultType::CANCELLED);
+
   // Server config
   if (!_id.Server().Url().Valid() || _id.Server().Version().empty())
   {
@@ -853,16 +1364,30 @@ Result FuelClient::DownloadWorld(WorldIdentifier &_id,
 
   gzmsg << "Downloading world [" << _id.UniqueName() << "]" << std::endl;
 
-  std::vector<std::string> headersIncludingServerConfig = _headers;
-  AddServerConfigParametersToHeaders(
-    _id.Server(), headersIncludingServerConfig);
 
   // Request
-  gz::fuel_tools::Rest rest;
   RestResponse resp;
-  resp = rest.Request(HttpMethod::GET, _id.Server().Url().Str(),
-      _id.Server().Version(), route.Str(), {"link=true"},
-      headersIncludingServerConfig, "");
+  bool saved = this->DownloadArchive(_rest, _id.Server(),
+      route.Str(), _headers, _priority, _id.FileSize(), resp,
+      [&](const std::string &_zip, const std::string &_zipPath)
+      {
+        _id.SetVersion(ResourceVersion(resp));
+        _id.SHA_256(resp.sha256);
+
+        // Save
+        return _zipPath.empty() ?
+          this->cache->SaveWorld(_id, _zip, true) :
+          this->cache->SaveWorldArchive(_id, _zipPath, true);
+      });
+  if (saved)
+  {
+    this->InvalidateMemoryCache(_id.UniqueName(), _id.VersionStr(),
+        _id.LocalPath());
+  }
+
+  if (_rest.Cancellation().Cancelled() && !saved)
+    return Result(ResultType::CANCELLED);
+
   if (resp.statusCode != 200)
   {
     gzerr << "Failed to download world." << std::endl
@@ -872,51 +1397,92 @@ Result FuelClient::DownloadWorld(WorldIdentifier &_id,
     return Result(ResultType::FETCH_ERROR);
   }
 
-  // Get version from header
-  unsigned int version = 1;
+  if (!saved)
+    return Result(ResultType::FETCH_ERROR);
+
+  return Result(ResultType::FETCH);
+}
 
-  if (resp.headers.find("X-Ign-Resource-Version") != resp.headers.end())
+//////////////////////////////////////////////////
+void FuelClientPrivate::InvalidateMemoryCache(const std::string &_uniqueName,
+    const std::string &_version, const std::string &_localPath)
+{
+  // Pinned versions are kept by name and version, see CachedModelFileView,
+  // the others by path.
+  this->memoryCache.Invalidate(MemoryCacheKey(_uniqueName, _version, "") +
+      "/");
+  if (!_localPath.empty())
   {
-    try
-    {
-      version = std::stoi(resp.headers["X-Ign-Resource-Version"]);
-    }
-    catch(std::invalid_argument &)
-    {
-      gzwarn << "Failed to convert X-Ign-Resource-Version header value ["
-              << resp.headers["X-Ign-Resource-Version"]
-              << "] to integer. Hardcoding version 1." << std::endl;
-    }
+    this->memoryCache.Invalidate(
+        common::separator(common::absPath(_localPath)));
   }
-  else
+}
+
+//////////////////////////////////////////////////
+bool FuelClientPrivate::SatisfiedByCache(const FuelClient &_client,
+    ModelIdentifier &_id, CacheCheck _check) const
+{
+  if (_check == CacheCheck::NONE)
+    return false;
+
+  if (_check == CacheCheck::TIP && _id.Version() == 0)
   {
-    gzwarn << "Missing X-Ign-Resource-Version in REST response headers."
-            << " Hardcoding version 1." << std::endl;
+    ModelIdentifier cloudId;
+    if (_client.ModelDetails(_id, cloudId) && cloudId.Version() > 0)
+      _id.SetVersion(cloudId.Version());
+    else
+      gzdbg << "Latest version of [" << _id.UniqueName() << "] unknown, "
+            << "any cached version will do" << std::endl;
   }
-  _id.SetVersion(version);
 
-  std::string zipData;
-  this->dataPtr->ZipFromResponse(resp, zipData);
+  return this->cache->HasModel(_id);
+}
 
-  // Save
-  if (zipData.empty() || !this->dataPtr->cache->SaveWorld(_id, zipData, true))
-      return Result(ResultType::FETCH_ERROR);
+//////////////////////////////////////////////////
+bool FuelClientPrivate::SatisfiedByCache(const FuelClient &_client,
+    WorldIdentifier &_id, CacheCheck _check) const
+{
+  if (_check == CacheCheck::NONE)
+    return false;
 
-  return Result(ResultType::FETCH);
+  if (_check == CacheCheck::TIP && _id.Version() == 0)
+  {
+    WorldIdentifier cloudId;
+    if (_client.WorldDetails(_id, cloudId) && cloudId.Version() > 0)
+      _id.SetVersion(cloudId.Version());
+    else
+      gzdbg << "Latest version of [" << _id.UniqueName() << "] unknown, "
+            << "any cached version will do" << std::endl;
+  }
+
+  return this->cache->HasWorld(_id);
 }
 
 //////////////////////////////////////////////////
 std::vector<FuelClient::ModelResult> FuelClient::DownloadModels(
     const std::vector<ModelIdentifier> &_ids,
-    size_t _jobs)
+    size_t _jobs, DownloadPriority _priority, CacheCheck _cacheCheck)
 {
   std::mutex resultMutex;
   std::vector<FuelClient::ModelResult> result;
 
   std::mutex idsMutex;
-  std::deque<ModelIdentifier> idsToDownload(_ids.begin(), _ids.end());
+  // Start the largest models first, so that a large model listed last
+  // doesn't keep one job busy after the others are done. Dependencies are
+  // appended as they are discovered.
+  std::vector<std::uint64_t> sizes;
+  sizes.reserve(_ids.size());
+  for (const auto &id : _ids)
+    sizes.push_back(id.FileSize());
+  std::deque<ModelIdentifier> idsToDownload;
+  for (auto index : largestFirst(sizes))
+    idsToDownload.push_back(_ids[index]);
   std::unordered_set<ModelIdentifier> uniqueIds(_ids.begin(), _ids.end());
 
+  // Number of models popped from the queue whose dependencies haven't been
+  // queued yet.
+  std::size_t inProgress = 0;
+
   std::atomic<bool> running = true;
 
   auto downloadWorker = [&](){
@@ -928,7 +1494,7 @@ std::vector<FuelClient::ModelResult> FuelClient::DownloadModels(
       {
         std::lock_guard<std::mutex> lock(idsMutex);
 
-        if (idsToDownload.empty())
+        if (idsToDownload.empty() || this->Cancellation().Cancelled())
         {
           std::this_thread::sleep_for(std::chrono::milliseconds(10));
           continue;
@@ -936,19 +1502,40 @@ std::vector<FuelClient::ModelResult> FuelClient::DownloadModels(
 
         id = idsToDownload.front();
         idsToDownload.pop_front();
+        ++inProgress;
       }
 
+      // Cached models are reported separately, and their dependencies are
+      // read from the cache, so that models sharing dependencies don't
+      // download them again on every run.
       std::vector<ModelIdentifier> dependencies;
-      auto modelResult = this->DownloadModel(id, {}, dependencies);
+      ModelIdentifier target = id;
+      Result modelResult;
+      if (this->dataPtr->SatisfiedByCache(*this, target, _cacheCheck))
+      {
+        modelResult = Result(ResultType::FETCH_ALREADY_EXISTS);
+        this->ModelDependencies(target, dependencies);
+      }
+      else
+      {
+        // Report the digest of the archive with the model.
+        std::vector<std::string> headers;
+        AddServerConfigParametersToHeaders(target.Server(), headers);
+        ModelIdentifier downloaded;
+        modelResult = this->dataPtr->DownloadModel(*this, this->dataPtr->rest,
+            target, headers, dependencies, _priority, &downloaded);
+        if (modelResult)
+          id.SHA_256(downloaded.SHA_256());
+      }
 
       {
         std::lock_guard<std::mutex> lock(resultMutex);
         result.push_back(std::make_tuple(id, modelResult));
       }
 
+      std::lock_guard<std::mutex> lock(idsMutex);
       if (!dependencies.empty())
       {
-        std::lock_guard<std::mutex> lock(idsMutex);
         gzdbg << "Adding " << dependencies.size()
           << " model dependencies to queue from " << id.Name() << "\n";
         for (const auto &dep : dependencies)
@@ -960,9 +1547,24 @@ std::vector<FuelClient::ModelResult> FuelClient::DownloadModels(
           }
         }
       }
+      --inProgress;
     }
   };
 
+  // A number of jobs of zero enables the automatic concurrency mode, where
+  // the scheduler decides how many of the workers may transfer at once.
+  // Otherwise some of the jobs are left to interactive transfers.
+  const bool adaptive = _jobs == 0;
+  if (adaptive)
+  {
+    _jobs = kMaxDownloadJobs;
+    this->dataPtr->scheduler.EnableAdaptive(_jobs);
+  }
+  else
+  {
+    this->dataPtr->scheduler.EnableFixed(_jobs);
+  }
+
   std::vector<std::thread> workers;
 
   for (size_t ii = 0; ii < _jobs; ++ii)
@@ -970,102 +1572,738 @@ std::vector<FuelClient::ModelResult> FuelClient::DownloadModels(
     workers.push_back(std::thread(downloadWorker));
   }
 
-  gzmsg << "Preparing to download "
-    << idsToDownload.size() << " models with "
-    << _jobs << " worker threads\n";
-
+  if (adaptive)
+  {
+    gzmsg << "Preparing to download "
+      << _ids.size() << " models with automatic concurrency (up to "
+      << _jobs << " parallel transfers)\n";
+  }
+  else
+  {
+    gzmsg << "Preparing to download "
+      << _ids.size() << " models with "
+      << _jobs << " worker threads\n";
+  }
 
   while (running)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
-    if(idsToDownload.empty())
+    std::lock_guard<std::mutex> lock(idsMutex);
+
+    // Drop the models that haven't started, the ones in flight are aborted.
+    if (this->Cancellation().Cancelled())
+      idsToDownload.clear();
+
+    if (idsToDownload.empty() && inProgress == 0)
+    {
+      running = false;
+    }
+  }
+
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  if (adaptive)
+    this->dataPtr->scheduler.DisableAdaptive();
+  else
+    this->dataPtr->scheduler.DisableFixed(_jobs);
+
+  if (this->Cancellation().Cancelled())
+  {
+    gzmsg << "Cancelled, processed " << result.size() << " models\n";
+    return result;
+  }
+
+  std::size_t cached = std::count_if(result.begin(), result.end(),
+      [](const ModelResult &_result)
+      {
+        return std::get<1>(_result).Type() ==
+          ResultType::FETCH_ALREADY_EXISTS;
+      });
+  gzmsg << "Finished, downloaded " << result.size() - cached
+        << " models in total, " << cached << " already cached\n";
+
+  return result;
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::DownloadWorlds(
+    const std::vector<WorldIdentifier> &_ids, size_t _jobs,
+    DownloadPriority _priority)
+{
+  std::deque<std::future<gz::fuel_tools::Result>> tasks;
+  // Check for finished tasks by checking if the status of their futures is
+  // "ready". If a task is finished, check if it succeeded and print out an
+  // error message if it failed. When a task is finished, it gets erased from
+  // the tasks list to make room for other tasks to be added.
+  size_t itemCount = 0;
+  const size_t totalItemCount = _ids.size();
+
+  // A number of jobs of zero enables the automatic concurrency mode, where
+  // the scheduler decides how many of the tasks may transfer at once.
+  // Otherwise some of the jobs are left to interactive transfers.
+  const bool adaptive = _jobs == 0;
+  if (adaptive)
+  {
+    _jobs = kMaxDownloadJobs;
+    this->dataPtr->scheduler.EnableAdaptive(_jobs);
+    gzmsg << "Using automatic concurrency (up to " << _jobs
+           << " parallel transfers) to download collection of "
+           << totalItemCount << " items" << std::endl;
+  }
+  else
+  {
+    this->dataPtr->scheduler.EnableFixed(_jobs);
+    gzmsg << "Using " << _jobs << " jobs to download collection of "
+           << totalItemCount << " items" << std::endl;
+  }
+
+  auto checkForFinishedTasks = [&itemCount, &totalItemCount, &tasks] {
+    auto finishedIt =
+        std::partition(tasks.begin(), tasks.end(), [](const auto &_task)
+            {
+              return std::future_status::ready !=
+              _task.wait_for(std::chrono::milliseconds(100));
+            });
+
+    if (finishedIt != tasks.end())
+    {
+      for (auto taskIt = finishedIt; taskIt != tasks.end(); ++taskIt)
+      {
+        gz::fuel_tools::Result result = taskIt->get();
+        if (result)
+        {
+          ++itemCount;
+        }
+        else if (result.Type() != ResultType::CANCELLED)
+        {
+          gzerr << result.ReadableResult() << std::endl;
+        }
+      }
+
+      tasks.erase(finishedIt, tasks.end());
+      gzmsg << "Downloaded: " << itemCount << " / " << totalItemCount
+             << std::endl;
+    }
+  };
+
+  // Start the largest worlds first, see largestFirst.
+  std::vector<std::uint64_t> sizes;
+  sizes.reserve(_ids.size());
+  for (const auto &id : _ids)
+    sizes.push_back(id.FileSize());
+
+  // We need a mutable worldId because DownloadWorld modifies it
+  for (auto index : largestFirst(sizes))
+  {
+    const auto &id = _ids[index];
+    while (tasks.size() >= _jobs)
+    {
+      checkForFinishedTasks();
+    }
+
+    // Don't start new downloads, the ones in flight are aborted.
+    if (this->Cancellation().Cancelled())
+      break;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto handle = std::async(std::launch::async, [&id, _priority, this]
+        {
+          WorldIdentifier tempId = id;
+          return this->DownloadWorld(tempId, {}, _priority);
+        });
+    tasks.push_back(std::move(handle));
+  }
+
+  while (!tasks.empty())
+  {
+    checkForFinishedTasks();
+  }
+
+  if (adaptive)
+    this->dataPtr->scheduler.DisableAdaptive();
+  else
+    this->dataPtr->scheduler.DisableFixed(_jobs);
+
+  if (this->Cancellation().Cancelled())
+    return Result(ResultType::CANCELLED);
+
+  return Result(ResultType::FETCH);
+}
+
+//////////////////////////////////////////////////
+Result FuelClientPrivate::PipelinedDownload(FuelClient &_client,
+    ModelIter _models, WorldIter _worlds, std::size_t _jobs,
+    DownloadPriority _priority, CacheCheck _cacheCheck,
+    BulkDownloadStats *_stats, const std::string &_batch)
+{
+  const auto startTime = std::chrono::steady_clock::now();
+  const std::uint64_t startBytes = this->scheduler.Stats().bytes;
+
+  std::shared_ptr<DownloadJournal> journal;
+  if (!_batch.empty())
+  {
+    journal = std::make_shared<DownloadJournal>(
+        common::joinPaths(this->config.CacheLocation(), ".downloads"),
+        _batch);
+    if (journal->PlannedCount() > 0)
+    {
+      gzmsg << "Resuming [" << _batch << "], " << journal->CompletedCount()
+             << " of " << journal->PlannedCount() << " resources were "
+             << "downloaded, " << journal->InFlight().size()
+             << " were in flight" << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(this->journalMutex);
+    if (!this->journal)
+      this->journal = journal;
+  }
+
+  std::mutex mutex;
+  std::condition_variable queueCv;
+  std::deque<ModelIdentifier> modelQueue;
+  std::deque<WorldIdentifier> worldQueue;
+  // Unique names of the resources queued so far, a resource may be listed
+  // more than once or be a dependency of another one.
+  std::unordered_set<std::string> queued;
+  bool listing = true;
+  std::size_t inProgress = 0;
+  std::size_t downloaded = 0;
+  std::size_t skipped = 0;
+  std::size_t failed = 0;
+
+  // Queue a model unless it was seen before or downloaded by an earlier run
+  // of the batch, the mutex must be held. Workers check the cache.
+  std::function<void(const ModelIdentifier &)> queueModel =
+    [&](const ModelIdentifier &_id)
+  {
+    if (!queued.insert("model:" + _id.UniqueName()).second)
+      return;
+    if (journal && journal->Completed(journalItem(_id)) &&
+        this->cache->HasModel(_id))
+    {
+      // Downloaded by an earlier run, which may not have downloaded its
+      // dependencies yet.
+      ++skipped;
+      std::vector<ModelIdentifier> dependencies;
+      _client.ModelDependencies(_id, dependencies);
+      for (const auto &dep : dependencies)
+        queueModel(dep);
+      return;
+    }
+    if (journal)
+      journal->Plan(journalItem(_id));
+    modelQueue.push_back(_id);
+    queueCv.notify_one();
+  };
+
+  auto downloadWorker = [&]()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      // Wake up regularly to notice cancellations.
+      queueCv.wait_for(lock, std::chrono::milliseconds(100), [&]
+          {
+            return !modelQueue.empty() || !worldQueue.empty() ||
+                   (!listing && inProgress == 0) ||
+                   _client.Cancellation().Cancelled();
+          });
+
+      // Don't start new downloads, the ones in flight are aborted.
+      if (_client.Cancellation().Cancelled())
+        break;
+
+      if (modelQueue.empty() && worldQueue.empty())
+      {
+        if (!listing && inProgress == 0)
+          break;
+        continue;
+      }
+
+      ++inProgress;
+      Result result;
+      std::vector<ModelIdentifier> dependencies;
+      std::string item;
+      bool cached = false;
+      if (!modelQueue.empty())
+      {
+        ModelIdentifier id = modelQueue.front();
+        modelQueue.pop_front();
+        lock.unlock();
+        item = journalItem(id);
+        // The dependencies of a cached model are read from the cache, so
+        // that the ones shared by many models are checked as well.
+        cached = this->SatisfiedByCache(_client, id, _cacheCheck);
+        if (cached)
+        {
+          result = _client.ModelDependencies(id, dependencies);
+        }
+        else
+        {
+          if (journal)
+            journal->Start(item);
+          result = _client.DownloadModel(id, {}, dependencies, _priority);
+        }
+      }
+      else
+      {
+        WorldIdentifier id = worldQueue.front();
+        worldQueue.pop_front();
+        lock.unlock();
+        item = journalItem(id);
+        cached = this->SatisfiedByCache(_client, id, _cacheCheck);
+        if (cached)
+        {
+          result = Result(ResultType::FETCH_ALREADY_EXISTS);
+        }
+        else
+        {
+          if (journal)
+            journal->Start(item);
+          result = _client.DownloadWorld(id, {}, _priority);
+        }
+      }
+      if (result && journal)
+        journal->Complete(item);
+      lock.lock();
+
+      if (cached)
+        ++skipped;
+      else if (result)
+        ++downloaded;
+      else if (result.Type() != ResultType::CANCELLED)
+        ++failed;
+
+      for (const auto &dep : dependencies)
+        queueModel(dep);
+      --inProgress;
+
+      gzmsg << "Downloaded: " << downloaded << " / "
+             << queued.size() - skipped
+             << (listing ? " (listing)" : "") << std::endl;
+      queueCv.notify_all();
+    }
+  };
+
+  // A number of jobs of zero enables the automatic concurrency mode, where
+  // the scheduler decides how many of the workers may transfer at once.
+  // Otherwise some of the jobs are left to interactive transfers.
+  const bool adaptive = _jobs == 0;
+  if (adaptive)
+  {
+    _jobs = kMaxDownloadJobs;
+    this->scheduler.EnableAdaptive(_jobs);
+  }
+  else
+  {
+    this->scheduler.EnableFixed(_jobs);
+  }
+
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < _jobs; ++i)
+    workers.push_back(std::thread(downloadWorker));
+
+  // Each increment of an iterator may request the next page, the items of
+  // the pages received so far are already downloading meanwhile.
+  for (; _models && !_client.Cancellation().Cancelled(); ++_models)
+  {
+    ModelIdentifier id = _models->Identification();
+    std::lock_guard<std::mutex> lock(mutex);
+    queueModel(id);
+  }
+  for (; _worlds && !_client.Cancellation().Cancelled(); ++_worlds)
+  {
+    WorldIdentifier id = *_worlds;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!queued.insert("world:" + id.UniqueName()).second)
+      continue;
+    if (journal && journal->Completed(journalItem(id)) &&
+        this->cache->HasWorld(id))
+    {
+      ++skipped;
+      continue;
+    }
+    if (journal)
+      journal->Plan(journalItem(id));
+    worldQueue.push_back(id);
+    queueCv.notify_one();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    listing = false;
+    gzmsg << "Listed " << queued.size() << " resources" << std::endl;
+  }
+  queueCv.notify_all();
+
+  for (auto &worker : workers)
+    worker.join();
+
+  if (adaptive)
+    this->scheduler.DisableAdaptive();
+  else
+    this->scheduler.DisableFixed(_jobs);
+
+  if (journal)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->journalMutex);
+      if (this->journal == journal)
+        this->journal.reset();
+    }
+
+    // The next run downloads what failed or was cancelled.
+    if (failed == 0 && !_client.Cancellation().Cancelled())
+    {
+      journal->Finish();
+    }
+    else
+    {
+      gzmsg << "Run the download again to resume it, " << skipped +
+             downloaded << " of " << queued.size() << " resources are "
+             << "done" << std::endl;
+    }
+  }
+
+  if (_stats)
+  {
+    _stats->listed = queued.size();
+    _stats->downloaded = downloaded;
+    _stats->skipped = skipped;
+    _stats->failed = failed;
+    _stats->bytes = this->scheduler.Stats().bytes - startBytes;
+    _stats->elapsed = std::chrono::steady_clock::now() - startTime;
+  }
+
+  if (_client.Cancellation().Cancelled())
+    return Result(ResultType::CANCELLED);
+
+  if (queued.empty() || failed > 0)
+    return Result(ResultType::FETCH_ERROR);
+
+  return Result(ResultType::FETCH);
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::DownloadOwner(const ServerConfig &_server,
+    const std::string &_owner, BulkDownloadStats &_stats, std::size_t _jobs,
+    DownloadPriority _priority)
+{
+  _stats = BulkDownloadStats();
+  if (_owner.empty())
+    return Result(ResultType::FETCH_ERROR);
+
+  // Large pages, fewer round trips for the listing.
+  ResourceQuery query;
+  query.SetPerPage(100);
+
+  ModelIdentifier modelId;
+  modelId.SetServer(_server);
+  modelId.SetOwner(_owner);
+  WorldIdentifier worldId;
+  worldId.SetServer(_server);
+  worldId.SetOwner(_owner);
+
+  return this->dataPtr->PipelinedDownload(*this,
+      this->Models(modelId, query), this->Worlds(worldId, query), _jobs,
+      _priority, CacheCheck::PINNED, &_stats,
+      "owner:" + _server.Url().Str() + "/" + _owner);
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::DownloadCollection(const CollectionIdentifier &_id,
+    bool _models, bool _worlds, std::size_t _jobs,
+    DownloadPriority _priority, CacheCheck _cacheCheck)
+{
+  return this->dataPtr->PipelinedDownload(*this,
+      _models ? this->Models(_id) : ModelIterFactory::Create(),
+      _worlds ? this->Worlds(_id) : WorldIterFactory::Create(),
+      _jobs, _priority, _cacheCheck, nullptr,
+      "collection:" + _id.UniqueName() + (_models ? ":models" : "") +
+      (_worlds ? ":worlds" : ""));
+}
+
+//////////////////////////////////////////////////
+bool FuelClient::RecordUsage(const common::URI &_url)
+{
+  // Record the resource holding a file, so that it's prefetched whole.
+  std::string url = _url.Str();
+  ModelIdentifier model;
+  WorldIdentifier world;
+  std::string filePath;
+  if (this->ParseModelFileUrl(_url, model, filePath))
+    url = url.substr(0, url.find("/files", url.find("/models/") + 8));
+  else if (this->ParseWorldFileUrl(_url, world, filePath))
+    url = url.substr(0, url.find("/files", url.find("/worlds/") + 8));
+  else if (!this->ParseModelUrl(_url, model) &&
+           !this->ParseWorldUrl(_url, world))
+  {
+    return false;
+  }
+
+  // Uses by this process rank the resources to revalidate, tagged or not.
+  this->dataPtr->revalidation.Hit(url);
+
+  const std::string tag = this->dataPtr->config.UsageTag();
+  if (tag.empty())
+    return false;
+  return this->dataPtr->usageHistory->Record(tag, url);
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> FuelClient::UsedResources(
+    const std::string &_tag) const
+{
+  return this->dataPtr->usageHistory->Resources(_tag);
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::Prefetch(const std::string &_tag,
+    BulkDownloadStats &_stats, std::size_t _jobs, DownloadPriority _priority)
+{
+  _stats = BulkDownloadStats();
+
+  std::vector<ModelIdentifier> models;
+  std::vector<WorldIdentifier> worlds;
+  for (const auto &url : this->UsedResources(_tag))
+  {
+    ModelIdentifier model;
+    WorldIdentifier world;
+    if (this->ParseModelUrl(common::URI(url), model))
+      models.push_back(model);
+    else if (this->ParseWorldUrl(common::URI(url), world))
+      worlds.push_back(world);
+    else
+      gzwarn << "Skipping unknown resource [" << url << "]" << std::endl;
+  }
+
+  if (models.empty() && worlds.empty())
+  {
+    gzerr << "No resources recorded under usage tag [" << _tag << "]"
+          << std::endl;
+    return Result(ResultType::FETCH_ERROR);
+  }
+
+  return this->dataPtr->PipelinedDownload(*this,
+      ModelIterFactory::Create(models), WorldIterFactory::Create(worlds),
+      _jobs, _priority, CacheCheck::PINNED, &_stats, "prefetch:" + _tag);
+}
+
+//////////////////////////////////////////////////
+Result FuelClientPrivate::Revalidate(FuelClient &_client,
+    const ClientConfig &_config, const Rest &_rest, BulkDownloadStats &_stats,
+    std::size_t _max)
+{
+  _stats = BulkDownloadStats();
+  const auto startTime = std::chrono::steady_clock::now();
+  const std::uint64_t startBytes = this->scheduler.Stats().bytes;
+
+  // Sessions recorded under any tag count.
+  std::map<std::string, std::size_t> recorded;
+  for (const auto &tag : this->usageHistory->Tags())
+  {
+    for (const auto &[url, count] : this->usageHistory->Counts(tag))
+      recorded[url] += count;
+  }
+
+  auto &queue = this->revalidation;
+  Result result(ResultType::FETCH);
+  for (const auto &url : queue.Due(recorded,
+         _config.RevalidationInterval(),
+         std::numeric_limits<std::size_t>::max()))
+  {
+    if (_stats.listed >= _max)
+      break;
+
+    if (_client.Cancellation().Cancelled() ||
+        _rest.Cancellation().Cancelled())
+    {
+      result = Result(ResultType::CANCELLED);
+      break;
+    }
+
+    // Only the tip of cached resources can be stale. The others don't
+    // count towards _max.
+    ModelIdentifier model;
+    WorldIdentifier world;
+    std::string owner;
+    std::string type;
+    std::string name;
+    ServerConfig server;
+    unsigned int cachedVersion = 0;
+    if (this->ParseModelUrl(common::URI(url), model, _config.Servers()))
+    {
+      auto cached = this->cache->MatchingModel(model);
+      if (model.Version() == 0 && cached)
+        cachedVersion = cached.Identification().Version();
+      owner = model.Owner();
+      type = "models";
+      name = model.Name();
+      server = model.Server();
+    }
+    else if (this->ParseWorldUrl(common::URI(url), world, _config.Servers()))
+    {
+      WorldIdentifier cached = world;
+      if (world.Version() == 0 && this->cache->MatchingWorld(cached))
+        cachedVersion = cached.Version();
+      owner = world.Owner();
+      type = "worlds";
+      name = world.Name();
+      server = world.Server();
+    }
+    if (cachedVersion == 0)
+    {
+      queue.Checked(url, "");
+      continue;
+    }
+    ++_stats.listed;
+
+    // Ask for the details, unless they didn't change since the last check.
+    std::vector<std::string> headers;
+    if (!server.ApiKey().empty())
+      headers.push_back("Private-token: " + server.ApiKey());
+    std::vector<std::string> detailsHeaders = headers;
+    const std::string etag = queue.ETag(url);
+    if (!etag.empty())
+      detailsHeaders.push_back("If-None-Match: " + etag);
+
+    common::URIPath path;
+    path = path / owner / type / name;
+    RestResponse resp = _rest.Request(HttpMethod::GET, server.Url().Str(),
+        server.Version(), path.Str(), {}, detailsHeaders, "");
+    if (resp.statusCode == 304)
+    {
+      ++_stats.skipped;
+      queue.Checked(url, etag);
+      continue;
+    }
+    if (resp.statusCode != 200)
+    {
+      gzwarn << "Failed to revalidate [" << url << "], REST response code "
+             << resp.statusCode << std::endl;
+      ++_stats.failed;
+      result = Result(ResultType::FETCH_ERROR);
+      queue.Checked(url, etag);
+      continue;
+    }
+
+    Result download(ResultType::FETCH_ALREADY_EXISTS);
+    if (type == "models")
+    {
+      ModelIdentifier cloudId = JSONParser::ParseModel(resp.data, server);
+      if (cloudId.Version() > cachedVersion)
+      {
+        gzmsg << "Updating model " << owner << "/" << name
+              << " up to version " << cloudId.Version() << std::endl;
+        std::vector<ModelIdentifier> dependencies;
+        download = this->DownloadModel(_client, _rest, cloudId, headers,
+            dependencies, DownloadPriority::BACKGROUND);
+      }
+    }
+    else
+    {
+      WorldIdentifier cloudId = JSONParser::ParseWorld(resp.data, server);
+      if (cloudId.Version() > cachedVersion)
+      {
+        gzmsg << "Updating world " << owner << "/" << name
+              << " up to version " << cloudId.Version() << std::endl;
+        download = this->DownloadWorld(_rest, cloudId, headers,
+            DownloadPriority::BACKGROUND);
+      }
+    }
+
+    if (download.Type() == ResultType::FETCH_ALREADY_EXISTS)
     {
-      running = false;
+      ++_stats.skipped;
     }
+    else if (download)
+    {
+      ++_stats.downloaded;
+    }
+    else
+    {
+      ++_stats.failed;
+      if (download.Type() == ResultType::CANCELLED)
+      {
+        result = download;
+        break;
+      }
+      result = Result(ResultType::FETCH_ERROR);
+      // Keep the previous entity tag, so that the update is retried.
+      queue.Checked(url, etag);
+      continue;
+    }
+    queue.Checked(url, std::string(resp.headers.ETag()));
   }
 
-  for (auto& worker : workers)
-  {
-    worker.join();
-  }
-
-  gzmsg << "Finished, downloaded " << result.size() << " models in total\n";
-
+  _stats.bytes = this->scheduler.Stats().bytes - startBytes;
+  _stats.elapsed = std::chrono::steady_clock::now() - startTime;
   return result;
 }
 
 //////////////////////////////////////////////////
-Result FuelClient::DownloadWorlds(
-    const std::vector<WorldIdentifier> &_ids, size_t _jobs)
+Result FuelClient::Revalidate(BulkDownloadStats &_stats, std::size_t _max)
 {
-  std::deque<std::future<gz::fuel_tools::Result>> tasks;
-  // Check for finished tasks by checking if the status of their futures is
-  // "ready". If a task is finished, check if it succeeded and print out an
-  // error message if it failed. When a task is finished, it gets erased from
-  // the tasks list to make room for other tasks to be added.
-  size_t itemCount = 0;
-  const size_t totalItemCount = _ids.size();
-
-  gzmsg << "Using " << _jobs << " jobs to download collection of "
-         << totalItemCount << " items" << std::endl;
-
-  auto checkForFinishedTasks = [&itemCount, &totalItemCount, &tasks] {
-    auto finishedIt =
-        std::partition(tasks.begin(), tasks.end(), [](const auto &_task)
-            {
-              return std::future_status::ready !=
-              _task.wait_for(std::chrono::milliseconds(100));
-            });
+  return this->dataPtr->Revalidate(*this, this->dataPtr->config,
+      this->dataPtr->rest, _stats, _max);
+}
 
-    if (finishedIt != tasks.end())
+//////////////////////////////////////////////////
+void FuelClientPrivate::RevalidationLoop(FuelClient &_client,
+    ClientConfig _config, Rest _rest)
+{
+  auto next = std::chrono::steady_clock::now() + kRevalidationQuiet;
+  std::unique_lock<std::mutex> lock(this->revalidationMutex);
+  while (!this->revalidationCv.wait_until(lock, next,
+           [this] {return this->stopRevalidation.load();}))
+  {
+    // Wait until nobody is waiting for a transfer.
+    auto idle = this->scheduler.IdleTime();
+    if (idle < kRevalidationQuiet)
     {
-      for (auto taskIt = finishedIt; taskIt != tasks.end(); ++taskIt)
-      {
-        gz::fuel_tools::Result result = taskIt->get();
-        if (result)
-        {
-          ++itemCount;
-        }
-        else
-        {
-          gzerr << result.ReadableResult() << std::endl;
-        }
-      }
-
-      tasks.erase(finishedIt, tasks.end());
-      gzmsg << "Downloaded: " << itemCount << " / " << totalItemCount
-             << std::endl;
+      next = std::chrono::steady_clock::now() + kRevalidationQuiet - idle;
+      continue;
     }
-  };
 
-  // We need a mutable worldId because DownloadWorld modifies it
-  for (auto& id : _ids)
-  {
-    while (tasks.size() >= _jobs)
+    lock.unlock();
+    BulkDownloadStats stats;
+    this->Revalidate(_client, _config, _rest, stats, kRevalidationBatch);
+    if (stats.listed > 0)
     {
-      checkForFinishedTasks();
+      gzdbg << "Revalidated " << stats.listed << " resources: "
+            << stats.downloaded << " updated, " << stats.skipped
+            << " up to date, " << stats.failed << " failed" << std::endl;
     }
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    auto handle = std::async(std::launch::async, [&id, this]
-        {
-          WorldIdentifier tempId = id;
-          return this->DownloadWorld(tempId);
-        });
-    tasks.push_back(std::move(handle));
-  }
+    lock.lock();
 
-  while (!tasks.empty())
-  {
-    checkForFinishedTasks();
+    // A full batch may have left due resources behind.
+    next = std::chrono::steady_clock::now() +
+      (stats.listed >= kRevalidationBatch ?
+        std::chrono::steady_clock::duration(kRevalidationQuiet) :
+        std::chrono::steady_clock::duration(_config.RevalidationInterval()));
   }
+}
 
-  return Result(ResultType::FETCH);
+//////////////////////////////////////////////////
+DownloadStats FuelClient::DownloadStatistics() const
+{
+  return this->dataPtr->scheduler.Stats();
 }
 
 //////////////////////////////////////////////////
-bool FuelClient::ParseModelUrl(const common::URI &_modelUrl,
-    ModelIdentifier &_id)
+MemoryCacheStats FuelClient::MemoryCacheStatistics() const
+{
+  return this->dataPtr->memoryCache.Stats();
+}
+
+//////////////////////////////////////////////////
+bool FuelClientPrivate::ParseModelUrl(const common::URI &_modelUrl,
+    ModelIdentifier &_id,
+    const std::vector<ServerConfig> &_servers) const
 {
   if (!_modelUrl.Valid())
     return false;
@@ -1080,7 +2318,7 @@ bool FuelClient::ParseModelUrl(const common::URI &_modelUrl,
   std::string modelName;
   std::string modelVersion;
 
-  if (std::regex_match(urlStr, match, *this->dataPtr->urlModelRegex) &&
+  if (std::regex_match(urlStr, match, *this->urlModelRegex) &&
       match.size() >= 5u)
   {
     unsigned int i{1};
@@ -1104,7 +2342,7 @@ bool FuelClient::ParseModelUrl(const common::URI &_modelUrl,
 
   _id.Server().SetUrl(serverUri);
   _id.Server().SetVersion(apiVersion);
-  for (const auto &s : this->dataPtr->config.Servers())
+  for (const auto &s : _servers)
   {
     // cppcheck-suppress useStlAlgorithm
     if (s.Url().Str() == _id.Server().Url().Str()) {
@@ -1134,8 +2372,17 @@ bool FuelClient::ParseModelUrl(const common::URI &_modelUrl,
 }
 
 //////////////////////////////////////////////////
-bool FuelClient::ParseWorldUrl(const common::URI &_worldUrl,
-    WorldIdentifier &_id)
+bool FuelClient::ParseModelUrl(const common::URI &_modelUrl,
+    ModelIdentifier &_id)
+{
+  return this->dataPtr->ParseModelUrl(_modelUrl, _id,
+      this->dataPtr->config.Servers());
+}
+
+//////////////////////////////////////////////////
+bool FuelClientPrivate::ParseWorldUrl(const common::URI &_worldUrl,
+    WorldIdentifier &_id,
+    const std::vector<ServerConfig> &_servers) const
 {
   if (!_worldUrl.Valid())
     return false;
@@ -1150,7 +2397,7 @@ bool FuelClient::ParseWorldUrl(const common::URI &_worldUrl,
   std::string worldName;
   std::string worldVersion;
 
-  if (std::regex_match(urlStr, match, *this->dataPtr->urlWorldRegex) &&
+  if (std::regex_match(urlStr, match, *this->urlWorldRegex) &&
       match.size() >= 5u)
   {
     unsigned int i{1};
@@ -1174,7 +2421,7 @@ bool FuelClient::ParseWorldUrl(const common::URI &_worldUrl,
 
   _id.Server().SetUrl(serverUri);
   _id.Server().SetVersion(apiVersion);
-  for (const auto &s : this->dataPtr->config.Servers())
+  for (const auto &s : _servers)
   {
     // cppcheck-suppress useStlAlgorithm
     if (s.Url() == _id.Server().Url()) {
@@ -1203,6 +2450,14 @@ bool FuelClient::ParseWorldUrl(const common::URI &_worldUrl,
   return true;
 }
 
+//////////////////////////////////////////////////
+bool FuelClient::ParseWorldUrl(const common::URI &_worldUrl,
+    WorldIdentifier &_id)
+{
+  return this->dataPtr->ParseWorldUrl(_worldUrl, _id,
+      this->dataPtr->config.Servers());
+}
+
 //////////////////////////////////////////////////
 bool FuelClient::ParseModelFileUrl(const common::URI &_modelFileUrl,
     ModelIdentifier &_id, std::string &_filePath)
@@ -1609,6 +2864,224 @@ Result FuelClient::CachedWorldFile(const common::URI &_fileUrl,
   return Result(ResultType::FETCH_ERROR);
 }
 
+//////////////////////////////////////////////////
+Result FuelClient::CachedModelFileView(const common::URI &_fileUrl,
+  FileView &_view)
+{
+  // Files of a given version don't change, so they are looked up in memory
+  // before touching the filesystem. Tip versions need the cache to be
+  // searched first.
+  std::string key;
+  if (this->dataPtr->memoryCache.Budget() > 0)
+  {
+    ModelIdentifier id;
+    std::string filePath;
+    if (this->ParseModelFileUrl(_fileUrl, id, filePath) && id.Version() != 0)
+    {
+      key = MemoryCacheKey(id.UniqueName(), id.VersionStr(), filePath);
+      _view = this->dataPtr->memoryCache.Get(key);
+      if (_view)
+        return Result(ResultType::FETCH_ALREADY_EXISTS);
+    }
+  }
+
+  std::string path;
+  Result result = this->CachedModelFile(_fileUrl, path);
+  if (result.Type() != ResultType::FETCH_ALREADY_EXISTS)
+    return result;
+
+  if (this->dataPtr->memoryCache.Budget() == 0)
+  {
+    _view = FileView(path);
+  }
+  else
+  {
+    // Pinned versions already missed above.
+    if (key.empty())
+    {
+      key = path;
+      _view = this->dataPtr->memoryCache.Get(key);
+    }
+    if (!_view)
+    {
+      _view = FileView::Load(path);
+      this->dataPtr->memoryCache.Put(key, _view);
+    }
+  }
+
+  if (!_view)
+    return Result(ResultType::FETCH_ERROR);
+  return result;
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::CachedWorldFileView(const common::URI &_fileUrl,
+  FileView &_view)
+{
+  // Files of a given version don't change, so they are looked up in memory
+  // before touching the filesystem. Tip versions need the cache to be
+  // searched first.
+  std::string key;
+  if (this->dataPtr->memoryCache.Budget() > 0)
+  {
+    WorldIdentifier id;
+    std::string filePath;
+    if (this->ParseWorldFileUrl(_fileUrl, id, filePath) && id.Version() != 0)
+    {
+      key = MemoryCacheKey(id.UniqueName(), id.VersionStr(), filePath);
+      _view = this->dataPtr->memoryCache.Get(key);
+      if (_view)
+        return Result(ResultType::FETCH_ALREADY_EXISTS);
+    }
+  }
+
+  std::string path;
+  Result result = this->CachedWorldFile(_fileUrl, path);
+  if (result.Type() != ResultType::FETCH_ALREADY_EXISTS)
+    return result;
+
+  if (this->dataPtr->memoryCache.Budget() == 0)
+  {
+    _view = FileView(path);
+  }
+  else
+  {
+    // Pinned versions already missed above.
+    if (key.empty())
+    {
+      key = path;
+      _view = this->dataPtr->memoryCache.Get(key);
+    }
+    if (!_view)
+    {
+      _view = FileView::Load(path);
+      this->dataPtr->memoryCache.Put(key, _view);
+    }
+  }
+
+  if (!_view)
+    return Result(ResultType::FETCH_ERROR);
+  return result;
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::CachedModelManifest(const common::URI &_modelUrl,
+  std::map<std::string, std::string> &_hashes)
+{
+  ModelIdentifier id;
+  if (!this->ParseModelUrl(_modelUrl, id) ||
+      !this->dataPtr->cache->ModelManifest(id, _hashes))
+  {
+    return Result(ResultType::FETCH_ERROR);
+  }
+  return Result(ResultType::FETCH_ALREADY_EXISTS);
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::CachedWorldManifest(const common::URI &_worldUrl,
+  std::map<std::string, std::string> &_hashes)
+{
+  WorldIdentifier id;
+  if (!this->ParseWorldUrl(_worldUrl, id) ||
+      !this->dataPtr->cache->WorldManifest(id, _hashes))
+  {
+    return Result(ResultType::FETCH_ERROR);
+  }
+  return Result(ResultType::FETCH_ALREADY_EXISTS);
+}
+
+//////////////////////////////////////////////////
+std::string FuelClientPrivate::SearchIndexPath(
+    const ServerConfig &_server) const
+{
+  return common::joinPaths(this->config.CacheLocation(),
+      uriToPath(_server.Url()), ".search_index");
+}
+
+//////////////////////////////////////////////////
+Result FuelClient::UpdateSearchIndex(const ServerConfig &_server)
+{
+  const std::string path = this->dataPtr->SearchIndexPath(_server);
+  auto index = std::make_shared<SearchIndex>();
+  const bool incremental = index->Load(path) && index->Size() > 0;
+
+  // An existing index only needs the models changed since it was built,
+  // which come first when sorted by modification date.
+  ResourceQuery query;
+  if (incremental)
+    query.SetSort("updatedAt", ResourceQuery::SortOrder::DESCENDING);
+
+  // Unlike Models(_server), the listing doesn't fall back to the cached
+  // models, which would drop the others from the index.
+  std::vector<ModelIdentifier> models;
+  IterRestIds iter(this->dataPtr->rest, _server, "models", query);
+  for (; !iter.HasReachedEnd(); iter.Next())
+  {
+    if (incremental && index->Current(iter.model.Identification()))
+      break;
+    models.push_back(iter.model.Identification());
+  }
+
+  // A partial listing would drop the models of the missing pages, and an
+  // empty one is more likely a failed request than an empty server. Keep
+  // the previous index in both cases.
+  if (iter.failed || (!incremental && models.empty()))
+  {
+    gzerr << "Unable to list the models of [" << _server.Url().Str()
+          << "]" << std::endl;
+    return Result(ResultType::FETCH_ERROR);
+  }
+
+  const std::size_t changes = incremental ?
+    index->Merge(_server, models) : index->Update(_server, models);
+  if (changes == 0 && common::exists(path))
+    return Result(ResultType::FETCH_ALREADY_EXISTS);
+
+  if (!common::createDirectories(common::parentPath(path)) ||
+      !index->Save(path))
+  {
+    return Result(ResultType::FETCH_ERROR);
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->searchMutex);
+  this->dataPtr->searchIndexes[path] = index;
+  return Result(ResultType::FETCH);
+}
+
+//////////////////////////////////////////////////
+std::vector<ModelIdentifier> FuelClient::SearchModels(
+    const std::string &_query, std::size_t _limit) const
+{
+  std::vector<ModelIdentifier> results;
+  for (const auto &server : this->dataPtr->config.Servers())
+  {
+    const std::string path = this->dataPtr->SearchIndexPath(server);
+    std::shared_ptr<SearchIndex> index;
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->searchMutex);
+      auto &loaded = this->dataPtr->searchIndexes[path];
+      if (!loaded)
+      {
+        loaded = std::make_shared<SearchIndex>();
+        loaded->Load(path);
+      }
+      index = loaded;
+    }
+
+    // The configured server carries the API version and key.
+    for (auto &id : index->Search(_query, _limit))
+    {
+      id.SetServer(server);
+      results.push_back(id);
+    }
+  }
+
+  // Servers are listed by preference, so results are kept grouped by server.
+  if (_limit > 0 && results.size() > _limit)
+    results.resize(_limit);
+  return results;
+}
+
 //////////////////////////////////////////////////
 Result FuelClient::PatchModel(
     const gz::fuel_tools::ModelIdentifier &_model,
@@ -1623,7 +3096,7 @@ Result FuelClient::PatchModel(
     const std::vector<std::string> &_headers,
     const std::string &_pathToModelDir)
 {
-  gz::fuel_tools::Rest rest;
+  Rest rest(this->dataPtr->rest);
   RestResponse resp;
 
   auto serverUrl = _model.Server().Url().Str();
@@ -1882,6 +3355,9 @@ bool FuelClient::UpdateModels(const std::vector<std::string> &_headers)
   // Attempt to update each model.
   for (const auto &id : toProcess)
   {
+    if (this->Cancellation().Cancelled())
+      return false;
+
     gz::fuel_tools::ModelIdentifier cloudId;
 
     if (!this->ModelDetails(id.second, cloudId, _headers))
@@ -1923,6 +3399,9 @@ bool FuelClient::UpdateWorlds(const std::vector<std::string> &_headers)
   // Attempt to update each world.
   for (const auto &id : toProcess)
   {
+    if (this->Cancellation().Cancelled())
+      return false;
+
     gz::fuel_tools::WorldIdentifier cloudId;
 
     if (!this->WorldDetails(id.second, cloudId, _headers))
@@ -1947,18 +3426,134 @@ bool FuelClient::UpdateWorlds(const std::vector<std::string> &_headers)
 }
 
 //////////////////////////////////////////////////
-void FuelClientPrivate::ZipFromResponse(const RestResponse &_resp,
-    std::string &_zip)
+bool FuelClientPrivate::DownloadArchive(const Rest &_rest,
+    const ServerConfig &_server, const std::string &_route,
+    const std::vector<std::string> &_headers, DownloadPriority _priority,
+    std::uint64_t _expectedBytes, RestResponse &_resp,
+    const std::function<bool(const std::string &_zip,
+      const std::string &_zipPath)> &_save)
+{
+  std::uint64_t reserved = this->scheduler.Acquire(_priority, _expectedBytes);
+  std::uint64_t spillThreshold = this->scheduler.SpillThreshold();
+  auto start = std::chrono::steady_clock::now();
+
+  // The transfers of a journaled batch stream large archives to a partial
+  // file, which the next run of the batch resumes from.
+  std::string spillPath = this->PartialPath(_server, _route);
+  const bool resumable = !spillPath.empty();
+  if (resumable)
+  {
+    spillThreshold = spillThreshold == 0 ? kResumableBytes :
+      std::min(spillThreshold, kResumableBytes);
+  }
+  else if (spillThreshold > 0)
+  {
+    spillPath = this->SpillPath();
+  }
+
+  std::string zip;
+  std::string zipPath;
+  bool resuming = resumable && common::exists(spillPath);
+  while (true)
+  {
+    if (spillThreshold == 0)
+    {
+      _resp = _rest.Request(HttpMethod::GET, _server.Url().Str(),
+          _server.Version(), _route, {"link=true"}, _headers, "");
+    }
+    else
+    {
+      // The API answers with a referral link, only the request for the
+      // archive itself is resumed.
+      _resp = _rest.Download(_server.Url().Str(), _server.Version(), _route,
+          {"link=true"}, _headers, spillPath, spillThreshold);
+    }
+
+    if (_resp.statusCode == 200)
+    {
+      this->ZipFromResponse(_resp, zip, zipPath, spillPath, spillThreshold,
+          resuming);
+    }
+
+    // A partial archive that can't be resumed, e.g. because it is complete
+    // already or the server rejects the range or sends another one, is
+    // downloaded again from the start.
+    if (!resuming || !zip.empty() || !zipPath.empty() ||
+        _rest.Cancellation().Cancelled())
+    {
+      break;
+    }
+    gzdbg << "Unable to resume [" << spillPath << "], downloading the "
+          << "whole archive" << std::endl;
+    common::removeFile(spillPath);
+    resuming = false;
+  }
+  auto latency = std::chrono::steady_clock::now() - start;
+
+  std::uint64_t bytes = zip.size();
+  if (!zipPath.empty())
+  {
+    std::ifstream file(zipPath, std::ios::binary | std::ios::ate);
+    bytes = std::max<std::streamoff>(file.tellg(), 0);
+  }
+
+  bool saved = (!zip.empty() || !zipPath.empty()) && _save(zip, zipPath);
+
+  // Remove whatever was streamed to disk and not moved into the cache,
+  // unless it is the partial archive of a cancelled transfer.
+  if (!spillPath.empty() && common::exists(spillPath) &&
+      (saved || !resumable || !_rest.Cancellation().Cancelled()))
+  {
+    common::removeFile(spillPath);
+  }
+
+  // Client errors, such as a missing resource, and cancelled transfers are
+  // not a sign of congestion.
+  bool success = _rest.Cancellation().Cancelled() ||
+    (_resp.statusCode == 200 ?
+     !zip.empty() || !zipPath.empty() :
+     _resp.statusCode >= 400 && _resp.statusCode < 500 &&
+     _resp.statusCode != 429);
+  this->scheduler.Release(_priority, reserved, bytes, latency, success);
+  return saved;
+}
+
+//////////////////////////////////////////////////
+std::string FuelClientPrivate::SpillPath()
+{
+  std::string dir = common::joinPaths(this->config.CacheLocation(),
+      ".downloads");
+  if (!common::isDirectory(dir))
+    common::createDirectories(dir);
+
+  return common::joinPaths(dir, "archive-" + uniqueCacheName() + ".zip");
+}
+
+//////////////////////////////////////////////////
+std::string FuelClientPrivate::PartialPath(const ServerConfig &_server,
+    const std::string &_route) const
+{
+  std::lock_guard<std::mutex> lock(this->journalMutex);
+  if (!this->journal)
+    return "";
+  return this->journal->PartialPath(
+      _server.Url().Str() + "/" + _server.Version() + "/" + _route);
+}
+
+//////////////////////////////////////////////////
+void FuelClientPrivate::ZipFromResponse(RestResponse &_resp,
+    std::string &_zip, std::string &_zipPath, const std::string &_spillPath,
+    std::uint64_t _spillThreshold, bool _resume)
 {
   // Check the content-type which could be empty (ideally not):
   //   * text/plain indicates the data is a download link.
   //   * application/zip indicates the data is a zip file.
   //   * binary/octet-stream indicates the data is a zip file.
-  auto contentTypeIter = _resp.headers.find("Content-Type");
-  if (contentTypeIter != _resp.headers.end())
+  const std::string contentType = _resp.headers.ContentType();
+  if (!contentType.empty())
   {
     // If text/plain then data might be a link to a zip file.
-    if (contentTypeIter->second.find("text/plain") != std::string::npos)
+    if (contentType == "text/plain")
     {
       std::string linkUri = _resp.data;
 
@@ -1967,21 +3562,45 @@ void FuelClientPrivate::ZipFromResponse(const RestResponse &_resp,
       {
         gzdbg << "Downloading from a referral link [" << linkUri << "]\n";
         // Get the zip data.
-        RestResponse linkResp = rest.Request(HttpMethod::GET,
-            // URL
-            linkUri,
-            // Version
-            "",
-            // Path
-            "",
-            // Query strings
-            {},
-            // Headers
-            {},
-            // Data
-            "");
-
-        return this->ZipFromResponse(linkResp, _zip);
+        RestResponse linkResp;
+        if (_spillThreshold == 0)
+        {
+          linkResp = rest.Request(HttpMethod::GET,
+              // URL
+              linkUri,
+              // Version
+              "",
+              // Path
+              "",
+              // Query strings
+              {},
+              // Headers
+              {},
+              // Data
+              "");
+        }
+        else
+        {
+          linkResp = rest.Download(linkUri, "", "", {}, {},
+              _spillPath, _spillThreshold, _resume);
+        }
+
+        // Anything but the archive, e.g. a rejected range, leaves _zip
+        // empty.
+        if (linkResp.statusCode == 200)
+        {
+          this->ZipFromResponse(linkResp, _zip, _zipPath, _spillPath,
+              _spillThreshold, false);
+        }
+        else if (!_resume || linkResp.statusCode != 416)
+        {
+          gzerr << "Unable to download from the referral link, REST "
+                << "response code " << linkResp.statusCode << ".\n";
+        }
+
+        // The archive is the body of the referred request.
+        _resp.sha256 = linkResp.sha256;
+        return;
       }
       else
       {
@@ -1989,23 +3608,31 @@ void FuelClientPrivate::ZipFromResponse(const RestResponse &_resp,
           << "Unable to download.\n";
       }
     }
-    else if (contentTypeIter->second.find("application/zip") !=
-             std::string::npos ||
-             contentTypeIter->second.find("binary/octet-stream") !=
-             std::string::npos)
+    else if (contentType == "application/zip" ||
+             contentType == "binary/octet-stream")
     {
-      _zip = std::move(_resp.data);
+      if (CompleteBody(_resp))
+      {
+        _zip = std::move(_resp.data);
+        _zipPath = _resp.dataPath;
+        return;
+      }
     }
     else
     {
-      gzerr << "Invalid content-type of [" << contentTypeIter->second << "]. "
+      gzerr << "Invalid content-type of [" << contentType << "]. "
         << "Unable to download.\n";
     }
   }
   else
   {
     // If content-type is missing, then assume the data is the zip file.
-    _zip = std::move(_resp.data);
+    if (CompleteBody(_resp))
+    {
+      _zip = std::move(_resp.data);
+      _zipPath = _resp.dataPath;
+      return;
+    }
   }
 }
 }  // namespace gz::fuel_tools
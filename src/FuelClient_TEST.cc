@@ -16,13 +16,34 @@
 */
 
 #include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/utils/ExtraTestMacros.hh>
 
 #include "gz/fuel_tools/FuelClient.hh"
 #include "gz/fuel_tools/ClientConfig.hh"
+#include "gz/fuel_tools/CollectionIdentifier.hh"
 #include "gz/fuel_tools/Helpers.hh"
 #include "gz/fuel_tools/Result.hh"
 #include "gz/fuel_tools/WorldIdentifier.hh"
@@ -122,6 +143,106 @@ void createLocalWorld(ClientConfig &_conf)
   _conf.AddServer(srv);
 }
 
+#ifndef _WIN32
+/////////////////////////////////////////////////
+/// \brief Server answering HTTP requests on the loopback interface, one
+/// request per connection, in place of a Fuel server.
+class LoopbackServer
+{
+  /// \brief Handler of a request.
+  /// \param[in] _target Request target, e.g. "/1.0/models?page=1".
+  /// \return Status, e.g. "200 OK", and body of the response.
+  public: using Handler = std::function<std::pair<std::string, std::string>(
+      const std::string &_target)>;
+
+  /// \brief Constructor.
+  /// \param[in] _handler Handler of the requests.
+  public: explicit LoopbackServer(Handler _handler)
+  {
+    this->fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (bind(this->fd, reinterpret_cast<sockaddr *>(&addr), len) != 0 ||
+        listen(this->fd, 8) != 0 ||
+        getsockname(this->fd, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+    {
+      return;
+    }
+    this->url = "http://127.0.0.1:" + std::to_string(ntohs(addr.sin_port));
+
+    this->thread = std::thread([this, _handler]
+    {
+      int client;
+      while ((client = accept(this->fd, nullptr, nullptr)) >= 0)
+      {
+        std::string request;
+        char buffer[4096];
+        while (request.find("\r\n\r\n") == std::string::npos)
+        {
+          ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+          if (n <= 0)
+            break;
+          request.append(buffer, n);
+        }
+
+        // Request line, e.g. "GET /1.0/models?page=1 HTTP/1.1".
+        const std::size_t start = request.find(' ') + 1;
+        const std::string target =
+          request.substr(start, request.find(' ', start) - start);
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->targets.push_back(target);
+        }
+
+        auto [status, body] = _handler(target);
+        const std::string response = "HTTP/1.1 " + status + "\r\n" +
+          "Content-Type: application/json\r\n" +
+          "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+          "Connection: close\r\n\r\n" + body;
+        // The client may have hung up, e.g. when it was cancelled.
+        send(client, response.data(), response.size(), MSG_NOSIGNAL);
+        close(client);
+      }
+    });
+  }
+
+  /// \brief Destructor.
+  public: ~LoopbackServer()
+  {
+    // Unblocks accept.
+    shutdown(this->fd, SHUT_RDWR);
+    if (this->thread.joinable())
+      this->thread.join();
+    close(this->fd);
+  }
+
+  /// \brief Get and forget the targets of the requests received so far.
+  /// \return Request targets, in order.
+  public: std::vector<std::string> TakeTargets()
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return std::move(this->targets);
+  }
+
+  /// \brief URL of the server, empty if it couldn't listen.
+  public: std::string url;
+
+  /// \brief Listening socket.
+  private: int fd = -1;
+
+  /// \brief Thread serving the requests.
+  private: std::thread thread;
+
+  /// \brief Protects targets.
+  private: std::mutex mutex;
+
+  /// \brief Targets of the requests received.
+  private: std::vector<std::string> targets;
+};
+#endif
+
 /////////////////////////////////////////////////
 class FuelClientTest: public ::testing::Test
 {
@@ -408,6 +529,192 @@ TEST_F(FuelClientTest, ParseModelFileURL)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, RecordUsage)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  config.SetUsageTag("");
+
+  const common::URI fileUrl{
+    "https://fuel.gazebosim.org/1.0/openroboticstest/models/backpack/"
+      "tip/files/model.sdf"};
+  const common::URI worldUrl{
+    "https://fuel.gazebosim.org/1.0/openroboticstest/worlds/empty"};
+
+  // Nothing is recorded without a usage tag
+  {
+    FuelClient client(config);
+    EXPECT_FALSE(client.RecordUsage(fileUrl));
+  }
+
+  config.SetUsageTag("my_world");
+  {
+    FuelClient client(config);
+    EXPECT_TRUE(client.RecordUsage(fileUrl));
+    EXPECT_TRUE(client.RecordUsage(worldUrl));
+    EXPECT_FALSE(client.RecordUsage(common::URI("http://bad.url")));
+  }
+
+  // A second session uses the backpack again
+  {
+    FuelClient client(config);
+    EXPECT_TRUE(client.RecordUsage(fileUrl));
+
+    auto resources = client.UsedResources("my_world");
+    ASSERT_EQ(2u, resources.size());
+    EXPECT_EQ("https://fuel.gazebosim.org/1.0/openroboticstest/models/"
+        "backpack/tip", resources[0]);
+    EXPECT_EQ(worldUrl.Str(), resources[1]);
+    EXPECT_TRUE(client.UsedResources("other").empty());
+
+    BulkDownloadStats stats;
+    EXPECT_EQ(ResultType::FETCH_ERROR,
+        client.Prefetch("other", stats).Type());
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, Revalidate)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  config.SetUsageTag("");
+  config.SetRevalidationInterval(std::chrono::hours(1));
+
+  auto start = std::chrono::steady_clock::now();
+  {
+    FuelClient client(config);
+
+    // Used but not cached, so there's nothing to revalidate.
+    EXPECT_FALSE(client.RecordUsage(common::URI(
+      "https://fuel.gazebosim.org/1.0/openroboticstest/models/backpack")));
+
+    BulkDownloadStats stats;
+    EXPECT_EQ(ResultType::FETCH, client.Revalidate(stats).Type());
+    EXPECT_EQ(0u, stats.listed);
+    EXPECT_EQ(0u, stats.downloaded);
+  }
+
+  // The background revalidation stops with the client.
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+      std::chrono::seconds(5));
+}
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, RevalidationStopsWithClient)
+{
+  // The details of the model announce a new version, whose archive is held
+  // back until the client is gone, or for 10 seconds.
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool archiveRequested = false;
+  bool released = false;
+  LoopbackServer server([&](const std::string &_target)
+      -> std::pair<std::string, std::string>
+  {
+    if (_target == "/1.0/alice/models/tree")
+    {
+      return {"200 OK", "{\"name\": \"tree\", \"owner\": \"alice\", "
+        "\"version\": 2}"};
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    archiveRequested = true;
+    cv.notify_all();
+    cv.wait_for(lock, std::chrono::seconds(10), [&] {return released;});
+    return {"404 Not Found", ""};
+  });
+  ASSERT_FALSE(server.url.empty());
+
+  ServerConfig local;
+  local.SetUrl(common::URI(server.url, true));
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  config.AddServer(local);
+  config.SetUsageTag("");
+  config.SetRevalidationInterval(std::chrono::hours(1));
+
+  auto path = common::joinPaths("test_cache", uriToPath(local.Url()),
+      "alice", "models", "tree", "1");
+  ASSERT_TRUE(common::createDirectories(path));
+  std::ofstream(common::joinPaths(path, "model.config")) << "<?xml?>";
+
+  // Untagged, the use only ranks the model for revalidation.
+  auto client = std::make_unique<FuelClient>(config);
+  EXPECT_FALSE(client->RecordUsage(
+      common::URI(server.url + "/1.0/alice/models/tree", true)));
+
+  // The background revalidation starts once the client has been idle.
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(30),
+        [&] {return archiveRequested;}));
+  }
+
+  // Destroying the client aborts the download in progress.
+  auto start = std::chrono::steady_clock::now();
+  client.reset();
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+      std::chrono::seconds(5));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    released = true;
+  }
+  cv.notify_all();
+}
+#endif
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, WarmupStopsWithClient)
+{
+  // The server holds back its answers until the client is gone, or for 10
+  // seconds.
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool requested = false;
+  bool released = false;
+  LoopbackServer server([&](const std::string &)
+      -> std::pair<std::string, std::string>
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    requested = true;
+    cv.notify_all();
+    cv.wait_for(lock, std::chrono::seconds(10), [&] {return released;});
+    return {"200 OK", ""};
+  });
+  ASSERT_FALSE(server.url.empty());
+
+  ServerConfig local;
+  local.SetUrl(common::URI(server.url, true));
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  config.AddServer(local);
+  config.SetPrewarm(true);
+
+  auto client = std::make_unique<FuelClient>(config);
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10),
+        [&] {return requested;}));
+  }
+
+  // Destroying the client aborts the warm-up.
+  auto start = std::chrono::steady_clock::now();
+  client.reset();
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+      std::chrono::seconds(5));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    released = true;
+  }
+  cv.notify_all();
+}
+#endif
+
 class FuelClientDownloadTest
     : public FuelClientTest,
       public ::testing::WithParamInterface<const char *>
@@ -767,6 +1074,68 @@ TEST_F(FuelClientTest, CachedModel)
         "alice", "models", "My Model", "2", "meshes", "model.dae"), path);
   }
 
+  // View of a cached model file
+  {
+    common::URI url{"http://localhost:8007/1.0/alice/models/My Model/2/files/"
+                    "meshes/model.dae", true};
+    FileView view;
+    auto result = client.CachedModelFileView(url, view);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(ResultType::FETCH_ALREADY_EXISTS, result.Type());
+    ASSERT_TRUE(view);
+    EXPECT_EQ(common::joinPaths(basePath,
+        "alice", "models", "My Model", "2", "meshes", "model.dae"),
+        view.Path());
+
+    std::ifstream in(view.Path(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)),
+        std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, std::string(view.Data(), view.Size()));
+
+    common::URI missing{"http://localhost:8007/1.0/alice/models/My Model/2/"
+                        "files/meshes/banana.dae", true};
+    FileView missingView;
+    EXPECT_FALSE(client.CachedModelFileView(missing, missingView));
+    EXPECT_FALSE(missingView);
+  }
+
+  // Memory tier
+  {
+    ClientConfig memoryConfig = config;
+    memoryConfig.SetMemoryCacheBudget(1024 * 1024);
+    FuelClient memoryClient(memoryConfig);
+
+    common::URI url{"http://localhost:8007/1.0/alice/models/My Model/2/files/"
+                    "meshes/model.dae", true};
+    FileView view;
+    EXPECT_TRUE(memoryClient.CachedModelFileView(url, view));
+    ASSERT_TRUE(view);
+    const std::string content(view.Data(), view.Size());
+    EXPECT_EQ(1u, memoryClient.MemoryCacheStatistics().misses);
+    EXPECT_EQ(1u, memoryClient.MemoryCacheStatistics().entries);
+
+    // Pinned versions are served from memory, even if the file is gone.
+    common::removeFile(view.Path());
+    FileView again;
+    EXPECT_TRUE(memoryClient.CachedModelFileView(url, again));
+    ASSERT_TRUE(again);
+    EXPECT_EQ(view.Data(), again.Data());
+    EXPECT_EQ(content, std::string(again.Data(), again.Size()));
+    EXPECT_EQ(1u, memoryClient.MemoryCacheStatistics().hits);
+
+    // Tip versions are resolved through the cache first.
+    common::URI tipUrl{
+        "http://localhost:8007/1.0/alice/models/My Model/tip/files/model.sdf",
+        true};
+    FileView tip;
+    EXPECT_TRUE(memoryClient.CachedModelFileView(tipUrl, tip));
+    EXPECT_TRUE(memoryClient.CachedModelFileView(tipUrl, tip));
+    EXPECT_EQ(2u, memoryClient.MemoryCacheStatistics().hits);
+
+    // Restore the file for the checks below.
+    std::ofstream(view.Path(), std::ios::binary) << content;
+  }
+
   // Non-cached model
   {
     common::URI url{"http://localhost:8007/1.0/alice/models/Banana", true};
@@ -825,6 +1194,69 @@ TEST_F(FuelClientTest, CachedModel)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, DownloadModelsCached)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  gz::fuel_tools::ServerConfig srv;
+  srv.SetUrl(common::URI("http://localhost:8007/", true));
+  config.AddServer(srv);
+
+  // A cached model whose dependency is cached as well.
+  auto modelsPath = common::joinPaths("test_cache",
+      sanitizeAuthority("localhost:8007"), "alice", "models");
+  for (const std::string name : {"tree", "leaf"})
+  {
+    auto path = common::joinPaths(modelsPath, name, "1");
+    ASSERT_TRUE(common::createDirectories(path));
+    std::ofstream fout(common::joinPaths(path, "metadata.pbtxt"));
+    fout << "name: \"" << name << "\"\n";
+    if (name == "tree")
+    {
+      fout << "dependencies {\n"
+           << "  uri: \"http://localhost:8007/1.0/alice/models/leaf\"\n"
+           << "}\n";
+    }
+  }
+
+  FuelClient client(config);
+  ModelIdentifier tree;
+  tree.SetServer(srv);
+  tree.SetOwner("alice");
+  tree.SetName("tree");
+
+  // Neither the model nor its dependency is downloaded again.
+  for (auto check : {CacheCheck::PINNED, CacheCheck::TIP})
+  {
+    auto results = client.DownloadModels({tree}, 1, DownloadPriority::NORMAL,
+        check);
+    ASSERT_EQ(2u, results.size());
+    std::set<std::string> names;
+    for (const auto &[id, result] : results)
+    {
+      EXPECT_EQ(ResultType::FETCH_ALREADY_EXISTS, result.Type());
+      names.insert(id.Name());
+    }
+    EXPECT_EQ((std::set<std::string>{"leaf", "tree"}), names);
+  }
+
+  // By default the cache isn't checked.
+  {
+    auto results = client.DownloadModels({tree}, 1);
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(ResultType::FETCH_ERROR, std::get<1>(results[0]).Type());
+  }
+
+  // A pinned version which isn't cached is requested from the server.
+  tree.SetVersion(2);
+  auto results = client.DownloadModels({tree}, 1, DownloadPriority::NORMAL,
+      CacheCheck::PINNED);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(ResultType::FETCH_ERROR, std::get<1>(results[0]).Type());
+  EXPECT_EQ(2u, client.DownloadStatistics().failedTransfers);
+}
+
 /////////////////////////////////////////////////
 /// \brief Nothing crashes
 TEST_F(FuelClientTest, ParseWorldUrl)
@@ -1223,6 +1655,20 @@ TEST_F(FuelClientTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CachedWorld))
         "strawberry.world"), path);
   }
 
+  // View of a cached world file
+  {
+    common::URI url{"http://localhost:8007/1.0/banana/worlds/My World/tip/"
+                    "files/strawberry.world", true};
+    FileView view;
+    auto result = client.CachedWorldFileView(url, view);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(ResultType::FETCH_ALREADY_EXISTS, result.Type());
+    ASSERT_TRUE(view);
+    EXPECT_EQ(common::joinPaths(basePath,
+        "banana", "worlds", "My World", "3",
+        "strawberry.world"), view.Path());
+  }
+
   // Deeper cached world file
   {
     common::URI url{"http://localhost:8007/1.0/banana/worlds/My World/2/files/"
@@ -1384,6 +1830,164 @@ TEST_F(FuelClientTest, Models)
   }
 }
 
+//////////////////////////////////////////////////
+TEST_F(FuelClientTest, ModelsQuery)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  FuelClient client(config);
+
+  ResourceQuery query;
+  query.SetSearch("ambulance");
+  query.SetPerPage(2);
+
+  ModelIdentifier modelId;
+  modelId.SetOwner("openrobotics");
+  ModelIter iter = client.Models(modelId, query);
+  ASSERT_TRUE(iter);
+
+  bool found = false;
+  for (; iter; ++iter)
+  {
+    EXPECT_EQ("openrobotics", iter->Identification().Owner());
+    found = found || iter->Identification().Name() == "ambulance";
+  }
+  EXPECT_TRUE(found);
+
+  // Worlds, across pages
+  query.SetSearch("");
+  query.SetSort("name", ResourceQuery::SortOrder::ASCENDING);
+  WorldIdentifier worldId;
+  worldId.SetOwner("openrobotics");
+  std::size_t count = 0;
+  for (WorldIter worlds = client.Worlds(worldId, query); worlds; ++worlds)
+    ++count;
+  EXPECT_GT(count, 2u);
+}
+
+#ifndef _WIN32
+//////////////////////////////////////////////////
+TEST_F(FuelClientTest, SearchModels)
+{
+  // Models of the server, as name, description and modification day, and
+  // the page to fail, if any. Pages hold 2 models.
+  std::mutex mutex;
+  std::vector<std::tuple<std::string, std::string, int>> catalog = {
+    {"Alpha", "First model", 1},
+    {"Beta", "Second model", 2},
+    {"Gamma", "Third model", 3}};
+  int failedPage = 0;
+
+  LoopbackServer server([&](const std::string &_target)
+      -> std::pair<std::string, std::string>
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::smatch match;
+    if (!std::regex_search(_target, match, std::regex("[?&]page=(\\d+)")))
+      return {"404 Not Found", ""};
+    const int page = std::stoi(match[1]);
+    if (page == failedPage)
+      return {"500 Internal Server Error", ""};
+
+    auto models = catalog;
+    if (_target.find("sort=updatedAt&order=desc") != std::string::npos)
+    {
+      std::sort(models.begin(), models.end(), [](auto &_a, auto &_b)
+          {
+            return std::get<2>(_a) > std::get<2>(_b);
+          });
+    }
+
+    std::string body = "[";
+    for (std::size_t m = (page - 1) * 2;
+         m < models.size() && m < static_cast<std::size_t>(page) * 2; ++m)
+    {
+      body += std::string(body.size() > 1 ? "," : "") +
+        "{\"name\": \"" + std::get<0>(models[m]) +
+        "\", \"owner\": \"alice\", \"description\": \"" +
+        std::get<1>(models[m]) + "\", \"updatedAt\": \"2024-01-0" +
+        std::to_string(std::get<2>(models[m])) + "T00:00:00Z\"}";
+    }
+    return {"200 OK", body + "]"};
+  });
+  ASSERT_FALSE(server.url.empty());
+
+  ServerConfig local;
+  local.SetUrl(common::URI(server.url, true));
+  ClientConfig config;
+  config.Clear();
+  config.AddServer(local);
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+
+  {
+    FuelClient client(config);
+
+    // Nothing indexed yet
+    EXPECT_TRUE(client.SearchModels("alpha").empty());
+
+    ServerConfig invalidServer;
+    invalidServer.Clear();
+    EXPECT_EQ(ResultType::FETCH_ERROR,
+        client.UpdateSearchIndex(invalidServer).Type());
+
+    // The first index lists all the pages.
+    ASSERT_EQ(ResultType::FETCH, client.UpdateSearchIndex(local).Type());
+    EXPECT_EQ(std::vector<std::string>({"/1.0/models?page=1",
+        "/1.0/models?page=2", "/1.0/models?page=3"}), server.TakeTargets());
+    auto results = client.SearchModels("first");
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ("alpha", results[0].Name());
+    EXPECT_EQ(server.url, results[0].Server().Url().Str());
+
+    // Later ones stop at the first unchanged model.
+    EXPECT_EQ(ResultType::FETCH_ALREADY_EXISTS,
+        client.UpdateSearchIndex(local).Type());
+    EXPECT_EQ(std::vector<std::string>(
+        {"/1.0/models?sort=updatedAt&order=desc&page=1"}),
+        server.TakeTargets());
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      catalog[1] = {"Beta", "Changed model", 4};
+      catalog.emplace_back("Delta", "Fourth model", 5);
+    }
+    ASSERT_EQ(ResultType::FETCH, client.UpdateSearchIndex(local).Type());
+    EXPECT_EQ(2u, server.TakeTargets().size());
+    EXPECT_EQ(4u, client.SearchModels("model").size());
+    EXPECT_TRUE(client.SearchModels("second").empty());
+  }
+
+  // A new client reads the index from the cache
+  FuelClient client(config);
+  auto results = client.SearchModels("alice changed", 5);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ("beta", results[0].Name());
+  EXPECT_TRUE(client.SearchModels("alice qwertyuiopasdfgh").empty());
+
+  // A failed page leaves the index alone, instead of dropping the models
+  // of the missing pages.
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &model : catalog)
+    {
+      std::get<1>(model) = "Updated model";
+      std::get<2>(model) += 4;
+    }
+    failedPage = 2;
+  }
+  EXPECT_EQ(ResultType::FETCH_ERROR, client.UpdateSearchIndex(local).Type());
+  EXPECT_TRUE(client.SearchModels("updated").empty());
+  EXPECT_EQ(4u, client.SearchModels("model").size());
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    failedPage = 0;
+  }
+  ASSERT_EQ(ResultType::FETCH, client.UpdateSearchIndex(local).Type());
+  EXPECT_EQ(4u, client.SearchModels("updated").size());
+}
+#endif
+
 //////////////////////////////////////////////////
 TEST_F(FuelClientTest, ModelsCheckCached)
 {
@@ -1484,6 +2088,161 @@ TEST_F(FuelClientTest, DownloadWorldFail)
   EXPECT_EQ(ResultType::FETCH_ERROR, result.Type());
 }
 
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, DownloadCollection)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  common::removeAll(config.CacheLocation());
+  FuelClient client(config);
+
+  CollectionIdentifier collection;
+  ASSERT_TRUE(client.ParseCollectionUrl(common::URI(
+      "https://fuel.gazebosim.org/1.0/openroboticstest/collections/"
+      "testcollection"), collection));
+
+  // Nothing to download
+  EXPECT_EQ(ResultType::FETCH_ERROR,
+      client.DownloadCollection(collection, false, false).Type());
+
+  EXPECT_EQ(ResultType::FETCH,
+      client.DownloadCollection(collection, true, true, 4).Type());
+  EXPECT_TRUE(common::isFile(common::joinPaths(config.CacheLocation(),
+      "fuel.gazebosim.org", "openroboticstest", "models", "backpack", "3",
+      "model.sdf")));
+  EXPECT_TRUE(common::isFile(common::joinPaths(config.CacheLocation(),
+      "fuel.gazebosim.org", "openroboticstest", "worlds", "test world2", "1",
+      "test.sdf")));
+
+  // Cancelled before anything starts
+  CancellationToken token;
+  token.Cancel();
+  client.SetCancellationToken(token);
+  EXPECT_EQ(ResultType::CANCELLED,
+      client.DownloadCollection(collection).Type());
+}
+
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, DownloadCollectionCached)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  common::removeAll(config.CacheLocation());
+  FuelClient client(config);
+
+  CollectionIdentifier collection;
+  ASSERT_TRUE(client.ParseCollectionUrl(common::URI(
+      "https://fuel.gazebosim.org/1.0/openroboticstest/collections/"
+      "testcollection"), collection));
+  ASSERT_EQ(ResultType::FETCH,
+      client.DownloadCollection(collection, true, false, 4).Type());
+
+  // Make every model of the collection depend on a model that only the
+  // cache has, the server doesn't.
+  const std::string modelsPath = common::joinPaths(config.CacheLocation(),
+      "fuel.gazebosim.org", "openroboticstest", "models");
+  std::vector<std::string> versionPaths;
+  common::DirIter end;
+  for (common::DirIter model(modelsPath); model != end; ++model)
+  {
+    for (common::DirIter version(*model); version != end; ++version)
+      versionPaths.push_back(*version);
+  }
+  ASSERT_GT(versionPaths.size(), 1u);
+  for (const auto &path : versionPaths)
+  {
+    std::ofstream fout(common::joinPaths(path, "metadata.pbtxt"));
+    fout << "name: \"" << common::basename(common::parentPath(path))
+         << "\"\n"
+         << "dependencies {\n"
+         << "  uri: \"https://fuel.gazebosim.org/1.0/openroboticstest/"
+         << "models/shared_leaf\"\n"
+         << "}\n";
+  }
+  const std::string leafPath =
+    common::joinPaths(modelsPath, "shared_leaf", "1");
+  ASSERT_TRUE(common::createDirectories(leafPath));
+  std::ofstream(common::joinPaths(leafPath, "metadata.pbtxt"))
+    << "name: \"shared_leaf\"\n";
+
+  // Neither the models nor their shared dependency are downloaded again.
+  const std::size_t transfers = client.DownloadStatistics().transfers;
+  EXPECT_EQ(ResultType::FETCH,
+      client.DownloadCollection(collection, true, false, 4,
+        DownloadPriority::NORMAL, CacheCheck::PINNED).Type());
+  EXPECT_EQ(transfers, client.DownloadStatistics().transfers);
+
+  // By default every model is downloaded again.
+  EXPECT_EQ(ResultType::FETCH,
+      client.DownloadCollection(collection, true, false, 4).Type());
+  EXPECT_GT(client.DownloadStatistics().transfers, transfers);
+}
+
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, DownloadOwner)
+{
+  ClientConfig config;
+  config.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  common::removeAll(config.CacheLocation());
+  FuelClient client(config);
+  const ServerConfig server = config.Servers().front();
+
+  BulkDownloadStats stats;
+  EXPECT_EQ(ResultType::FETCH_ERROR,
+      client.DownloadOwner(server, "", stats).Type());
+
+  ASSERT_EQ(ResultType::FETCH,
+      client.DownloadOwner(server, "openroboticstest", stats, 4).Type());
+  EXPECT_GT(stats.listed, 0u);
+  EXPECT_EQ(stats.listed, stats.downloaded + stats.skipped);
+  EXPECT_EQ(0u, stats.failed);
+  EXPECT_GT(stats.bytes, 0u);
+  EXPECT_TRUE(common::isFile(common::joinPaths(config.CacheLocation(),
+      "fuel.gazebosim.org", "openroboticstest", "models", "backpack", "3",
+      "model.sdf")));
+
+  // Everything is cached now, dependencies are read from the cache
+  const std::size_t listed = stats.listed;
+  ASSERT_EQ(ResultType::FETCH,
+      client.DownloadOwner(server, "openroboticstest", stats, 4).Type());
+  EXPECT_LE(stats.listed, listed);
+  EXPECT_EQ(0u, stats.downloaded);
+  EXPECT_EQ(stats.listed, stats.skipped);
+  EXPECT_EQ(0u, stats.bytes);
+}
+
+/////////////////////////////////////////////////
+TEST_F(FuelClientTest, Cancellation)
+{
+  FuelClient client;
+  EXPECT_FALSE(client.Cancellation().Cancelled());
+
+  CancellationToken token;
+  client.SetCancellationToken(token);
+  token.Cancel();
+  EXPECT_TRUE(client.Cancellation().Cancelled());
+
+  // Nothing is requested once cancelled.
+  ModelIdentifier modelId;
+  modelId.SetOwner("openrobotics");
+  modelId.SetName("Cancelled");
+  EXPECT_EQ(ResultType::CANCELLED, client.DownloadModel(modelId).Type());
+
+  WorldIdentifier worldId;
+  worldId.SetOwner("openrobotics");
+  worldId.SetName("Cancelled");
+  EXPECT_EQ(ResultType::CANCELLED, client.DownloadWorld(worldId).Type());
+
+  EXPECT_TRUE(client.DownloadModels({modelId, modelId}).empty());
+  EXPECT_EQ(ResultType::CANCELLED,
+      client.DownloadWorlds({worldId, worldId}).Type());
+
+  // Resetting the token makes the client usable again.
+  token.Reset();
+  EXPECT_EQ(ResultType::FETCH_ERROR,
+      client.DownloadModel(ModelIdentifier()).Type());
+}
+
 /////////////////////////////////////////////////
 TEST_F(FuelClientTest, UploadModelFail)
 {
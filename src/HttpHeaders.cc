@@ -0,0 +1,380 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gz/fuel_tools/HttpHeaders.hh"
+
+namespace gz::fuel_tools
+{
+//////////////////////////////////////////////////
+/// \brief Location of a header in the shared buffer.
+struct HeaderEntry
+{
+  /// \brief Offset of the name.
+  std::uint32_t nameOffset;
+
+  /// \brief Length of the name.
+  std::uint32_t nameSize;
+
+  /// \brief Offset of the value, which follows the name.
+  std::uint32_t valueOffset;
+
+  /// \brief Length of the value.
+  std::uint32_t valueSize;
+};
+
+//////////////////////////////////////////////////
+/// \brief Private data class
+class HttpHeadersPrivate
+{
+  /// \brief Find the first header with a name.
+  /// \param[in] _name Name of the header, in any case.
+  /// \return The header, null if missing.
+  public: const HeaderEntry *Find(std::string_view _name) const;
+
+  /// \brief Get the name of a header.
+  /// \param[in] _entry The header.
+  /// \return View of the name in the buffer.
+  public: std::string_view Name(const HeaderEntry &_entry) const
+  {
+    return std::string_view(this->buffer).substr(
+        _entry.nameOffset, _entry.nameSize);
+  }
+
+  /// \brief Get the value of a header.
+  /// \param[in] _entry The header.
+  /// \return View of the value in the buffer.
+  public: std::string_view Value(const HeaderEntry &_entry) const
+  {
+    return std::string_view(this->buffer).substr(
+        _entry.valueOffset, _entry.valueSize);
+  }
+
+  /// \brief Names and values of all the headers, one after the other.
+  public: std::string buffer;
+
+  /// \brief Headers in the order they were received.
+  public: std::vector<HeaderEntry> entries;
+};
+
+//////////////////////////////////////////////////
+/// \brief Lower case an ASCII character.
+/// \param[in] _c Character.
+/// \return The character in lower case.
+static char ToLower(char _c)
+{
+  return (_c >= 'A' && _c <= 'Z') ? static_cast<char>(_c - 'A' + 'a') : _c;
+}
+
+//////////////////////////////////////////////////
+/// \brief Compare two ASCII strings without regard to case.
+/// \param[in] _a First string.
+/// \param[in] _b Second string.
+/// \return True if the strings are equal.
+static bool EqualsNoCase(std::string_view _a, std::string_view _b)
+{
+  if (_a.size() != _b.size())
+    return false;
+  for (std::size_t i = 0; i < _a.size(); ++i)
+  {
+    if (ToLower(_a[i]) != ToLower(_b[i]))
+      return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Remove leading and trailing spaces, tabs and line breaks.
+/// \param[in] _str String to trim.
+/// \return View of the trimmed string.
+static std::string_view Trim(std::string_view _str)
+{
+  static constexpr std::string_view kSpaces = " \t\r\n";
+  auto start = _str.find_first_not_of(kSpaces);
+  if (start == std::string_view::npos)
+    return {};
+  auto end = _str.find_last_not_of(kSpaces);
+  return _str.substr(start, end - start + 1);
+}
+
+//////////////////////////////////////////////////
+const HeaderEntry *HttpHeadersPrivate::Find(std::string_view _name) const
+{
+  for (const auto &entry : this->entries)
+  {
+    if (EqualsNoCase(this->Name(entry), _name))
+      return &entry;
+  }
+  return nullptr;
+}
+
+//////////////////////////////////////////////////
+HttpHeaders::HttpHeaders()
+  : dataPtr(new HttpHeadersPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+HttpHeaders::HttpHeaders(const HttpHeaders &_orig)
+  : dataPtr(new HttpHeadersPrivate(*_orig.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+HttpHeaders::HttpHeaders(HttpHeaders &&_orig) noexcept
+  : dataPtr(new HttpHeadersPrivate)
+{
+  std::swap(this->dataPtr, _orig.dataPtr);
+}
+
+//////////////////////////////////////////////////
+HttpHeaders &HttpHeaders::operator=(const HttpHeaders &_orig)
+{
+  *this->dataPtr = *_orig.dataPtr;
+  return *this;
+}
+
+//////////////////////////////////////////////////
+HttpHeaders &HttpHeaders::operator=(HttpHeaders &&_orig) noexcept
+{
+  std::swap(this->dataPtr, _orig.dataPtr);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+HttpHeaders::~HttpHeaders() = default;
+
+//////////////////////////////////////////////////
+bool HttpHeaders::Parse(std::string_view _line)
+{
+  // A new response starts with its status line, e.g. after a redirect.
+  if (_line.substr(0, 5) == "HTTP/")
+  {
+    this->Clear();
+    return false;
+  }
+
+  // Only store header information of the form
+  //     <type>: <data>
+  auto colonPos = _line.find(':');
+  if (colonPos == std::string_view::npos)
+    return false;
+
+  std::string_view name = Trim(_line.substr(0, colonPos));
+  if (name.empty())
+    return false;
+
+  this->Add(name, Trim(_line.substr(colonPos + 1)));
+  return true;
+}
+
+//////////////////////////////////////////////////
+void HttpHeaders::Add(std::string_view _name, std::string_view _value)
+{
+  auto &buffer = this->dataPtr->buffer;
+  if (buffer.size() + _name.size() + _value.size() >
+      std::numeric_limits<std::uint32_t>::max())
+  {
+    return;
+  }
+
+  HeaderEntry entry;
+  entry.nameOffset = static_cast<std::uint32_t>(buffer.size());
+  entry.nameSize = static_cast<std::uint32_t>(_name.size());
+  buffer.append(_name);
+  entry.valueOffset = static_cast<std::uint32_t>(buffer.size());
+  entry.valueSize = static_cast<std::uint32_t>(_value.size());
+  buffer.append(_value);
+  this->dataPtr->entries.push_back(entry);
+}
+
+//////////////////////////////////////////////////
+void HttpHeaders::Clear()
+{
+  this->dataPtr->buffer.clear();
+  this->dataPtr->entries.clear();
+}
+
+//////////////////////////////////////////////////
+std::size_t HttpHeaders::Size() const
+{
+  return this->dataPtr->entries.size();
+}
+
+//////////////////////////////////////////////////
+bool HttpHeaders::Empty() const
+{
+  return this->dataPtr->entries.empty();
+}
+
+//////////////////////////////////////////////////
+std::string_view HttpHeaders::Name(std::size_t _index) const
+{
+  if (_index >= this->dataPtr->entries.size())
+    return {};
+  return this->dataPtr->Name(this->dataPtr->entries[_index]);
+}
+
+//////////////////////////////////////////////////
+std::string_view HttpHeaders::Value(std::size_t _index) const
+{
+  if (_index >= this->dataPtr->entries.size())
+    return {};
+  return this->dataPtr->Value(this->dataPtr->entries[_index]);
+}
+
+//////////////////////////////////////////////////
+bool HttpHeaders::Has(std::string_view _name) const
+{
+  return this->dataPtr->Find(_name) != nullptr;
+}
+
+//////////////////////////////////////////////////
+std::string_view HttpHeaders::Value(std::string_view _name) const
+{
+  const HeaderEntry *entry = this->dataPtr->Find(_name);
+  return entry ? this->dataPtr->Value(*entry) : std::string_view();
+}
+
+//////////////////////////////////////////////////
+bool HttpHeaders::UInt(std::string_view _name, std::uint64_t &_value) const
+{
+  const HeaderEntry *entry = this->dataPtr->Find(_name);
+  if (!entry)
+    return false;
+
+  std::string_view str = this->dataPtr->Value(*entry);
+  std::uint64_t value = 0;
+  auto [end, ec] = std::from_chars(str.data(), str.data() + str.size(),
+      value);
+  if (ec != std::errc() || end != str.data() + str.size() || str.empty())
+    return false;
+
+  _value = value;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool HttpHeaders::ResourceVersion(unsigned int &_version) const
+{
+  std::uint64_t version = 0;
+  if (!this->UInt("X-Ign-Resource-Version", version) ||
+      version > std::numeric_limits<unsigned int>::max())
+  {
+    return false;
+  }
+  _version = static_cast<unsigned int>(version);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool HttpHeaders::ContentLength(std::uint64_t &_length) const
+{
+  return this->UInt("Content-Length", _length);
+}
+
+//////////////////////////////////////////////////
+std::string HttpHeaders::ContentType() const
+{
+  std::string_view value = this->Value("Content-Type");
+  std::string type(Trim(value.substr(0, value.find(';'))));
+  for (char &c : type)
+    c = ToLower(c);
+  return type;
+}
+
+//////////////////////////////////////////////////
+std::string_view HttpHeaders::ETag() const
+{
+  return this->Value("ETag");
+}
+
+//////////////////////////////////////////////////
+std::string HttpHeaders::LinkUrl(std::string_view _rel) const
+{
+  // Each Link header holds comma separated links of the form
+  //     <url>; rel="next"; title="..."
+  for (const auto &entry : this->dataPtr->entries)
+  {
+    if (!EqualsNoCase(this->dataPtr->Name(entry), "Link"))
+      continue;
+
+    std::string_view value = this->dataPtr->Value(entry);
+    while (!value.empty())
+    {
+      auto open = value.find('<');
+      auto close = value.find('>', open);
+      if (open == std::string_view::npos || close == std::string_view::npos)
+        break;
+
+      std::string_view url = value.substr(open + 1, close - open - 1);
+
+      // The parameters end at the next link.
+      std::string_view params = value.substr(close + 1);
+      auto next = params.find('<');
+      if (next != std::string_view::npos)
+      {
+        value = params.substr(next);
+        params = params.substr(0, next);
+      }
+      else
+      {
+        value = {};
+      }
+
+      while (!params.empty())
+      {
+        auto end = params.find(';');
+        std::string_view param = Trim(params.substr(0, end));
+        params = end == std::string_view::npos ?
+          std::string_view() : params.substr(end + 1);
+
+        auto eq = param.find('=');
+        if (eq == std::string_view::npos ||
+            !EqualsNoCase(Trim(param.substr(0, eq)), "rel"))
+        {
+          continue;
+        }
+
+        // The relation may be quoted and hold several space separated
+        // types, e.g. rel="next last".
+        std::string_view rels = param.substr(eq + 1);
+        rels = Trim(rels.substr(0, rels.find(',')));
+        if (rels.size() >= 2 && rels.front() == '"' && rels.back() == '"')
+          rels = Trim(rels.substr(1, rels.size() - 2));
+        while (!rels.empty())
+        {
+          auto space = rels.find(' ');
+          if (EqualsNoCase(rels.substr(0, space), _rel))
+            return std::string(Trim(url));
+          rels = space == std::string_view::npos ?
+            std::string_view() : Trim(rels.substr(space + 1));
+        }
+      }
+    }
+  }
+  return "";
+}
+}  // namespace gz::fuel_tools
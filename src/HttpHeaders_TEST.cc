@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "gz/fuel_tools/HttpHeaders.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+TEST(HttpHeaders, Parse)
+{
+  HttpHeaders headers;
+  EXPECT_TRUE(headers.Empty());
+
+  EXPECT_FALSE(headers.Parse("HTTP/2 200\r\n"));
+  EXPECT_TRUE(headers.Parse("content-type: application/zip\r\n"));
+  EXPECT_TRUE(headers.Parse("X-Custom:\tno space \r\n"));
+  EXPECT_TRUE(headers.Parse("Empty:\r\n"));
+  EXPECT_FALSE(headers.Parse("\r\n"));
+  EXPECT_FALSE(headers.Parse(": no name\r\n"));
+
+  // Lines aren't null-terminated, only the given bytes are read.
+  const char raw[] = "Server: fuelXXXX";
+  EXPECT_TRUE(headers.Parse(std::string_view(raw, 12)));
+
+  ASSERT_EQ(4u, headers.Size());
+  EXPECT_EQ("content-type", headers.Name(0));
+  EXPECT_EQ("application/zip", headers.Value(0));
+  EXPECT_EQ("X-Custom", headers.Name(1));
+  EXPECT_EQ("no space", headers.Value(1));
+  EXPECT_EQ("", headers.Value(2));
+  EXPECT_EQ("fuel", headers.Value(3));
+  EXPECT_TRUE(headers.Name(4).empty());
+
+  // Names are case-insensitive.
+  EXPECT_TRUE(headers.Has("Content-Type"));
+  EXPECT_TRUE(headers.Has("CONTENT-TYPE"));
+  EXPECT_EQ("no space", headers.Value("x-custom"));
+  EXPECT_TRUE(headers.Has("empty"));
+  EXPECT_FALSE(headers.Has("Missing"));
+  EXPECT_TRUE(headers.Value("Missing").empty());
+
+  // A redirect starts a new response.
+  EXPECT_FALSE(headers.Parse("HTTP/1.1 200 OK\r\n"));
+  EXPECT_TRUE(headers.Empty());
+}
+
+/////////////////////////////////////////////////
+TEST(HttpHeaders, CopyMove)
+{
+  HttpHeaders headers;
+  headers.Add("ETag", "\"abc\"");
+
+  HttpHeaders copy(headers);
+  headers.Clear();
+  EXPECT_EQ("\"abc\"", copy.ETag());
+
+  HttpHeaders moved(std::move(copy));
+  EXPECT_EQ("\"abc\"", moved.ETag());
+
+  headers = moved;
+  EXPECT_EQ("\"abc\"", headers.ETag());
+
+  // A moved-from object can still be used.
+  HttpHeaders other;
+  other = std::move(moved);
+  EXPECT_EQ(1u, other.Size());
+  moved.Add("Name", "value");
+  EXPECT_EQ("value", moved.Value("name"));
+}
+
+/////////////////////////////////////////////////
+TEST(HttpHeaders, Typed)
+{
+  HttpHeaders headers;
+  std::uint64_t length = 7;
+  unsigned int version = 7;
+  EXPECT_FALSE(headers.ContentLength(length));
+  EXPECT_FALSE(headers.ResourceVersion(version));
+  EXPECT_EQ(7u, length);
+  EXPECT_EQ(7u, version);
+  EXPECT_TRUE(headers.ContentType().empty());
+  EXPECT_TRUE(headers.ETag().empty());
+
+  headers.Parse("content-length: 123456789012\r\n");
+  headers.Parse("x-ign-resource-version: 3\r\n");
+  headers.Parse("Content-Type: Text/Plain; charset=utf-8\r\n");
+  headers.Parse("etag: W/\"5d8c72a5\"\r\n");
+  headers.Parse("X-Bad: 12ab\r\n");
+  headers.Parse("X-Negative: -1\r\n");
+
+  EXPECT_TRUE(headers.ContentLength(length));
+  EXPECT_EQ(123456789012u, length);
+  EXPECT_TRUE(headers.ResourceVersion(version));
+  EXPECT_EQ(3u, version);
+  EXPECT_EQ("text/plain", headers.ContentType());
+  EXPECT_EQ("W/\"5d8c72a5\"", headers.ETag());
+
+  std::uint64_t value = 7;
+  EXPECT_FALSE(headers.UInt("X-Bad", value));
+  EXPECT_FALSE(headers.UInt("X-Negative", value));
+  EXPECT_EQ(7u, value);
+
+  // Versions must fit in an unsigned int.
+  HttpHeaders large;
+  large.Add("X-Ign-Resource-Version", "99999999999");
+  EXPECT_FALSE(large.ResourceVersion(version));
+  EXPECT_EQ(3u, version);
+}
+
+/////////////////////////////////////////////////
+TEST(HttpHeaders, LinkUrl)
+{
+  HttpHeaders headers;
+  EXPECT_TRUE(headers.LinkUrl("next").empty());
+
+  headers.Parse("link: <https://fuel.gazebosim.org/1.0/worlds?page=2"
+      "&per_page=20>; rel=\"next\", "
+      "<https://fuel.gazebosim.org/1.0/worlds?page=9>; rel=\"last\"\r\n");
+  EXPECT_EQ("https://fuel.gazebosim.org/1.0/worlds?page=2&per_page=20",
+      headers.LinkUrl("next"));
+  EXPECT_EQ("https://fuel.gazebosim.org/1.0/worlds?page=9",
+      headers.LinkUrl("LAST"));
+  EXPECT_TRUE(headers.LinkUrl("prev").empty());
+
+  // Unquoted and multiple relation types, other parameters, and links
+  // split across headers.
+  HttpHeaders split;
+  split.Add("Link", "</a>; title=\"next page\"; rel=prev, </b>; rel=first");
+  split.Add("Link", "</c>; rel=\"last next\"");
+  EXPECT_EQ("/a", split.LinkUrl("prev"));
+  EXPECT_EQ("/b", split.LinkUrl("first"));
+  EXPECT_EQ("/c", split.LinkUrl("next"));
+  EXPECT_EQ("/c", split.LinkUrl("last"));
+}
@@ -82,6 +82,10 @@ namespace gz::fuel_tools
 
     }
 
+    // Remember what was resolved, so that it can be prefetched next time.
+    if (!result.empty())
+      _client.RecordUsage(uri);
+
     return result;
   }
 
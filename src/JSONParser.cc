@@ -16,6 +16,8 @@
 */
 
 #include <json/json.h>
+#include <array>
+#include <charconv>
 #include <string>
 #include <vector>
 #include <gz/common/Console.hh>
@@ -33,6 +35,128 @@
 
 namespace gz::fuel_tools
 {
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Buffers JSON text and flushes it to a stream in large blocks, so
+/// that the stream isn't called for every token.
+class JsonStreamWriter
+{
+  /// \brief Constructor.
+  /// \param[in] _out Stream to write to.
+  public: explicit JsonStreamWriter(std::ostream &_out)
+          : out(_out)
+  {
+    this->buffer.reserve(kCapacity);
+  }
+
+  /// \brief Destructor, flushes the buffer.
+  public: ~JsonStreamWriter()
+  {
+    this->Flush();
+  }
+
+  /// \brief Append raw text.
+  /// \param[in] _data Text to append.
+  /// \param[in] _size Size of the text.
+  public: void Raw(const char *_data, std::size_t _size)
+  {
+    if (this->buffer.size() + _size > kCapacity)
+      this->Flush();
+    if (_size >= kCapacity)
+      this->out.write(_data, static_cast<std::streamsize>(_size));
+    else
+      this->buffer.append(_data, _size);
+  }
+
+  /// \brief Append a literal.
+  /// \param[in] _literal Text to append.
+  public: template<std::size_t N>
+          void Raw(const char (&_literal)[N])
+  {
+    this->Raw(_literal, N - 1);
+  }
+
+  /// \brief Append a quoted and escaped string. Runs of characters that
+  /// don't need escaping, which is nearly everything in practice, are
+  /// copied at once.
+  /// \param[in] _str String to append.
+  public: void String(const std::string &_str)
+  {
+    static const std::array<bool, 256> kEscape = []
+    {
+      std::array<bool, 256> table{};
+      for (int c = 0; c < 0x20; ++c)
+        table[c] = true;
+      table['"'] = true;
+      table['\\'] = true;
+      return table;
+    }();
+
+    this->Raw("\"");
+    const char *data = _str.data();
+    const std::size_t size = _str.size();
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const auto c = static_cast<unsigned char>(data[i]);
+      if (!kEscape[c])
+        continue;
+
+      this->Raw(data + start, i - start);
+      start = i + 1;
+      switch (c)
+      {
+        case '"': this->Raw("\\\""); break;
+        case '\\': this->Raw("\\\\"); break;
+        case '\b': this->Raw("\\b"); break;
+        case '\f': this->Raw("\\f"); break;
+        case '\n': this->Raw("\\n"); break;
+        case '\r': this->Raw("\\r"); break;
+        case '\t': this->Raw("\\t"); break;
+        default:
+        {
+          static const char kHex[] = "0123456789abcdef";
+          const char escaped[] = {'\\', 'u', '0', '0', kHex[c >> 4],
+            kHex[c & 0xF]};
+          this->Raw(escaped, sizeof(escaped));
+        }
+      }
+    }
+    this->Raw(data + start, size - start);
+    this->Raw("\"");
+  }
+
+  /// \brief Append an unsigned integer.
+  /// \param[in] _value Value to append.
+  public: void UInt(unsigned int _value)
+  {
+    char digits[16];
+    auto result = std::to_chars(digits, digits + sizeof(digits), _value);
+    this->Raw(digits, static_cast<std::size_t>(result.ptr - digits));
+  }
+
+  /// \brief Write the buffered text to the stream.
+  public: void Flush()
+  {
+    if (!this->buffer.empty())
+    {
+      this->out.write(this->buffer.data(),
+          static_cast<std::streamsize>(this->buffer.size()));
+      this->buffer.clear();
+    }
+  }
+
+  /// \brief Size of the buffer.
+  private: static constexpr std::size_t kCapacity = 64 * 1024;
+
+  /// \brief Stream to write to.
+  private: std::ostream &out;
+
+  /// \brief Text not written to the stream yet.
+  private: std::string buffer;
+};
+}  // namespace
 
 /////////////////////////////////////////////////
 std::time_t ParseDateTime(const std::string &_datetime)
@@ -329,6 +453,8 @@ bool JSONParser::ParseWorldImpl(
       _world.SetOwner(_json["owner"].asString());
     if (_json.isMember("version"))
       _world.SetVersion(_json["version"].asUInt());
+    if (_json.isMember("filesize"))
+      _world.SetFileSize(_json["filesize"].asUInt());
   }
 #if GZ_JSON_HAVE_EXCEPTIONS == 1
   catch (...)
@@ -357,6 +483,55 @@ std::string JSONParser::BuildWorld(WorldIter _worldIt)
   return Json::writeString(builder, value);
 }
 
+/////////////////////////////////////////////////
+bool JSONParser::WriteModels(ModelIter _modelIt, std::ostream &_out)
+{
+  {
+    JsonStreamWriter writer(_out);
+    writer.Raw("[");
+    for (bool first = true; _modelIt; ++_modelIt, first = false)
+    {
+      const ModelIdentifier id = _modelIt->Identification();
+      if (!first)
+        writer.Raw(",");
+      writer.Raw("{\"description\":");
+      writer.String(id.Description());
+      writer.Raw(",\"name\":");
+      writer.String(id.Name());
+      writer.Raw(",\"owner\":");
+      writer.String(id.Owner());
+      writer.Raw(",\"version\":");
+      writer.UInt(id.Version());
+      writer.Raw("}");
+    }
+    writer.Raw("]");
+  }
+  return _out.good();
+}
+
+/////////////////////////////////////////////////
+bool JSONParser::WriteWorlds(WorldIter _worldIt, std::ostream &_out)
+{
+  {
+    JsonStreamWriter writer(_out);
+    writer.Raw("[");
+    for (bool first = true; _worldIt; ++_worldIt, first = false)
+    {
+      if (!first)
+        writer.Raw(",");
+      writer.Raw("{\"name\":");
+      writer.String(_worldIt->Name());
+      writer.Raw(",\"owner\":");
+      writer.String(_worldIt->Owner());
+      writer.Raw(",\"version\":");
+      writer.UInt(_worldIt->Version());
+      writer.Raw("}");
+    }
+    writer.Raw("]");
+  }
+  return _out.good();
+}
+
 /////////////////////////////////////////////////
 bool JSONParser::ParseLicenses(const std::string &_json,
     std::map<std::string, unsigned int> &_licenses)
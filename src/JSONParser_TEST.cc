@@ -84,6 +84,50 @@ TEST(JSONParser, BuildModel)
   EXPECT_EQ(tmpJsonStr.str(), jsonStr);
 }
 
+/////////////////////////////////////////////////
+/// \brief Stream models as a JSON array
+TEST(JSONParser, WriteModels)
+{
+  std::vector<ModelIdentifier> ids;
+  ModelIdentifier id;
+  id.SetOwner("alice");
+  id.SetName("house");
+  id.SetVersion(5);
+  id.SetDescription("\"quoted\" back\\slash\ttab\nnew line \x01 caf\xc3\xa9");
+  ids.push_back(id);
+  id.SetName("shed");
+  id.SetVersion(1);
+  id.SetDescription("");
+  ids.push_back(id);
+
+  std::ostringstream out;
+  EXPECT_TRUE(JSONParser::WriteModels(ModelIterFactory::Create(ids), out));
+  EXPECT_EQ("[{\"description\":\"\\\"quoted\\\" back\\\\slash\\ttab"
+      "\\nnew line \\u0001 caf\xc3\xa9\",\"name\":\"house\",\"owner\":\"alice\","
+      "\"version\":5},{\"description\":\"\",\"name\":\"shed\","
+      "\"owner\":\"alice\",\"version\":1}]", out.str());
+
+  // The output parses back to the same models.
+  ServerConfig srv;
+  auto parsed = JSONParser::ParseModels(out.str(), srv);
+  ASSERT_EQ(2u, parsed.size());
+  EXPECT_EQ(ids[0].Description(), parsed[0].Description());
+  EXPECT_EQ("house", parsed[0].Name());
+  EXPECT_EQ("alice", parsed[0].Owner());
+  EXPECT_EQ(5u, parsed[0].Version());
+  EXPECT_EQ("shed", parsed[1].Name());
+
+  std::ostringstream empty;
+  EXPECT_TRUE(JSONParser::WriteModels(ModelIterFactory::Create(), empty));
+  EXPECT_EQ("[]", empty.str());
+
+  // Catalogs larger than the internal buffer
+  ids.assign(5000, id);
+  std::ostringstream large;
+  EXPECT_TRUE(JSONParser::WriteModels(ModelIterFactory::Create(ids), large));
+  EXPECT_EQ(5000u, JSONParser::ParseModels(large.str(), srv).size());
+}
+
 /////////////////////////////////////////////////
 TEST(JSONParser, ParseModel)
 {
@@ -120,7 +164,8 @@ TEST(JSONParser, ParseWorlds)
   std::stringstream tmpJsonStr;
   tmpJsonStr << "["
     << "{\"name\":\"car\","
-    << "\"version\":3}]";
+    << "\"version\":3,"
+    << "\"filesize\":2048}]";
 
   ServerConfig srv;
   srv.SetUrl(common::URI("banana://testServer"));
@@ -130,6 +175,7 @@ TEST(JSONParser, ParseWorlds)
   auto world = worldIds.front();
   EXPECT_EQ("car", world.Name());
   EXPECT_EQ(3u, world.Version());
+  EXPECT_EQ(2048u, world.FileSize());
   EXPECT_EQ("banana://testServer", world.Server().Url().Str());
 }
 
@@ -154,6 +200,28 @@ TEST(JSONParser, BuildWorld)
   EXPECT_EQ(tmpJsonStr.str(), jsonStr);
 }
 
+/////////////////////////////////////////////////
+/// \brief Stream worlds as a JSON array
+TEST(JSONParser, WriteWorlds)
+{
+  std::vector<WorldIdentifier> ids;
+  WorldIdentifier id;
+  id.SetOwner("alice");
+  id.SetName("house \"two\"");
+  id.SetVersion(5);
+  ids.push_back(id);
+
+  std::ostringstream out;
+  EXPECT_TRUE(JSONParser::WriteWorlds(WorldIterFactory::Create(ids), out));
+  EXPECT_EQ("[{\"name\":\"house \\\"two\\\"\",\"owner\":\"alice\","
+      "\"version\":5}]", out.str());
+
+  ServerConfig srv;
+  auto parsed = JSONParser::ParseWorlds(out.str(), srv);
+  ASSERT_EQ(1u, parsed.size());
+  EXPECT_EQ(id.Name(), parsed[0].Name());
+}
+
 /////////////////////////////////////////////////
 TEST(JSONParser, ParseWorld)
 {
@@ -16,17 +16,26 @@
 */
 
 #ifndef _WIN32
+  #include <fcntl.h>
   #include <unistd.h>
 #endif
 
 #include <stdio.h>
+#include <sys/stat.h>
 #include <tinyxml2.h>
 
 #include <algorithm>
-#include <fstream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
 #include <memory>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -38,13 +47,20 @@
 #include "gz/fuel_tools/Helpers.hh"
 #include "gz/fuel_tools/Zip.hh"
 
+#include "FileClone.hh"
+#include "FileSync.hh"
 #include "ModelPrivate.hh"
 #include "ModelIterPrivate.hh"
+#include "Sha256.hh"
 #include "WorldIterPrivate.hh"
 #include "LocalCache.hh"
 
 namespace gz::fuel_tools
 {
+/// \brief Staging entries left untouched for longer were abandoned by a
+/// client that crashed or was killed.
+static constexpr std::chrono::hours kStaleStagingAge{1};
+
 class LocalCachePrivate
 {
   /// \brief return all models in a given directory
@@ -59,6 +75,73 @@ class LocalCachePrivate
   /// \brief return all models in a given Owner/models directory
   public: std::vector<Model> ModelsInPath(const std::string &_path);
 
+  /// \brief Add a model to the local cache.
+  /// \param[in] _id A completely populated ID
+  /// \param[in] _data Compressed content of the model, used when _zipPath
+  /// is empty.
+  /// \param[in] _zipPath Archive on disk holding the model, removed once
+  /// extracted.
+  /// \param[in] _overwrite Overwrite model if already exists.
+  /// \return True if the model was successfully added.
+  public: bool SaveModel(const ModelIdentifier &_id,
+              const std::string &_data, const std::string &_zipPath,
+              const bool _overwrite);
+
+  /// \brief Add a world to the local cache.
+  /// \param[out] _id A completely populated ID
+  /// \param[in] _data Compressed content of the world, used when _zipPath
+  /// is empty.
+  /// \param[in] _zipPath Archive on disk holding the world, removed once
+  /// extracted.
+  /// \param[in] _overwrite Overwrite world if already exists.
+  /// \return True if the world was successfully added.
+  public: bool SaveWorld(WorldIdentifier &_id,
+              const std::string &_data, const std::string &_zipPath,
+              const bool _overwrite);
+
+  /// \brief Get a new directory to extract a resource to before publishing
+  /// it. It's in the cache, so that publishing is a rename.
+  /// \return Path of a directory that doesn't exist yet.
+  public: std::string StagingPath() const;
+
+  /// \brief Remove the stale entries of the staging directory, see
+  /// kStaleStagingAge.
+  public: void SweepStaging() const;
+
+  /// \brief Extract an archive, flushing the files if the durability
+  /// policy is strict.
+  /// \param[in] _data Compressed content, used when _zipPath is empty.
+  /// \param[in] _zipPath Archive on disk.
+  /// \param[in] _dir Directory to extract to.
+  /// \param[out] _hashes Digests of the extracted files.
+  /// \return True on success.
+  public: bool Extract(const std::string &_data, const std::string &_zipPath,
+              const std::string &_dir,
+              std::map<std::string, std::string> &_hashes);
+
+  /// \brief Get the path of the manifest of a resource. It's next to the
+  /// versioned directory, so that it isn't part of the resource.
+  /// \param[in] _dir Versioned directory of the resource.
+  /// \return Path of the manifest.
+  public: static std::string ManifestPath(const std::string &_dir);
+
+  /// \brief Check whether a resource directory holds a version.
+  /// \param[in] _dir Directory of the resource, containing a directory per
+  /// version.
+  /// \param[in] _version Version to look for, 0 for any version.
+  /// \return True if the version is cached.
+  public: static bool HasVersion(const std::string &_dir,
+              unsigned int _version);
+
+  /// \brief Flush an extracted resource according to the durability
+  /// policy, then move it to its place in the cache, replacing the previous
+  /// content if any.
+  /// \param[in] _stagingDir Directory holding the resource.
+  /// \param[in] _dir Final directory of the resource.
+  /// \return True on success.
+  public: bool Publish(const std::string &_stagingDir,
+              const std::string &_dir);
+
   /// \brief Associate model:// URI paths with Fuel URLs.
   /// \param[in] _modelVersionedDir Directory containing the model.
   /// \param[in] _id Model's Fuel URL.
@@ -216,6 +299,8 @@ LocalCache::LocalCache(const ClientConfig *_config)
   : dataPtr(new LocalCachePrivate)
 {
   this->dataPtr->config = _config;
+  if (this->dataPtr->config)
+    this->dataPtr->SweepStaging();
 }
 
 //////////////////////////////////////////////////
@@ -391,6 +476,164 @@ WorldIter LocalCache::MatchingWorlds(const WorldIdentifier &_id) const
 //////////////////////////////////////////////////
 bool LocalCache::SaveModel(
   const ModelIdentifier &_id, const std::string &_data, const bool _overwrite)
+{
+  return this->dataPtr->SaveModel(_id, _data, "", _overwrite);
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::SaveModelArchive(const ModelIdentifier &_id,
+    const std::string &_zipPath, const bool _overwrite)
+{
+  return this->dataPtr->SaveModel(_id, "", _zipPath, _overwrite);
+}
+
+//////////////////////////////////////////////////
+std::string uniqueCacheName()
+{
+  static std::atomic<std::uint64_t> count{0};
+  std::ostringstream name;
+  name << std::chrono::system_clock::now().time_since_epoch().count() << "-"
+       << std::hash<std::thread::id>{}(std::this_thread::get_id()) << "-"
+       << count++;
+  return name.str();
+}
+
+//////////////////////////////////////////////////
+std::string LocalCachePrivate::StagingPath() const
+{
+  return common::joinPaths(this->config->CacheLocation(), ".staging",
+      uniqueCacheName());
+}
+
+//////////////////////////////////////////////////
+void LocalCachePrivate::SweepStaging() const
+{
+  const std::string dir =
+    common::joinPaths(this->config->CacheLocation(), ".staging");
+  if (!common::isDirectory(dir))
+    return;
+
+  // Other clients may be extracting to the staging directory right now,
+  // only the entries nobody touched for a while are removed.
+  const auto now = std::chrono::system_clock::now();
+  std::vector<std::string> stale;
+  common::DirIter end;
+  for (common::DirIter entry(dir); entry != end; ++entry)
+  {
+    struct stat st;
+    if (stat((*entry).c_str(), &st) == 0 &&
+        now - std::chrono::system_clock::from_time_t(st.st_mtime) >
+          kStaleStagingAge)
+    {
+      stale.push_back(*entry);
+    }
+  }
+
+  for (const auto &path : stale)
+  {
+    gzdbg << "Removing stale staging entry [" << path << "]" << std::endl;
+    common::removeAll(path);
+  }
+}
+
+//////////////////////////////////////////////////
+bool LocalCachePrivate::Extract(const std::string &_data,
+    const std::string &_zipPath, const std::string &_dir,
+    std::map<std::string, std::string> &_hashes)
+{
+  if (!common::createDirectories(_dir))
+  {
+    gzerr << "Unable to create directory [" << _dir << "]" << std::endl;
+    return false;
+  }
+
+  // Archives already on disk are mapped and extracted in place, archives
+  // in memory are extracted without a round trip through a file.
+  const bool sync = this->config->Durability() == DurabilityPolicy::PER_FILE;
+  return _zipPath.empty() ?
+    Zip::ExtractBuffer(_data.data(), _data.size(), _dir, sync, &_hashes) :
+    Zip::Extract(_zipPath, _dir, sync, &_hashes);
+}
+
+//////////////////////////////////////////////////
+std::string LocalCachePrivate::ManifestPath(const std::string &_dir)
+{
+  return _dir + ".sha256";
+}
+
+//////////////////////////////////////////////////
+bool LocalCachePrivate::Publish(const std::string &_stagingDir,
+    const std::string &_dir)
+{
+  // Files were flushed as they were written in per-file mode, only the
+  // directories are left.
+  const DurabilityPolicy durability = this->config->Durability();
+  if ((durability == DurabilityPolicy::BATCHED &&
+       !syncFilesystem(_stagingDir)) ||
+      (durability == DurabilityPolicy::PER_FILE &&
+       !syncDirectories(_stagingDir)))
+  {
+    gzerr << "Unable to flush [" << _stagingDir << "]" << std::endl;
+    return false;
+  }
+
+  const std::string parentDir = common::parentPath(_dir);
+  if (!common::createDirectories(parentDir))
+  {
+    gzerr << "Unable to create directory [" << parentDir << "]"
+          << std::endl;
+    return false;
+  }
+
+  bool published = false;
+  if (common::exists(_dir))
+  {
+#ifdef RENAME_EXCHANGE
+    // Swap both directories atomically, the staging directory then holds
+    // the previous content.
+    if (renameat2(AT_FDCWD, _stagingDir.c_str(), AT_FDCWD, _dir.c_str(),
+          RENAME_EXCHANGE) == 0)
+    {
+      common::removeAll(_stagingDir);
+      published = true;
+    }
+#endif
+    if (!published)
+    {
+      // Move the previous content aside, the resource is briefly missing.
+      const std::string previousDir = this->StagingPath();
+      if (std::rename(_dir.c_str(), previousDir.c_str()) == 0)
+      {
+        published = std::rename(_stagingDir.c_str(), _dir.c_str()) == 0;
+        if (published)
+          common::removeAll(previousDir);
+        else
+          std::rename(previousDir.c_str(), _dir.c_str());
+      }
+    }
+  }
+  else
+  {
+    published = std::rename(_stagingDir.c_str(), _dir.c_str()) == 0;
+  }
+
+  if (!published)
+  {
+    gzerr << "Unable to move [" << _stagingDir << "] to [" << _dir << "]"
+          << std::endl;
+    return false;
+  }
+
+  // Persist the rename.
+  if (durability != DurabilityPolicy::NONE)
+    return syncDirectory(parentDir);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LocalCachePrivate::SaveModel(const ModelIdentifier &_id,
+    const std::string &_data, const std::string &_zipPath,
+    const bool _overwrite)
 {
   if (_id.Server().Url().Str().empty() || _id.Owner().empty() ||
       _id.Name().empty() || _id.Version() == 0)
@@ -400,7 +643,7 @@ bool LocalCache::SaveModel(
     return false;
   }
 
-  std::string cacheLocation = this->dataPtr->config->CacheLocation();
+  std::string cacheLocation = this->config->CacheLocation();
 
   std::string modelRootDir = common::joinPaths(cacheLocation,
                                                _id.UniqueName());
@@ -416,35 +659,37 @@ bool LocalCache::SaveModel(
     return false;
   }
 
-  // Create the model directory.
-  if (!common::createDirectories(modelVersionedDir))
+  // Extract to a staging directory, so that the cache never holds a
+  // partially extracted model.
+  const std::string stagingDir = this->StagingPath();
+  std::map<std::string, std::string> hashes;
+  if (!this->Extract(_data, _zipPath, stagingDir, hashes))
   {
-    gzerr << "Unable to create directory [" << modelVersionedDir << "]"
-           << std::endl;
+    gzerr << "Unable to unzip ["
+          << (_zipPath.empty() ? _id.Name() + ".zip" : _zipPath) << "]"
+          << std::endl;
+    common::removeAll(stagingDir);
+    return false;
   }
 
-  auto zipFile = common::joinPaths(modelVersionedDir, _id.Name() + ".zip");
-#ifdef _WIN32
-  std::ofstream ofs(zipFile, std::ofstream::out | std::ofstream::binary);
-#else
-  std::ofstream ofs(zipFile, std::ofstream::out);
-#endif
-  ofs << _data;
-  ofs.close();
+  // Convert model:// URIs to Fuel URLs
+  this->FixPaths(stagingDir, _id);
 
-  if (!Zip::Extract(zipFile, modelVersionedDir))
+  if (!this->Publish(stagingDir, modelVersionedDir))
   {
-    gzerr << "Unable to unzip [" << zipFile << "]" << std::endl;
+    common::removeAll(stagingDir);
     return false;
   }
 
-  // Convert model:// URIs to Fuel URLs
-  this->dataPtr->FixPaths(modelVersionedDir, _id);
+  // The digests were computed during the extraction, a missing manifest
+  // only costs the users of the digests.
+  writeSha256Manifest(this->ManifestPath(modelVersionedDir), hashes,
+      this->config->Durability() != DurabilityPolicy::NONE);
 
   // Cleanup the zip file.
-  if (!common::removeDirectoryOrFile(zipFile))
+  if (!_zipPath.empty() && !common::removeDirectoryOrFile(_zipPath))
   {
-    gzwarn << "Unable to remove [" << zipFile << "]" << std::endl;
+    gzwarn << "Unable to remove [" << _zipPath << "]" << std::endl;
   }
 
   return true;
@@ -590,6 +835,9 @@ bool LocalCachePrivate::FixPaths(const std::string &_modelVersionedDir,
   }
   modelSdfDoc.SaveFile(modelSdfFilePath.c_str());
 
+  // Flushed like the extracted files, see Extract.
+  if (this->config->Durability() == DurabilityPolicy::PER_FILE)
+    return syncFile(modelSdfFilePath);
   return true;
 }
 
@@ -746,6 +994,21 @@ void LocalCachePrivate::FixPathsInGeomElement(tinyxml2::XMLElement *_geomElem,
 //////////////////////////////////////////////////
 bool LocalCache::SaveWorld(
   WorldIdentifier &_id, const std::string &_data, const bool _overwrite)
+{
+  return this->dataPtr->SaveWorld(_id, _data, "", _overwrite);
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::SaveWorldArchive(WorldIdentifier &_id,
+    const std::string &_zipPath, const bool _overwrite)
+{
+  return this->dataPtr->SaveWorld(_id, "", _zipPath, _overwrite);
+}
+
+//////////////////////////////////////////////////
+bool LocalCachePrivate::SaveWorld(WorldIdentifier &_id,
+    const std::string &_data, const std::string &_zipPath,
+    const bool _overwrite)
 {
   if (!_id.Server().Url().Valid() || _id.Owner().empty() ||
       _id.Name().empty() || _id.Version() == 0)
@@ -755,7 +1018,7 @@ bool LocalCache::SaveWorld(
     return false;
   }
 
-  auto cacheLocation = this->dataPtr->config->CacheLocation();
+  auto cacheLocation = this->config->CacheLocation();
   auto worldRootDir = common::joinPaths(cacheLocation, _id.UniqueName());
   auto worldVersionedDir = common::joinPaths(worldRootDir, _id.VersionStr());
 
@@ -767,31 +1030,33 @@ bool LocalCache::SaveWorld(
     return false;
   }
 
-  // Create the world directory.
-  if (!common::createDirectories(worldVersionedDir))
+  // Extract to a staging directory, so that the cache never holds a
+  // partially extracted world.
+  const std::string stagingDir = this->StagingPath();
+  std::map<std::string, std::string> hashes;
+  if (!this->Extract(_data, _zipPath, stagingDir, hashes))
   {
-    gzerr << "Unable to create directory [" << worldVersionedDir << "]"
-           << std::endl;
+    gzerr << "Unable to unzip ["
+          << (_zipPath.empty() ? _id.Name() + ".zip" : _zipPath) << "]"
+          << std::endl;
+    common::removeAll(stagingDir);
+    return false;
   }
 
-  auto zipFile = common::joinPaths(worldVersionedDir, _id.Name() + ".zip");
-  #ifdef _WIN32
-    std::ofstream ofs(zipFile, std::ofstream::out | std::ofstream::binary);
-  #else
-    std::ofstream ofs(zipFile, std::ofstream::out);
-  #endif
-  ofs << _data;
-  ofs.close();
-
-  if (!Zip::Extract(zipFile, worldVersionedDir))
+  if (!this->Publish(stagingDir, worldVersionedDir))
   {
-    gzerr << "Unable to unzip [" << zipFile << "]" << std::endl;
+    common::removeAll(stagingDir);
     return false;
   }
 
-  if (!common::removeDirectoryOrFile(zipFile))
+  // The digests were computed during the extraction, a missing manifest
+  // only costs the users of the digests.
+  writeSha256Manifest(this->ManifestPath(worldVersionedDir), hashes,
+      this->config->Durability() != DurabilityPolicy::NONE);
+
+  if (!_zipPath.empty() && !common::removeDirectoryOrFile(_zipPath))
   {
-    gzwarn << "Unable to remove [" << zipFile << "]" << std::endl;
+    gzwarn << "Unable to remove [" << _zipPath << "]" << std::endl;
   }
 
   _id.SetLocalPath(worldVersionedDir);
@@ -800,4 +1065,107 @@ bool LocalCache::SaveWorld(
 
   return true;
 }
+//////////////////////////////////////////////////
+bool LocalCache::ExportModel(const ModelIdentifier &_id,
+    const std::string &_dst)
+{
+  Model model = this->MatchingModel(_id);
+  if (!model)
+  {
+    gzerr << "Model not found in the cache:" << std::endl << _id.AsString();
+    return false;
+  }
+
+  // The exported files may be edited, so they can't be hard links into the
+  // cache.
+  if (!cloneDirectory(model.PathToModel(), _dst))
+  {
+    gzerr << "Unable to export model to [" << _dst << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::ExportWorld(const WorldIdentifier &_id,
+    const std::string &_dst)
+{
+  WorldIdentifier id = _id;
+  if (!this->MatchingWorld(id))
+  {
+    gzerr << "World not found in the cache:" << std::endl << _id.AsString();
+    return false;
+  }
+
+  if (!cloneDirectory(id.LocalPath(), _dst))
+  {
+    gzerr << "Unable to export world to [" << _dst << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::ModelManifest(const ModelIdentifier &_id,
+    std::map<std::string, std::string> &_hashes)
+{
+  Model model = this->MatchingModel(_id);
+  return model && readSha256Manifest(
+      this->dataPtr->ManifestPath(model.PathToModel()), _hashes);
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::WorldManifest(const WorldIdentifier &_id,
+    std::map<std::string, std::string> &_hashes)
+{
+  WorldIdentifier id = _id;
+  return this->MatchingWorld(id) && readSha256Manifest(
+      this->dataPtr->ManifestPath(id.LocalPath()), _hashes);
+}
+
+//////////////////////////////////////////////////
+bool LocalCachePrivate::HasVersion(const std::string &_dir,
+    unsigned int _version)
+{
+  if (_version > 0)
+    return common::isDirectory(
+        common::joinPaths(_dir, std::to_string(_version)));
+
+  if (!common::isDirectory(_dir))
+    return false;
+
+  common::DirIter end;
+  for (common::DirIter versionIter(_dir); versionIter != end; ++versionIter)
+  {
+    const std::string version = common::basename(*versionIter);
+    if (common::isDirectory(*versionIter) && !version.empty() &&
+        std::all_of(version.begin(), version.end(), ::isdigit))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::HasModel(const ModelIdentifier &_id) const
+{
+  if (!this->dataPtr->config || _id.Owner().empty() || _id.Name().empty())
+    return false;
+
+  return this->dataPtr->HasVersion(common::joinPaths(
+      this->dataPtr->config->CacheLocation(), _id.UniqueName()),
+      _id.Version());
+}
+
+//////////////////////////////////////////////////
+bool LocalCache::HasWorld(const WorldIdentifier &_id) const
+{
+  if (!this->dataPtr->config || _id.Owner().empty() || _id.Name().empty())
+    return false;
+
+  return this->dataPtr->HasVersion(common::joinPaths(
+      this->dataPtr->config->CacheLocation(), _id.UniqueName()),
+      _id.Version());
+}
 }  // namespace gz::fuel_tools
@@ -18,6 +18,7 @@
 #ifndef GZ_FUEL_TOOLS_LOCALCACHE_HH_
 #define GZ_FUEL_TOOLS_LOCALCACHE_HH_
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -92,6 +93,17 @@ namespace gz::fuel_tools
         const std::string &_data,
         const bool _overwrite);
 
+    /// \brief Add a model from an archive on disk to the local cache. The
+    /// archive is extracted in place and removed afterwards.
+    /// \param[in] _id A completely populated ID
+    /// \param[in] _zipPath Path to the compressed model
+    /// \param[in] _overwrite Overwrite model if already exists.
+    /// \returns True if the model was successfully added to the local cache.
+    public: virtual bool SaveModelArchive(
+        const ModelIdentifier &_id,
+        const std::string &_zipPath,
+        const bool _overwrite);
+
     /// \brief Add a world from packed data to the local cache
     /// \param[out] _id A completely populated ID
     /// \param[in] _data Compressed content of the world
@@ -102,9 +114,80 @@ namespace gz::fuel_tools
         const std::string &_data,
         const bool _overwrite);
 
+    /// \brief Add a world from an archive on disk to the local cache. The
+    /// archive is extracted in place and removed afterwards.
+    /// \param[out] _id A completely populated ID
+    /// \param[in] _zipPath Path to the compressed world
+    /// \param[in] _overwrite Overwrite world if already exists.
+    /// \returns True if the world was successfully added to the local cache
+    public: virtual bool SaveWorldArchive(
+        WorldIdentifier &_id,
+        const std::string &_zipPath,
+        const bool _overwrite);
+
+    /// \brief Copy a cached model to a directory outside the cache. Files
+    /// are cloned, which is nearly free on filesystems supporting reflinks.
+    /// \param[in] _id Model to export. The tip is exported if the version
+    /// isn't set.
+    /// \param[in] _dst Destination directory, created if needed.
+    /// \returns True if the model was cached and all its files were copied.
+    public: virtual bool ExportModel(
+        const ModelIdentifier &_id,
+        const std::string &_dst);
+
+    /// \brief Copy a cached world to a directory outside the cache. Files
+    /// are cloned, which is nearly free on filesystems supporting reflinks.
+    /// \param[in] _id World to export. The tip is exported if the version
+    /// isn't set.
+    /// \param[in] _dst Destination directory, created if needed.
+    /// \returns True if the world was cached and all its files were copied.
+    public: virtual bool ExportWorld(
+        const WorldIdentifier &_id,
+        const std::string &_dst);
+
+    /// \brief Get the SHA-256 digests of the files of a cached model, as
+    /// they were in its archive. They are computed while the archive is
+    /// extracted, so model.config may differ after its URIs were fixed.
+    /// \param[in] _id Model to look up. The tip is used if the version
+    /// isn't set.
+    /// \param[out] _hashes Hexadecimal digests by file path.
+    /// \returns False if the model isn't cached or has no manifest.
+    public: virtual bool ModelManifest(const ModelIdentifier &_id,
+        std::map<std::string, std::string> &_hashes);
+
+    /// \brief Get the SHA-256 digests of the files of a cached world, as
+    /// they were in its archive.
+    /// \param[in] _id World to look up. The tip is used if the version
+    /// isn't set.
+    /// \param[out] _hashes Hexadecimal digests by file path.
+    /// \returns False if the world isn't cached or has no manifest.
+    public: virtual bool WorldManifest(const WorldIdentifier &_id,
+        std::map<std::string, std::string> &_hashes);
+
+    /// \brief Check whether a model is cached, without scanning the rest
+    /// of the cache.
+    /// \param[in] _id Model to look up. If the version isn't set, any
+    /// cached version counts.
+    /// \returns True if the model is cached.
+    public: virtual bool HasModel(const ModelIdentifier &_id) const;
+
+    /// \brief Check whether a world is cached, without scanning the rest
+    /// of the cache.
+    /// \param[in] _id World to look up. If the version isn't set, any
+    /// cached version counts.
+    /// \returns True if the world is cached.
+    public: virtual bool HasWorld(const WorldIdentifier &_id) const;
+
     /// \brief Internal data.
     private: std::shared_ptr<LocalCachePrivate> dataPtr;
   };
+
+  /// \brief Get a name for a temporary entry of the cache, such as a
+  /// staging directory or an archive streamed to disk. The name is unique
+  /// among the clients sharing the cache, as well as within this one.
+  /// \return Name made of a timestamp, a hash of the thread and a counter.
+  GZ_FUEL_TOOLS_VISIBLE
+  std::string uniqueCacheName();
 }  // namespace gz::fuel_tools
 
 #ifdef _MSC_VER
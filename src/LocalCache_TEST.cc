@@ -17,8 +17,15 @@
 
 #include <gtest/gtest.h>
 
+#ifndef _WIN32
+#include <utime.h>
+#endif
+
+#include <ctime>
 #include <fstream>
+#include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -28,8 +35,10 @@
 #include "gz/fuel_tools/ClientConfig.hh"
 #include "gz/fuel_tools/Helpers.hh"
 #include "gz/fuel_tools/WorldIdentifier.hh"
+#include "gz/fuel_tools/Zip.hh"
 
 #include "LocalCache.hh"
+#include "Sha256.hh"
 
 using namespace gz;
 using namespace fuel_tools;
@@ -457,3 +466,167 @@ TEST_F(LocalCacheTest, MatchingWorld)
   bogus3.SetName("tm3");
   EXPECT_FALSE(cache.MatchingWorld(bogus3));
 }
+
+/////////////////////////////////////////////////
+/// \brief Export cached resources out of the cache
+TEST_F(LocalCacheTest, Export)
+{
+  ClientConfig conf;
+  conf.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  createLocal6Models(conf);
+  createLocal6Worlds(conf);
+
+  gz::fuel_tools::LocalCache cache(&conf);
+
+  gz::fuel_tools::ServerConfig srv1;
+  srv1.SetUrl(common::URI("http://localhost:8001/", true));
+
+  ModelIdentifier am1;
+  am1.SetServer(srv1);
+  am1.SetOwner("alice");
+  am1.SetName("am1");
+  EXPECT_TRUE(cache.ExportModel(am1, "exported_model"));
+  EXPECT_TRUE(common::isFile(
+      common::joinPaths("exported_model", "model.config")));
+
+  WorldIdentifier am1World;
+  am1World.SetServer(srv1);
+  am1World.SetOwner("alice");
+  am1World.SetName("am1");
+  EXPECT_TRUE(cache.ExportWorld(am1World, "exported_world"));
+  EXPECT_TRUE(common::isFile(
+      common::joinPaths("exported_world", "world.world")));
+
+  ModelIdentifier bogus;
+  bogus.SetServer(srv1);
+  bogus.SetOwner("trudy");
+  bogus.SetName("tm3");
+  EXPECT_FALSE(cache.ExportModel(bogus, "exported_bogus"));
+  EXPECT_FALSE(common::exists("exported_bogus"));
+}
+
+/////////////////////////////////////////////////
+/// \brief Save models with each durability policy
+TEST_F(LocalCacheTest, SaveModelDurability)
+{
+  ClientConfig conf;
+  conf.Clear();
+  conf.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+
+  // Archive holding a model.config at its root.
+  {
+    std::ofstream fout("model.config");
+    fout << "<?xml version=\"1.0\"?><model><sdf version=\"1.6\">"
+         << "model.sdf</sdf></model>";
+  }
+  ASSERT_TRUE(Zip::Compress("model.config", "model.zip"));
+  std::ifstream in("model.zip", std::ios::binary);
+  std::stringstream data;
+  data << in.rdbuf();
+
+  gz::fuel_tools::ServerConfig srv;
+  srv.SetUrl(common::URI("http://localhost:8001/", true));
+
+  for (auto policy : {DurabilityPolicy::NONE, DurabilityPolicy::BATCHED,
+      DurabilityPolicy::PER_FILE})
+  {
+    conf.SetDurability(policy);
+    gz::fuel_tools::LocalCache cache(&conf);
+
+    ModelIdentifier id;
+    id.SetServer(srv);
+    id.SetOwner("alice");
+    id.SetName("durable" + std::to_string(static_cast<int>(policy)));
+    id.SetVersion(1);
+
+    EXPECT_TRUE(cache.SaveModel(id, data.str(), false));
+    EXPECT_FALSE(cache.SaveModel(id, data.str(), false));
+    EXPECT_TRUE(cache.SaveModel(id, data.str(), true));
+
+    Model model = cache.MatchingModel(id);
+    ASSERT_TRUE(model);
+    EXPECT_TRUE(common::isFile(
+        common::joinPaths(model.PathToModel(), "model.config")));
+
+    // Nothing is left behind in the staging area.
+    common::DirIter end;
+    common::DirIter staging(common::joinPaths("test_cache", ".staging"));
+    EXPECT_FALSE(staging != end);
+  }
+}
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+/// \brief Staging entries abandoned by another client are removed
+TEST_F(LocalCacheTest, SweepStaging)
+{
+  ClientConfig conf;
+  conf.Clear();
+  conf.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+
+  const auto staging = common::joinPaths("test_cache", ".staging");
+  const auto stale = common::joinPaths(staging, uniqueCacheName());
+  const auto fresh = common::joinPaths(staging, uniqueCacheName());
+  EXPECT_NE(stale, fresh);
+  ASSERT_TRUE(common::createDirectories(common::joinPaths(stale, "meshes")));
+  ASSERT_TRUE(common::createDirectories(fresh));
+
+  // Left untouched for two hours.
+  struct utimbuf times;
+  times.actime = times.modtime = std::time(nullptr) - 2 * 3600;
+  ASSERT_EQ(0, utime(stale.c_str(), &times));
+
+  gz::fuel_tools::LocalCache cache(&conf);
+  EXPECT_FALSE(common::exists(stale));
+  EXPECT_TRUE(common::isDirectory(fresh));
+}
+#endif
+
+/////////////////////////////////////////////////
+/// \brief Saved models have a manifest of the digests of their files
+TEST_F(LocalCacheTest, ModelManifest)
+{
+  ClientConfig conf;
+  conf.Clear();
+  conf.SetCacheLocation(common::joinPaths(common::cwd(), "test_cache"));
+  gz::fuel_tools::LocalCache cache(&conf);
+
+  const std::string config = "<?xml version=\"1.0\"?><model><sdf "
+    "version=\"1.6\">model.sdf</sdf></model>";
+  std::ofstream("model.config") << config;
+  ASSERT_TRUE(Zip::Compress("model.config", "model.zip"));
+  std::ifstream in("model.zip", std::ios::binary);
+  std::stringstream data;
+  data << in.rdbuf();
+
+  gz::fuel_tools::ServerConfig srv;
+  srv.SetUrl(common::URI("http://localhost:8001/", true));
+  ModelIdentifier id;
+  id.SetServer(srv);
+  id.SetOwner("alice");
+  id.SetName("hashed");
+  id.SetVersion(1);
+
+  std::map<std::string, std::string> hashes;
+  EXPECT_FALSE(cache.ModelManifest(id, hashes));
+
+  ASSERT_TRUE(cache.SaveModel(id, data.str(), false));
+  ASSERT_TRUE(cache.ModelManifest(id, hashes));
+  ASSERT_EQ(1u, hashes.size());
+  EXPECT_EQ(Sha256::Hex(Sha256::Hash(config.data(), config.size())),
+      hashes["model.config"]);
+
+  // The manifest isn't mistaken for a version.
+  id.SetVersionStr("tip");
+  Model model = cache.MatchingModel(id);
+  ASSERT_TRUE(model);
+  EXPECT_EQ(1u, model.Identification().Version());
+  EXPECT_TRUE(cache.HasModel(id));
+
+  id.SetVersion(1);
+  EXPECT_TRUE(cache.HasModel(id));
+  id.SetVersion(2);
+  EXPECT_FALSE(cache.HasModel(id));
+  id.SetName("missing");
+  EXPECT_FALSE(cache.HasModel(id));
+}
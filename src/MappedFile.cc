@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+#include <gz/common/Console.hh>
+
+#include "MappedFile.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Private data class
+class MappedFilePrivate
+{
+  /// \brief Start of the mapping, null if the file isn't mapped.
+  public: void *data = nullptr;
+
+  /// \brief Size of the mapping.
+  public: std::size_t size = 0;
+};
+
+//////////////////////////////////////////////////
+MappedFile::MappedFile(const std::string &_path)
+  : dataPtr(new MappedFilePrivate)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    gzerr << "Unable to open [" << _path << "]" << std::endl;
+    return;
+  }
+
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+  {
+    HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping)
+    {
+      this->dataPtr->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (this->dataPtr->data)
+        this->dataPtr->size = static_cast<std::size_t>(size.QuadPart);
+      // The view keeps the mapping alive.
+      CloseHandle(mapping);
+    }
+  }
+  CloseHandle(file);
+#else
+  int fd = open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    gzerr << "Unable to open [" << _path << "]" << std::endl;
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED)
+    {
+      this->dataPtr->data = data;
+      this->dataPtr->size = st.st_size;
+    }
+  }
+  // The mapping stays valid once the descriptor is closed.
+  close(fd);
+#endif
+
+  if (!this->dataPtr->data)
+    gzerr << "Unable to map [" << _path << "]" << std::endl;
+}
+
+//////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+  if (!this->dataPtr->data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(this->dataPtr->data);
+#else
+  munmap(this->dataPtr->data, this->dataPtr->size);
+#endif
+}
+
+//////////////////////////////////////////////////
+bool MappedFile::Valid() const
+{
+  return this->dataPtr->data != nullptr;
+}
+
+//////////////////////////////////////////////////
+const char *MappedFile::Data() const
+{
+  return static_cast<const char *>(this->dataPtr->data);
+}
+
+//////////////////////////////////////////////////
+std::size_t MappedFile::Size() const
+{
+  return this->dataPtr->size;
+}
+}  // namespace gz::fuel_tools
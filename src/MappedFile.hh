@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_MAPPEDFILE_HH_
+#define GZ_FUEL_TOOLS_MAPPEDFILE_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class MappedFilePrivate;
+
+  /// \brief Read-only memory mapping of a whole file.
+  ///
+  /// The content is paged in on demand by the kernel instead of being
+  /// copied through stream buffers, and a single mapping can be shared by
+  /// several readers, e.g. through a std::shared_ptr<const MappedFile>.
+  /// The file must not be truncated while it is mapped.
+  class GZ_FUEL_TOOLS_VISIBLE MappedFile
+  {
+    /// \brief Map a file.
+    /// \param[in] _path Path of the file.
+    public: explicit MappedFile(const std::string &_path);
+
+    /// \brief Destructor. Unmaps the file.
+    public: ~MappedFile();
+
+    /// \brief Not copyable, the mapping is owned.
+    public: MappedFile(const MappedFile &) = delete;
+
+    /// \brief Not copyable, the mapping is owned.
+    public: MappedFile &operator=(const MappedFile &) = delete;
+
+    /// \brief Get whether the file was mapped. Empty files can't be
+    /// mapped.
+    /// \return True if Data() points to the content of the file.
+    public: bool Valid() const;
+
+    /// \brief Get the content of the file.
+    /// \return Pointer to the first byte, null if the mapping failed.
+    public: const char *Data() const;
+
+    /// \brief Get the size of the file.
+    /// \return Size in bytes, 0 if the mapping failed.
+    public: std::size_t Size() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<MappedFilePrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_MAPPEDFILE_HH_
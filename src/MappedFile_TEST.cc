@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "MappedFile.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class MappedFileTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(MappedFileTest, MapFile)
+{
+  std::string content;
+  for (int i = 0; i < 100000; ++i)
+    content.push_back(static_cast<char>(i % 251));
+
+  const std::string path = common::joinPaths(this->tempDir->Path(), "file");
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << content;
+  }
+
+  auto file = std::make_shared<const MappedFile>(path);
+  ASSERT_TRUE(file->Valid());
+  ASSERT_EQ(content.size(), file->Size());
+  EXPECT_EQ(content, std::string(file->Data(), file->Size()));
+
+  // Readers on several threads share the mapping.
+  std::vector<std::thread> readers;
+  std::vector<int> matches(4, 0);
+  for (std::size_t i = 0; i < matches.size(); ++i)
+  {
+    readers.emplace_back([file, &content, &matches, i]()
+    {
+      matches[i] = std::string(file->Data(), file->Size()) == content;
+    });
+  }
+  for (auto &reader : readers)
+    reader.join();
+  for (int match : matches)
+    EXPECT_TRUE(match);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MappedFileTest, Invalid)
+{
+  MappedFile missing(common::joinPaths(this->tempDir->Path(), "missing"));
+  EXPECT_FALSE(missing.Valid());
+  EXPECT_EQ(nullptr, missing.Data());
+  EXPECT_EQ(0u, missing.Size());
+
+  const std::string path = common::joinPaths(this->tempDir->Path(), "empty");
+  std::ofstream(path).close();
+  MappedFile empty(path);
+  EXPECT_FALSE(empty.Valid());
+  EXPECT_EQ(0u, empty.Size());
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "MemoryCache.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Private data class
+class MemoryCachePrivate
+{
+  /// \brief Evict files until the cache holds at most a number of bytes.
+  /// \param[in] _bytes Number of bytes to stay within.
+  public: void EvictTo(std::uint64_t _bytes)
+          {
+            while (this->stats.bytes > _bytes && !this->lru.empty())
+            {
+              auto &entry = this->lru.back();
+              this->stats.bytes -= entry.second.Size();
+              this->index.erase(entry.first);
+              this->lru.pop_back();
+              ++this->stats.evictions;
+            }
+            this->stats.entries = this->lru.size();
+          }
+
+  /// \brief Protects the members.
+  public: mutable std::mutex mutex;
+
+  /// \brief Budget in bytes.
+  public: std::uint64_t budget = 0;
+
+  /// \brief Files by key, most recently used first.
+  public: std::list<std::pair<std::string, FileView>> lru;
+
+  /// \brief Position of each file in lru.
+  public: std::unordered_map<std::string,
+          std::list<std::pair<std::string, FileView>>::iterator> index;
+
+  /// \brief Statistics.
+  public: MemoryCacheStats stats;
+};
+
+//////////////////////////////////////////////////
+MemoryCache::MemoryCache()
+  : dataPtr(new MemoryCachePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+MemoryCache::~MemoryCache() = default;
+
+//////////////////////////////////////////////////
+void MemoryCache::SetBudget(std::uint64_t _bytes)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->budget = _bytes;
+  this->dataPtr->EvictTo(_bytes);
+}
+
+//////////////////////////////////////////////////
+std::uint64_t MemoryCache::Budget() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->budget;
+}
+
+//////////////////////////////////////////////////
+FileView MemoryCache::Get(const std::string &_key)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->budget == 0)
+    return FileView();
+
+  auto it = this->dataPtr->index.find(_key);
+  if (it == this->dataPtr->index.end())
+  {
+    ++this->dataPtr->stats.misses;
+    return FileView();
+  }
+
+  ++this->dataPtr->stats.hits;
+  this->dataPtr->lru.splice(this->dataPtr->lru.begin(), this->dataPtr->lru,
+      it->second);
+  return it->second->second;
+}
+
+//////////////////////////////////////////////////
+void MemoryCache::Put(const std::string &_key, const FileView &_view)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (!_view || _view.Size() > this->dataPtr->budget)
+    return;
+
+  auto it = this->dataPtr->index.find(_key);
+  if (it != this->dataPtr->index.end())
+  {
+    this->dataPtr->stats.bytes -= it->second->second.Size();
+    this->dataPtr->lru.erase(it->second);
+    this->dataPtr->index.erase(it);
+  }
+
+  this->dataPtr->EvictTo(this->dataPtr->budget - _view.Size());
+  this->dataPtr->lru.emplace_front(_key, _view);
+  this->dataPtr->index[_key] = this->dataPtr->lru.begin();
+  this->dataPtr->stats.bytes += _view.Size();
+  this->dataPtr->stats.entries = this->dataPtr->lru.size();
+}
+
+//////////////////////////////////////////////////
+void MemoryCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->lru.clear();
+  this->dataPtr->index.clear();
+  this->dataPtr->stats.bytes = 0;
+  this->dataPtr->stats.entries = 0;
+}
+
+//////////////////////////////////////////////////
+void MemoryCache::Invalidate(const std::string &_prefix)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  for (auto it = this->dataPtr->lru.begin(); it != this->dataPtr->lru.end();)
+  {
+    if (it->first.compare(0, _prefix.size(), _prefix) != 0)
+    {
+      ++it;
+      continue;
+    }
+    this->dataPtr->stats.bytes -= it->second.Size();
+    this->dataPtr->index.erase(it->first);
+    it = this->dataPtr->lru.erase(it);
+  }
+  this->dataPtr->stats.entries = this->dataPtr->lru.size();
+}
+
+//////////////////////////////////////////////////
+MemoryCacheStats MemoryCache::Stats() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->stats;
+}
+}  // namespace gz::fuel_tools
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_MEMORYCACHE_HH_
+#define GZ_FUEL_TOOLS_MEMORYCACHE_HH_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+#include "gz/fuel_tools/FileView.hh"
+#include "gz/fuel_tools/MemoryCacheStats.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class MemoryCachePrivate;
+
+  /// \brief Bounded, thread-safe store of file contents, evicting the
+  /// least recently used files first.
+  class GZ_FUEL_TOOLS_VISIBLE MemoryCache
+  {
+    /// \brief Constructor. The cache starts disabled, with a budget of 0.
+    public: MemoryCache();
+
+    /// \brief Destructor.
+    public: ~MemoryCache();
+
+    /// \brief Set the number of bytes the cache may hold. Files are evicted
+    /// right away if the new budget is smaller.
+    /// \param[in] _bytes Budget in bytes, 0 to disable the cache.
+    public: void SetBudget(std::uint64_t _bytes);
+
+    /// \brief Get the number of bytes the cache may hold.
+    /// \return Budget in bytes.
+    public: std::uint64_t Budget() const;
+
+    /// \brief Look a file up.
+    /// \param[in] _key Key of the file.
+    /// \return The content, invalid on a miss.
+    public: FileView Get(const std::string &_key);
+
+    /// \brief Add a file, or replace it. Files larger than the budget are
+    /// ignored.
+    /// \param[in] _key Key of the file.
+    /// \param[in] _view Content of the file.
+    public: void Put(const std::string &_key, const FileView &_view);
+
+    /// \brief Drop all the files. The statistics are kept.
+    public: void Clear();
+
+    /// \brief Drop the files whose key starts with a prefix, e.g. the files
+    /// of a directory. The statistics are kept.
+    /// \param[in] _prefix Prefix of the keys.
+    public: void Invalidate(const std::string &_prefix);
+
+    /// \brief Get statistics about the cache.
+    /// \return Statistics since the cache was created.
+    public: MemoryCacheStats Stats() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<MemoryCachePrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_MEMORYCACHE_HH_
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "MemoryCache.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class MemoryCacheTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  }
+
+  /// \brief Create a file and load it.
+  /// \param[in] _name Name of the file.
+  /// \param[in] _size Size of the file.
+  /// \return View of the file.
+  public: FileView Load(const std::string &_name, std::size_t _size)
+  {
+    const std::string path = common::joinPaths(this->tempDir->Path(), _name);
+    std::ofstream(path, std::ios::binary) << std::string(_size, 'x');
+    return FileView::Load(path);
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(MemoryCacheTest, Disabled)
+{
+  MemoryCache cache;
+  EXPECT_EQ(0u, cache.Budget());
+
+  cache.Put("a", this->Load("a", 10));
+  EXPECT_FALSE(cache.Get("a"));
+
+  auto stats = cache.Stats();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(0u, stats.misses);
+  EXPECT_EQ(0u, stats.entries);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MemoryCacheTest, LeastRecentlyUsed)
+{
+  MemoryCache cache;
+  cache.SetBudget(30);
+
+  FileView a = this->Load("a", 10);
+  cache.Put("a", a);
+  cache.Put("b", this->Load("b", 10));
+  cache.Put("c", this->Load("c", 10));
+
+  // Hits return the stored content without reading the file again.
+  EXPECT_EQ(a.Data(), cache.Get("a").Data());
+  EXPECT_FALSE(cache.Get("d"));
+
+  // b is the least recently used.
+  cache.Put("d", this->Load("d", 10));
+  EXPECT_FALSE(cache.Get("b"));
+  EXPECT_TRUE(cache.Get("a"));
+  EXPECT_TRUE(cache.Get("c"));
+  EXPECT_TRUE(cache.Get("d"));
+
+  auto stats = cache.Stats();
+  EXPECT_EQ(4u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(1u, stats.evictions);
+  EXPECT_EQ(3u, stats.entries);
+  EXPECT_EQ(30u, stats.bytes);
+
+  // Replacing a file accounts for the new size.
+  cache.Put("a", this->Load("a", 20));
+  stats = cache.Stats();
+  EXPECT_EQ(30u, stats.bytes);
+  EXPECT_EQ(2u, stats.entries);
+  EXPECT_EQ(20u, cache.Get("a").Size());
+
+  // Files larger than the budget are not kept.
+  cache.Put("e", this->Load("e", 31));
+  EXPECT_FALSE(cache.Get("e"));
+
+  // Shrinking the budget evicts right away.
+  cache.SetBudget(20);
+  stats = cache.Stats();
+  EXPECT_EQ(20u, stats.bytes);
+  EXPECT_EQ(1u, stats.entries);
+  EXPECT_TRUE(cache.Get("a"));
+
+  cache.Clear();
+  EXPECT_FALSE(cache.Get("a"));
+  EXPECT_EQ(0u, cache.Stats().bytes);
+  EXPECT_EQ(0u, cache.Stats().entries);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MemoryCacheTest, Invalidate)
+{
+  MemoryCache cache;
+  cache.SetBudget(100);
+  cache.Put("alice/models/tree/1/model.sdf", this->Load("a", 10));
+  cache.Put("alice/models/tree/10/model.sdf", this->Load("b", 10));
+  cache.Put("alice/models/tree/2/model.sdf", this->Load("c", 10));
+
+  // Only the files of version 1 go.
+  cache.Invalidate("alice/models/tree/1/");
+  EXPECT_FALSE(cache.Get("alice/models/tree/1/model.sdf"));
+  EXPECT_TRUE(cache.Get("alice/models/tree/10/model.sdf"));
+  EXPECT_TRUE(cache.Get("alice/models/tree/2/model.sdf"));
+
+  auto stats = cache.Stats();
+  EXPECT_EQ(2u, stats.entries);
+  EXPECT_EQ(20u, stats.bytes);
+
+  // The freed bytes can be used again.
+  cache.Put("alice/models/tree/3/model.sdf", this->Load("d", 80));
+  EXPECT_EQ(3u, cache.Stats().entries);
+  EXPECT_EQ(0u, cache.Stats().evictions);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MemoryCacheTest, ConcurrentLoaders)
+{
+  MemoryCache cache;
+  cache.SetBudget(64);
+
+  std::vector<FileView> files;
+  for (int i = 0; i < 8; ++i)
+    files.push_back(this->Load(std::to_string(i), 16));
+
+  std::vector<std::thread> loaders;
+  for (int t = 0; t < 4; ++t)
+  {
+    loaders.emplace_back([&cache, &files, t]()
+    {
+      for (int i = 0; i < 1000; ++i)
+      {
+        const std::size_t index = (i * 7 + t) % files.size();
+        const std::string key = std::to_string(index);
+        FileView view = cache.Get(key);
+        if (!view)
+          cache.Put(key, files[index]);
+        else
+          EXPECT_EQ(files[index].Data(), view.Data());
+      }
+    });
+  }
+  for (auto &loader : loaders)
+    loader.join();
+
+  auto stats = cache.Stats();
+  EXPECT_EQ(4000u, stats.hits + stats.misses);
+  EXPECT_LE(stats.bytes, 64u);
+  EXPECT_EQ(stats.bytes, stats.entries * 16u);
+}
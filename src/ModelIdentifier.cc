@@ -80,6 +80,9 @@ class ModelIdentifierPrivate
   /// \brief True indicates the model is private, false indicates the
   /// model is public.
   public: bool privacy{false};
+
+  /// \brief SHA-256 hash of the model archive, all zeros if unknown.
+  public: std::array<std::uint8_t, 32> sha256{};
 };
 
 //////////////////////////////////////////////////
@@ -389,6 +392,19 @@ bool ModelIdentifier::SetVersionStr(const std::string &_version)
   return true;
 }
 
+//////////////////////////////////////////////////
+std::array<std::uint8_t, 32> ModelIdentifier::SHA_256() const
+{
+  return this->dataPtr->sha256;
+}
+
+//////////////////////////////////////////////////
+bool ModelIdentifier::SHA_256(const std::array<std::uint8_t, 32> &_hash)
+{
+  this->dataPtr->sha256 = _hash;
+  return true;
+}
+
 //////////////////////////////////////////////////
 std::string ModelIdentifier::AsString(const std::string &_prefix) const
 {
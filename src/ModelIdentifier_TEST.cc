@@ -16,6 +16,8 @@
 */
 
 #include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
 #include <string>
 #include <gz/common/Console.hh>
 #include <gz/utils/ExtraTestMacros.hh>
@@ -121,6 +123,8 @@ TEST(ModelIdentifier, CopyConstructorDeepCopy)
   std::time_t d2;
   std::time(&d2);
   id.SetUploadDate(d2);
+  EXPECT_EQ((std::array<std::uint8_t, 32>{}), id.SHA_256());
+  EXPECT_TRUE(id.SHA_256({1, 2, 3}));
 
   ModelIdentifier id2(id);
   EXPECT_EQ(std::string("hello"), id2.Name());
@@ -129,6 +133,7 @@ TEST(ModelIdentifier, CopyConstructorDeepCopy)
   EXPECT_EQ(2048u, id2.FileSize());
   EXPECT_EQ(d1, id2.ModifyDate());
   EXPECT_EQ(d2, id2.UploadDate());
+  EXPECT_EQ((std::array<std::uint8_t, 32>{1, 2, 3}), id2.SHA_256());
   EXPECT_EQ(id, id2);
 
   id2.SetName("hello2");
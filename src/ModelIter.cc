@@ -49,10 +49,11 @@ ModelIter ModelIterFactory::Create(const std::vector<Model> &_models)
 
 //////////////////////////////////////////////////
 ModelIter ModelIterFactory::Create(const Rest &_rest,
-    const ServerConfig &_server, const std::string &_api)
+    const ServerConfig &_server, const std::string &_api,
+    const ResourceQuery &_query)
 {
   std::unique_ptr<ModelIterPrivate> priv(new IterRestIds(
-    _rest, _server, _api));
+    _rest, _server, _api, _query));
   return ModelIter(std::move(priv));
 }
 
@@ -159,8 +160,9 @@ std::vector<ModelIdentifier> IterRestIds::ParseIdsFromResponse(
 
 //////////////////////////////////////////////////
 IterRestIds::IterRestIds(const Rest &_rest, const ServerConfig &_config,
-    const std::string &_api)
-  : config(_config), rest(_rest), api(_api)
+    const std::string &_api, const ResourceQuery &_query)
+  : config(_config), rest(_rest), api(_api),
+    queryStrings(_query.QueryStrings())
 {
   this->idIter = this->ids.begin();
   this->Next();
@@ -171,15 +173,16 @@ RestResponse IterRestIds::MakeRestRequest(std::size_t _page)
 {
   HttpMethod method = HttpMethod::GET;
   std::vector<std::string> headers = {"Accept: application/json"};
-  std::vector<ModelIdentifier> modelIds;
-  // Prepare the request with the requested page.
-  std::string queryStrPage = "page=" + std::to_string(_page);
+  // Prepare the request with the requested page, the filters are pushed
+  // down to the server.
+  std::vector<std::string> queryStrs = this->queryStrings;
+  queryStrs.push_back("page=" + std::to_string(_page));
   std::string path = this->api;
   // Fire the request.
   return this->rest.Request(method, this->config.Url().Str(),
       this->config.Version(),
       std::regex_replace(path, std::regex(R"(\\)"), "/"),
-      {queryStrPage}, headers, "");
+      queryStrs, headers, "");
 }
 
 //////////////////////////////////////////////////
@@ -193,6 +196,7 @@ void IterRestIds::Next()
   {
     ++this->currentPage;
     RestResponse resp = this->MakeRestRequest(this->currentPage);
+    this->failed = resp.statusCode != 200;
     this->ids = this->ParseIdsFromResponse(resp);
     this->idIter = this->ids.begin();
   }
@@ -24,6 +24,7 @@
 
 #include "gz/fuel_tools/Model.hh"
 #include "gz/fuel_tools/ModelIdentifier.hh"
+#include "gz/fuel_tools/ResourceQuery.hh"
 #include "gz/fuel_tools/RestClient.hh"
 
 #ifdef _WIN32
@@ -55,9 +56,13 @@ namespace gz::fuel_tools
     /// \param[in] _rest a Rest request
     /// \param[in] _server The server to request the operation
     /// \param[in] _api The path to request
+    /// \param[in] _query Filters, sort order and page size sent to the
+    /// server with every page request.
     public: static ModelIter Create(const Rest &_rest,
                                     const ServerConfig &_server,
-                                    const std::string &_api);
+                                    const std::string &_api,
+                                    const ResourceQuery &_query =
+                                        ResourceQuery());
 
     /// \brief Create a model iterator that is empty
     /// \return An empty iterator
@@ -131,9 +136,14 @@ namespace gz::fuel_tools
   class GZ_FUEL_TOOLS_HIDDEN IterRestIds: public ModelIterPrivate
   {
     /// \brief constructor
+    /// \param[in] _rest REST client
+    /// \param[in] _server Server configuration
+    /// \param[in] _api The path to request
+    /// \param[in] _query Filters, sort order and page size
     public: IterRestIds(const Rest &_rest,
                         const ServerConfig &_server,
-                        const std::string &_api);
+                        const std::string &_api,
+                        const ResourceQuery &_query = ResourceQuery());
 
     /// \brief destructor
     public: virtual ~IterRestIds();
@@ -154,6 +164,13 @@ namespace gz::fuel_tools
     /// \brief The API (path) of the RESTful requests
     public: const std::string api;
 
+    /// \brief Query parameters sent with every page request
+    public: const std::vector<std::string> queryStrings;
+
+    /// \brief True if a page couldn't be retrieved, which ended the
+    /// iteration early.
+    public: bool failed{false};
+
     /// \brief Make a RESTful request for the given page
     /// \param[in] _page Page number to request
     /// \return Response from the request
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/ResourceQuery.hh"
+
+namespace gz::fuel_tools
+{
+//////////////////////////////////////////////////
+/// \brief Private data class
+class ResourceQueryPrivate
+{
+  /// \brief Search terms.
+  public: std::string search;
+
+  /// \brief Field to sort by.
+  public: std::string sortField;
+
+  /// \brief Sort order.
+  public: ResourceQuery::SortOrder order{
+    ResourceQuery::SortOrder::ASCENDING};
+
+  /// \brief Results per page, 0 for the server's default.
+  public: std::size_t perPage{0};
+
+  /// \brief Additional query parameters.
+  public: std::map<std::string, std::string> filters;
+};
+
+//////////////////////////////////////////////////
+/// \brief Percent-encode a query parameter key or value.
+/// \param[in] _str String to encode.
+/// \return The string with everything but unreserved characters encoded.
+static std::string Escape(const std::string &_str)
+{
+  static const char kHex[] = "0123456789ABCDEF";
+  std::string result;
+  result.reserve(_str.size());
+  for (unsigned char c : _str)
+  {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' ||
+        c == '~')
+    {
+      result += static_cast<char>(c);
+    }
+    else
+    {
+      result += '%';
+      result += kHex[c >> 4];
+      result += kHex[c & 0xF];
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+ResourceQuery::ResourceQuery()
+  : dataPtr(new ResourceQueryPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+ResourceQuery::ResourceQuery(const ResourceQuery &_orig)
+  : dataPtr(new ResourceQueryPrivate)
+{
+  *(this->dataPtr) = *(_orig.dataPtr);
+}
+
+//////////////////////////////////////////////////
+ResourceQuery &ResourceQuery::operator=(const ResourceQuery &_orig)
+{
+  *(this->dataPtr) = *(_orig.dataPtr);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+ResourceQuery::~ResourceQuery() = default;
+
+//////////////////////////////////////////////////
+void ResourceQuery::Clear()
+{
+  *(this->dataPtr) = ResourceQueryPrivate();
+}
+
+//////////////////////////////////////////////////
+void ResourceQuery::SetSearch(const std::string &_search)
+{
+  this->dataPtr->search = _search;
+}
+
+//////////////////////////////////////////////////
+std::string ResourceQuery::Search() const
+{
+  return this->dataPtr->search;
+}
+
+//////////////////////////////////////////////////
+void ResourceQuery::SetSort(const std::string &_field, SortOrder _order)
+{
+  this->dataPtr->sortField = _field;
+  this->dataPtr->order = _order;
+}
+
+//////////////////////////////////////////////////
+std::string ResourceQuery::SortField() const
+{
+  return this->dataPtr->sortField;
+}
+
+//////////////////////////////////////////////////
+ResourceQuery::SortOrder ResourceQuery::Order() const
+{
+  return this->dataPtr->order;
+}
+
+//////////////////////////////////////////////////
+void ResourceQuery::SetPerPage(std::size_t _perPage)
+{
+  this->dataPtr->perPage = _perPage;
+}
+
+//////////////////////////////////////////////////
+std::size_t ResourceQuery::PerPage() const
+{
+  return this->dataPtr->perPage;
+}
+
+//////////////////////////////////////////////////
+void ResourceQuery::SetFilter(const std::string &_key,
+    const std::string &_value)
+{
+  if (_key.empty() || _key == "page")
+    return;
+
+  if (_value.empty())
+    this->dataPtr->filters.erase(_key);
+  else
+    this->dataPtr->filters[_key] = _value;
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, std::string> ResourceQuery::Filters() const
+{
+  return this->dataPtr->filters;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> ResourceQuery::QueryStrings() const
+{
+  std::vector<std::string> result;
+  if (!this->dataPtr->search.empty())
+    result.push_back("q=" + Escape(this->dataPtr->search));
+
+  if (!this->dataPtr->sortField.empty())
+  {
+    result.push_back("sort=" + Escape(this->dataPtr->sortField));
+    result.push_back(std::string("order=") +
+        (this->dataPtr->order == SortOrder::DESCENDING ? "desc" : "asc"));
+  }
+
+  if (this->dataPtr->perPage > 0)
+    result.push_back("per_page=" + std::to_string(this->dataPtr->perPage));
+
+  // Typed parameters take precedence over filters of the same name.
+  for (const auto &[key, value] : this->dataPtr->filters)
+  {
+    if ((key == "q" && !this->dataPtr->search.empty()) ||
+        ((key == "sort" || key == "order") &&
+         !this->dataPtr->sortField.empty()) ||
+        (key == "per_page" && this->dataPtr->perPage > 0))
+    {
+      continue;
+    }
+    result.push_back(Escape(key) + "=" + Escape(value));
+  }
+  return result;
+}
+}  // namespace gz::fuel_tools
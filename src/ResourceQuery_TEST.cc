@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/ResourceQuery.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+TEST(ResourceQuery, Empty)
+{
+  ResourceQuery query;
+  EXPECT_TRUE(query.Search().empty());
+  EXPECT_TRUE(query.SortField().empty());
+  EXPECT_EQ(ResourceQuery::SortOrder::ASCENDING, query.Order());
+  EXPECT_EQ(0u, query.PerPage());
+  EXPECT_TRUE(query.Filters().empty());
+  EXPECT_TRUE(query.QueryStrings().empty());
+}
+
+/////////////////////////////////////////////////
+TEST(ResourceQuery, QueryStrings)
+{
+  ResourceQuery query;
+  query.SetSearch("office chair");
+  query.SetSort("downloads", ResourceQuery::SortOrder::DESCENDING);
+  query.SetPerPage(10);
+  query.SetFilter("tags", "a&b=c");
+  query.SetFilter("page", "3");
+  query.SetFilter("per_page", "100");
+
+  EXPECT_EQ(std::vector<std::string>({"q=office%20chair", "sort=downloads",
+      "order=desc", "per_page=10", "tags=a%26b%3Dc"}),
+      query.QueryStrings());
+
+  // Filters fill in the parameters that aren't set
+  query.SetPerPage(0);
+  EXPECT_EQ(std::vector<std::string>({"q=office%20chair", "sort=downloads",
+      "order=desc", "per_page=100", "tags=a%26b%3Dc"}),
+      query.QueryStrings());
+
+  query.SetFilter("per_page", "");
+  query.SetFilter("tags", "");
+  query.SetSort("name");
+  EXPECT_EQ(std::vector<std::string>({"q=office%20chair", "sort=name",
+      "order=asc"}), query.QueryStrings());
+
+  ResourceQuery copy(query);
+  EXPECT_EQ(query.QueryStrings(), copy.QueryStrings());
+  query.Clear();
+  EXPECT_TRUE(query.QueryStrings().empty());
+  EXPECT_EQ("office chair", copy.Search());
+
+  query = copy;
+  EXPECT_EQ("name", query.SortField());
+}
@@ -17,15 +17,27 @@
 
 #include <curl/curl.h>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <gz/common/Console.hh>
 
 #include "gz/fuel_tools/RestClient.hh"
 
+#include "Sha256.hh"
+
 namespace gz::fuel_tools
 {
 
@@ -89,40 +101,175 @@ std::string RestJoinUrl(const std::string &_base,
 /////////////////////////////////////////////////
 size_t RestHeaderCallback(char *_ptr, size_t _size, size_t _nmemb, void *_userp)
 {
-  std::map<std::string, std::string> *map =
-    static_cast<std::map<std::string, std::string> *>(_userp);
+  HttpHeaders *headers = static_cast<HttpHeaders *>(_userp);
 
   _size *= _nmemb;
 
-  if (map)
+  // The line isn't null-terminated, only read the bytes given.
+  if (headers)
+    headers->Parse(std::string_view(_ptr, _size));
+
+  return _size;
+}
+
+/////////////////////////////////////////////////
+/// \brief Destination of a response body. The body is kept in memory until
+/// it is known to exceed the spill threshold, and streamed to the spill
+/// file from then on.
+struct RestBody
+{
+  /// \brief The transfer writing the body.
+  CURL *curl = nullptr;
+
+  /// \brief In-memory body.
+  std::string *data = nullptr;
+
+  /// \brief File the body is streamed to once spilled. Empty to never spill.
+  std::string spillPath;
+
+  /// \brief Largest body kept in memory, in bytes.
+  std::uint64_t spillThreshold = 0;
+
+  /// \brief Open while the body is being spilled.
+  std::ofstream file;
+
+  /// \brief True once the body has been spilled.
+  bool spilled = false;
+
+  /// \brief Hash of the body, so that it doesn't have to be read again.
+  Sha256 sha;
+
+  /// \brief Size of the beginning of the body already in the spill file,
+  /// left by an interrupted transfer.
+  std::uint64_t existing = 0;
+
+  /// \brief Headers of the response, to check the range sent.
+  const HttpHeaders *headers = nullptr;
+
+  /// \brief True once the first write of a resumed transfer was seen.
+  bool checked = false;
+
+  /// \brief True if the server sent the rest of the body, which is
+  /// appended to the spill file.
+  bool resumed = false;
+};
+
+/////////////////////////////////////////////////
+/// \brief Continue a body from the end of its spill file, once the server
+/// agreed to send the rest of it.
+/// \param[in,out] _body Body of a transfer resumed with a Range header.
+/// \return False if the server sent another range, or the spill file
+/// couldn't be read or written.
+static bool RestResumeBody(RestBody &_body)
+{
+  // E.g. "bytes 1000-4999/5000".
+  std::string_view range = _body.headers->Value("Content-Range");
+  std::uint64_t first = 0;
+  if (range.substr(0, 6) != "bytes " ||
+      std::from_chars(range.data() + 6, range.data() + range.size(),
+        first).ec != std::errc() || first != _body.existing)
   {
-    std::string header(_ptr);
-    auto colonPos = header.find(":");
+    gzerr << "Server resumed [" << _body.spillPath << "] at [" << range
+          << "] instead of byte [" << _body.existing << "]" << std::endl;
+    return false;
+  }
 
-    // Only store header information of the form
-    //     <type>: <data>
-    if (colonPos != std::string::npos)
-    {
-      map->insert(std::make_pair(header.substr(0, colonPos),
-                                 header.substr(colonPos+2)));
-    }
+  // The hash covers the whole body.
+  std::ifstream in(_body.spillPath, std::ios::binary);
+  std::array<char, 65536> buffer;
+  std::uint64_t hashed = 0;
+  while (hashed < _body.existing &&
+         in.read(buffer.data(), static_cast<std::streamsize>(
+             std::min<std::uint64_t>(buffer.size(), _body.existing - hashed))))
+  {
+    _body.sha.Update(buffer.data(), in.gcount());
+    hashed += in.gcount();
+  }
+  if (hashed != _body.existing)
+  {
+    gzerr << "Unable to read [" << _body.spillPath << "] to resume the "
+          << "transfer." << std::endl;
+    return false;
   }
 
-  return _size;
+  _body.file.open(_body.spillPath, std::ios::out | std::ios::binary |
+      std::ios::app);
+  if (!_body.file.is_open())
+  {
+    gzerr << "Unable to open [" << _body.spillPath << "] to store "
+          << "response data." << std::endl;
+    return false;
+  }
+  _body.spilled = true;
+  _body.resumed = true;
+  return true;
 }
 
 /////////////////////////////////////////////////
-size_t RestWriteMemoryCallback(void *_buffer, size_t _size, size_t _nmemb,
+size_t RestWriteBodyCallback(void *_buffer, size_t _size, size_t _nmemb,
     void *_userp)
 {
-  std::string *str = static_cast<std::string*>(_userp);
+  RestBody *body = static_cast<RestBody *>(_userp);
   _size *= _nmemb;
 
-  // Append the new character data to the string
-  str->append(static_cast<const char*>(_buffer), _size);
+  // A server that doesn't support ranges sends the whole body again, which
+  // overwrites the spill file.
+  if (body->existing > 0 && !body->checked)
+  {
+    body->checked = true;
+    long code = 0;
+    curl_easy_getinfo(body->curl, CURLINFO_RESPONSE_CODE, &code);
+    // Returning a different size aborts the transfer.
+    if (code == 206 && !RestResumeBody(*body))
+      return 0;
+  }
+
+  body->sha.Update(_buffer, _size);
+
+  if (!body->spilled && !body->spillPath.empty())
+  {
+    curl_off_t length = -1;
+    curl_easy_getinfo(body->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,
+        &length);
+
+    if ((length >= 0 &&
+         static_cast<std::uint64_t>(length) > body->spillThreshold) ||
+        body->data->size() + _size > body->spillThreshold)
+    {
+      body->file.open(body->spillPath,
+          std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!body->file.is_open())
+      {
+        gzerr << "Unable to open [" << body->spillPath << "] to store "
+              << "response data." << std::endl;
+        // Returning a different size aborts the transfer.
+        return 0;
+      }
+      body->file.write(body->data->data(), body->data->size());
+      body->data->clear();
+      body->data->shrink_to_fit();
+      body->spilled = true;
+    }
+  }
+
+  if (body->spilled)
+  {
+    body->file.write(static_cast<const char*>(_buffer), _size);
+    return body->file ? _size : 0;
+  }
+
+  body->data->append(static_cast<const char*>(_buffer), _size);
   return _size;
 }
 
+/////////////////////////////////////////////////
+int RestProgressCallback(void *_clientp, curl_off_t, curl_off_t, curl_off_t,
+    curl_off_t)
+{
+  // A non-zero value aborts the transfer.
+  return static_cast<const CancellationToken *>(_clientp)->Cancelled();
+}
+
 /////////////////////////////////////////////////
 void AddFormPost(
     curl_mime * const multipart,
@@ -185,15 +332,270 @@ void AddFormPost(
 }
 
 /////////////////////////////////////////////////
-RestResponse Rest::Request(HttpMethod _method,
+/// \brief Mutexes guarding each kind of data held by the shared curl
+/// handle.
+static std::array<std::mutex, CURL_LOCK_DATA_LAST> &RestShareMutexes()
+{
+  static std::array<std::mutex, CURL_LOCK_DATA_LAST> mutexes;
+  return mutexes;
+}
+
+/////////////////////////////////////////////////
+void RestShareLock(CURL *, curl_lock_data _data, curl_lock_access, void *)
+{
+  RestShareMutexes()[_data].lock();
+}
+
+/////////////////////////////////////////////////
+void RestShareUnlock(CURL *, curl_lock_data _data, void *)
+{
+  RestShareMutexes()[_data].unlock();
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the process-wide share handle. It holds the DNS cache and
+/// the TLS session cache, so that requests issued from any thread skip
+/// name resolution and resume TLS sessions instead of doing a full
+/// handshake against a server that was already contacted.
+static CURLSH *RestShareHandle()
+{
+  static CURLSH *share = []()
+  {
+    CURLSH *handle = curl_share_init();
+    if (handle)
+    {
+      curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, RestShareLock);
+      curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, RestShareUnlock);
+      curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    return handle;
+  }();
+  return share;
+}
+
+/////////////////////////////////////////////////
+/// \brief Drives transfers for Rest requests in HTTP/2 mode.
+///
+/// libcurl can only multiplex streams over a connection when the transfers
+/// live in the same multi handle, and connections can not be shared
+/// between easy handles that run concurrently in different threads. This
+/// engine owns a single multi handle serviced by one thread. Callers hand
+/// over a fully configured easy handle and block until it completes, so
+/// concurrent Rest::Request calls end up as streams of the same HTTP/2
+/// connection.
+class RestMultiplexer
+{
+  /// \brief Get the process-wide instance.
+  /// \return The multiplexer.
+  public: static RestMultiplexer &Instance()
+          {
+            static RestMultiplexer instance;
+            return instance;
+          }
+
+  /// \brief Run a transfer to completion.
+  /// \param[in] _curl Configured easy handle. The caller keeps ownership.
+  /// \return Result of the transfer.
+  public: CURLcode Perform(CURL *_curl)
+          {
+            if (!this->multi)
+              return curl_easy_perform(_curl);
+
+            Transfer transfer;
+            transfer.curl = _curl;
+            {
+              std::lock_guard<std::mutex> lock(this->mutex);
+              if (this->stop)
+                return CURLE_ABORTED_BY_CALLBACK;
+              this->pending.push_back(&transfer);
+            }
+            curl_multi_wakeup(this->multi);
+
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->doneCv.wait(lock, [&transfer]{return transfer.done;});
+            return transfer.result;
+          }
+
+  /// \brief Constructor. Starts the transfer thread.
+  private: RestMultiplexer()
+           {
+             this->multi = curl_multi_init();
+             if (!this->multi)
+             {
+               gzwarn << "Unable to create a HTTP/2 transfer engine, "
+                      << "requests will not be multiplexed." << std::endl;
+               return;
+             }
+             curl_multi_setopt(this->multi, CURLMOPT_PIPELINING,
+                 CURLPIPE_MULTIPLEX);
+             this->thread = std::thread(&RestMultiplexer::Run, this);
+           }
+
+  /// \brief Destructor. Aborts pending transfers and joins the thread.
+  private: ~RestMultiplexer()
+           {
+             if (!this->multi)
+               return;
+
+             {
+               std::lock_guard<std::mutex> lock(this->mutex);
+               this->stop = true;
+             }
+             curl_multi_wakeup(this->multi);
+             if (this->thread.joinable())
+               this->thread.join();
+             curl_multi_cleanup(this->multi);
+           }
+
+  /// \brief A transfer handed over by a caller.
+  private: struct Transfer
+           {
+             /// \brief The easy handle.
+             CURL *curl = nullptr;
+
+             /// \brief Result of the transfer.
+             CURLcode result = CURLE_OK;
+
+             /// \brief True once the transfer is finished.
+             bool done = false;
+           };
+
+  /// \brief Mark a transfer as finished and wake up its caller.
+  /// \param[in] _transfer The transfer.
+  /// \param[in] _result Result of the transfer.
+  private: void Finish(Transfer *_transfer, CURLcode _result)
+           {
+             {
+               std::lock_guard<std::mutex> lock(this->mutex);
+               _transfer->result = _result;
+               _transfer->done = true;
+             }
+             this->doneCv.notify_all();
+           }
+
+  /// \brief Transfer thread.
+  private: void Run()
+           {
+             std::vector<Transfer *> active;
+             while (true)
+             {
+               std::vector<Transfer *> incoming;
+               {
+                 std::lock_guard<std::mutex> lock(this->mutex);
+                 if (this->stop)
+                   break;
+                 incoming.swap(this->pending);
+               }
+
+               for (Transfer *transfer : incoming)
+               {
+                 curl_easy_setopt(transfer->curl, CURLOPT_PRIVATE, transfer);
+                 if (curl_multi_add_handle(this->multi, transfer->curl) !=
+                     CURLM_OK)
+                 {
+                   this->Finish(transfer, CURLE_FAILED_INIT);
+                   continue;
+                 }
+                 active.push_back(transfer);
+               }
+
+               int running = 0;
+               curl_multi_perform(this->multi, &running);
+
+               int left = 0;
+               while (CURLMsg *msg = curl_multi_info_read(this->multi, &left))
+               {
+                 if (msg->msg != CURLMSG_DONE)
+                   continue;
+
+                 Transfer *transfer = nullptr;
+                 curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE,
+                     &transfer);
+                 CURLcode result = msg->data.result;
+                 curl_multi_remove_handle(this->multi, msg->easy_handle);
+                 active.erase(
+                     std::remove(active.begin(), active.end(), transfer),
+                     active.end());
+                 if (transfer)
+                   this->Finish(transfer, result);
+               }
+
+               curl_multi_poll(this->multi, nullptr, 0, 1000, nullptr);
+             }
+
+             // Shutting down, abort whatever is left.
+             std::vector<Transfer *> incoming;
+             {
+               std::lock_guard<std::mutex> lock(this->mutex);
+               incoming.swap(this->pending);
+             }
+             for (Transfer *transfer : active)
+             {
+               curl_multi_remove_handle(this->multi, transfer->curl);
+               this->Finish(transfer, CURLE_ABORTED_BY_CALLBACK);
+             }
+             for (Transfer *transfer : incoming)
+               this->Finish(transfer, CURLE_ABORTED_BY_CALLBACK);
+           }
+
+  /// \brief The multi handle all transfers are added to.
+  private: CURLM *multi = nullptr;
+
+  /// \brief Protects pending, stop and the done flag of the transfers.
+  private: std::mutex mutex;
+
+  /// \brief Signaled when a transfer finishes.
+  private: std::condition_variable doneCv;
+
+  /// \brief Transfers waiting to be added to the multi handle.
+  private: std::vector<Transfer *> pending;
+
+  /// \brief True when shutting down.
+  private: bool stop = false;
+
+  /// \brief Thread running the transfers.
+  private: std::thread thread;
+};
+
+/////////////////////////////////////////////////
+/// \brief Check whether the linked libcurl supports HTTP/2.
+/// \return True if HTTP/2 is supported.
+static bool RestHttp2Supported()
+{
+  static const bool supported = []()
+  {
+    const curl_version_info_data *info = curl_version_info(CURLVERSION_NOW);
+    bool result = info && (info->features & CURL_VERSION_HTTP2);
+    if (!result)
+    {
+      gzwarn << "libcurl was built without HTTP/2 support, falling back to "
+             << "HTTP/1.1." << std::endl;
+    }
+    return result;
+  }();
+  return supported;
+}
+
+/////////////////////////////////////////////////
+/// \brief Perform a request on behalf of Rest::Request and Rest::Download.
+/// \param[in] _rest The client issuing the request.
+/// \param[in] _spillPath See Rest::Download. Empty to keep the body in
+/// memory.
+/// \param[in] _spillThreshold See Rest::Download.
+/// \param[in] _resume See Rest::Download.
+/// \return The response.
+static RestResponse RestPerform(const Rest &_rest, HttpMethod _method,
     const std::string &_url, const std::string &_version,
     const std::string &_path, const std::vector<std::string> &_queryStrings,
     const std::vector<std::string> &_headers, const std::string &_data,
-    const std::multimap<std::string, std::string> &_form) const
+    const std::multimap<std::string, std::string> &_form,
+    const std::string &_spillPath, std::uint64_t _spillThreshold,
+    bool _resume)
 {
   RestResponse res;
 
-  if (_url.empty())
+  if (_url.empty() || _rest.Cancellation().Cancelled())
     return res;
 
   std::string url = _url;
@@ -247,6 +649,24 @@ RestResponse Rest::Request(HttpMethod _method,
     }
   }
 
+  // Resume an interrupted download from the end of its spill file.
+  RestBody body;
+  if (_resume && !_spillPath.empty())
+  {
+    std::ifstream spill(_spillPath, std::ios::binary | std::ios::ate);
+    body.existing = std::max<std::streamoff>(spill.tellg(), 0);
+  }
+  if (body.existing > 0)
+  {
+    const std::string range =
+      "Range: bytes=" + std::to_string(body.existing) + "-";
+    struct curl_slist *appended = curl_slist_append(headers, range.c_str());
+    if (appended)
+      headers = appended;
+    else
+      body.existing = 0;
+  }
+
   // enable TCP keep-alive for this transfer
   curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
 
@@ -256,17 +676,36 @@ RestResponse Rest::Request(HttpMethod _method,
   // interval time between keep-alive probes: 60 seconds
   curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, 60L);
 
-  curl_easy_setopt(curl, CURLOPT_USERAGENT, this->userAgent.c_str());
+  curl_easy_setopt(curl, CURLOPT_USERAGENT, _rest.UserAgent().c_str());
   curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
 
-  std::string responseData;
-  std::map<std::string, std::string> headerData;
+  // Reuse DNS lookups and TLS sessions across requests.
+  if (CURLSH *share = RestShareHandle())
+    curl_easy_setopt(curl, CURLOPT_SHARE, share);
+
+  if (_rest.Http2() && RestHttp2Supported())
+  {
+    // Negotiate HTTP/2 over TLS through ALPN. Plain HTTP, and servers that
+    // don't speak HTTP/2, stay on HTTP/1.1.
+    curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+
+    // Prefer waiting for a connection that can be multiplexed over opening
+    // a new one.
+    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+  }
+
+  // Write the body straight into the response to avoid copying it.
+  body.curl = curl;
+  body.data = &res.data;
+  body.headers = &res.headers;
+  body.spillPath = _spillPath;
+  body.spillThreshold = _spillThreshold;
   curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, RestWriteMemoryCallback);
-  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseData);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, RestWriteBodyCallback);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
 
   curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, RestHeaderCallback);
-  curl_easy_setopt(curl, CURLOPT_HEADERDATA, &headerData);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, &res.headers);
 
   char errbuf[CURL_ERROR_SIZE];
   // provide a buffer to store errors in
@@ -278,6 +717,11 @@ RestResponse Rest::Request(HttpMethod _method,
   // Set the default value: do not prove that SSL certificate is authentic
   curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
 
+  // Abort the transfer as soon as the request is cancelled.
+  curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, RestProgressCallback);
+  curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &_rest.Cancellation());
+  curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+
   // Follow redirects to any URL set on the Location header.
   curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
 
@@ -314,6 +758,10 @@ RestResponse Rest::Request(HttpMethod _method,
   {
     curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
   }
+  else if (_method == HttpMethod::HEAD)
+  {
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+  }
   else
   {
     gzerr << "Unsupported method" << std::endl;
@@ -324,8 +772,14 @@ RestResponse Rest::Request(HttpMethod _method,
     return res;
   }
 
-  CURLcode success = curl_easy_perform(curl);
-  if (success != CURLE_OK)
+  CURLcode success = _rest.Http2() ?
+    RestMultiplexer::Instance().Perform(curl) : curl_easy_perform(curl);
+  if (success == CURLE_ABORTED_BY_CALLBACK &&
+      _rest.Cancellation().Cancelled())
+  {
+    gzdbg << "REST request to [" << url << "] cancelled" << std::endl;
+  }
+  else if (success != CURLE_OK)
   {
     gzerr << "Error in REST request" << std::endl;
     size_t len = strlen(errbuf);
@@ -339,14 +793,38 @@ RestResponse Rest::Request(HttpMethod _method,
       fprintf(stderr, "%s\n", curl_easy_strerror(success));
   }
 
-  // Update the status code.
-  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &res.statusCode);
+  // Update the status code. A transfer aborted half way doesn't count as a
+  // response, even if a status line was received.
+  if (success != CURLE_ABORTED_BY_CALLBACK && success != CURLE_WRITE_ERROR)
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &res.statusCode);
 
-  // Update the data.
-  res.data = responseData;
+  // A resumed body looks as if it had been received whole.
+  if (body.resumed && res.statusCode == 206)
+  {
+    HttpHeaders whole;
+    for (std::size_t i = 0; i < res.headers.Size(); ++i)
+    {
+      std::string name(res.headers.Name(i));
+      std::transform(name.begin(), name.end(), name.begin(),
+          [](unsigned char _c) { return std::tolower(_c); });
+      if (name != "content-length" && name != "content-range")
+        whole.Add(res.headers.Name(i), res.headers.Value(i));
+    }
+    std::uint64_t length = 0;
+    if (res.headers.ContentLength(length))
+      whole.Add("Content-Length", std::to_string(body.existing + length));
+    res.headers = std::move(whole);
+    res.statusCode = 200;
+  }
+
+  res.sha256 = body.sha.Final();
 
-  // Update the header data.
-  res.headers = headerData;
+  // Point at the spilled body, if any.
+  if (body.spilled)
+  {
+    body.file.close();
+    res.dataPath = _spillPath;
+  }
 
   // free encoded path char*
   if (encodedPath)
@@ -364,6 +842,66 @@ RestResponse Rest::Request(HttpMethod _method,
   return res;
 }
 
+/////////////////////////////////////////////////
+/// \brief Private data class
+class RestPrivate
+{
+  /// \brief True if HTTP/2 mode is enabled.
+  public: bool http2 = false;
+
+  /// \brief Token used to cancel requests.
+  public: CancellationToken cancellation;
+};
+
+/////////////////////////////////////////////////
+Rest::Rest()
+  : dataPtr(new RestPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+Rest::Rest(const Rest &_orig)
+  : userAgent(_orig.userAgent),
+    dataPtr(new RestPrivate(*_orig.dataPtr))
+{
+}
+
+/////////////////////////////////////////////////
+Rest::~Rest()
+{
+}
+
+/////////////////////////////////////////////////
+Rest &Rest::operator=(const Rest &_orig)
+{
+  this->userAgent = _orig.userAgent;
+  this->dataPtr.reset(new RestPrivate(*_orig.dataPtr));
+  return *this;
+}
+
+/////////////////////////////////////////////////
+RestResponse Rest::Request(HttpMethod _method,
+    const std::string &_url, const std::string &_version,
+    const std::string &_path, const std::vector<std::string> &_queryStrings,
+    const std::vector<std::string> &_headers, const std::string &_data,
+    const std::multimap<std::string, std::string> &_form) const
+{
+  return RestPerform(*this, _method, _url, _version, _path, _queryStrings,
+      _headers, _data, _form, "", 0, false);
+}
+
+/////////////////////////////////////////////////
+RestResponse Rest::Download(const std::string &_url,
+    const std::string &_version, const std::string &_path,
+    const std::vector<std::string> &_queryStrings,
+    const std::vector<std::string> &_headers,
+    const std::string &_spillPath, std::uint64_t _spillThreshold,
+    bool _resume) const
+{
+  return RestPerform(*this, HttpMethod::GET, _url, _version, _path,
+      _queryStrings, _headers, "", {}, _spillPath, _spillThreshold, _resume);
+}
+
 /////////////////////////////////////////////////
 void Rest::SetUserAgent(const std::string &_agent)
 {
@@ -375,4 +913,28 @@ const std::string &Rest::UserAgent() const
 {
   return this->userAgent;
 }
+
+/////////////////////////////////////////////////
+void Rest::SetHttp2(bool _enable)
+{
+  this->dataPtr->http2 = _enable;
+}
+
+/////////////////////////////////////////////////
+bool Rest::Http2() const
+{
+  return this->dataPtr->http2;
+}
+
+/////////////////////////////////////////////////
+void Rest::SetCancellationToken(const CancellationToken &_token)
+{
+  this->dataPtr->cancellation = _token;
+}
+
+/////////////////////////////////////////////////
+const CancellationToken &Rest::Cancellation() const
+{
+  return this->dataPtr->cancellation;
+}
 }  // namespace gz::fuel_tools
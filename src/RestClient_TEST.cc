@@ -16,7 +16,23 @@
 */
 
 #include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
+
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
 #include "gz/fuel_tools/RestClient.hh"
 
 /////////////////////////////////////////////////
@@ -28,3 +44,181 @@ TEST(RestClient, UserAgent)
   rest.SetUserAgent("my_user_agent");
   EXPECT_EQ("my_user_agent", rest.UserAgent());
 }
+
+/////////////////////////////////////////////////
+TEST(RestClient, Http2)
+{
+  gz::fuel_tools::Rest rest;
+  EXPECT_FALSE(rest.Http2());
+
+  rest.SetHttp2(true);
+  EXPECT_TRUE(rest.Http2());
+
+  gz::fuel_tools::Rest copy(rest);
+  EXPECT_TRUE(copy.Http2());
+
+  rest.SetHttp2(false);
+  EXPECT_FALSE(rest.Http2());
+}
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+/// \brief Server answering a single HTTP request on the loopback interface
+/// with a canned response.
+class OneShotServer
+{
+  /// \brief Constructor.
+  /// \param[in] _response Raw response, status line included.
+  public: explicit OneShotServer(const std::string &_response)
+  {
+    this->fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (bind(this->fd, reinterpret_cast<sockaddr *>(&addr), len) != 0 ||
+        listen(this->fd, 1) != 0 ||
+        getsockname(this->fd, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+    {
+      return;
+    }
+    this->url = "http://127.0.0.1:" + std::to_string(ntohs(addr.sin_port));
+
+    this->thread = std::thread([this, _response]
+    {
+      int client = accept(this->fd, nullptr, nullptr);
+      if (client < 0)
+        return;
+      char buffer[4096];
+      while (this->request.find("\r\n\r\n") == std::string::npos)
+      {
+        ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+        if (n <= 0)
+          break;
+        this->request.append(buffer, n);
+      }
+      send(client, _response.data(), _response.size(), 0);
+      close(client);
+    });
+  }
+
+  /// \brief Destructor.
+  public: ~OneShotServer()
+  {
+    if (this->thread.joinable())
+      this->thread.join();
+    close(this->fd);
+  }
+
+  /// \brief Get the request received, once the response was sent.
+  /// \return Raw request.
+  public: const std::string &Request()
+  {
+    if (this->thread.joinable())
+      this->thread.join();
+    return this->request;
+  }
+
+  /// \brief URL of the server, empty if it couldn't listen.
+  public: std::string url;
+
+  /// \brief Listening socket.
+  private: int fd = -1;
+
+  /// \brief Thread serving the request.
+  private: std::thread thread;
+
+  /// \brief Raw request received.
+  private: std::string request;
+};
+
+/////////////////////////////////////////////////
+/// \brief Read a whole file.
+/// \param[in] _path Path of the file.
+/// \return Content of the file.
+static std::string readFile(const std::string &_path)
+{
+  std::ifstream in(_path, std::ios::binary);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Build a response.
+/// \param[in] _status Status line, e.g. "200 OK".
+/// \param[in] _headers Additional headers, each ending with CRLF.
+/// \param[in] _body Body.
+/// \return Raw response.
+static std::string response(const std::string &_status,
+    const std::string &_headers, const std::string &_body)
+{
+  return "HTTP/1.1 " + _status + "\r\n" + _headers +
+    "Content-Length: " + std::to_string(_body.size()) + "\r\n" +
+    "Connection: close\r\n\r\n" + _body;
+}
+
+/////////////////////////////////////////////////
+TEST(RestClient, DownloadResume)
+{
+  auto tempDir = gz::common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  const std::string spill = tempDir->Path() + "/archive.zip";
+  gz::fuel_tools::Rest rest;
+
+  // The rest of the body is appended to the partial file.
+  {
+    std::ofstream(spill, std::ios::binary) << "0123";
+    OneShotServer server(response("206 Partial Content",
+        "Content-Range: bytes 4-9/10\r\n", "456789"));
+    ASSERT_FALSE(server.url.empty());
+    auto resp = rest.Download(server.url, "", "", {}, {}, spill, 2, true);
+    EXPECT_NE(std::string::npos,
+        server.Request().find("Range: bytes=4-\r\n"));
+    EXPECT_EQ(200, resp.statusCode);
+    EXPECT_EQ(spill, resp.dataPath);
+    EXPECT_EQ("0123456789", readFile(spill));
+    std::uint64_t length = 0;
+    EXPECT_TRUE(resp.headers.ContentLength(length));
+    EXPECT_EQ(10u, length);
+  }
+
+  // Without _resume, no range is requested and the partial file is
+  // overwritten.
+  {
+    std::ofstream(spill, std::ios::binary) << "0123";
+    OneShotServer server(response("200 OK", "", "abcdefghij"));
+    ASSERT_FALSE(server.url.empty());
+    auto resp = rest.Download(server.url, "", "", {}, {}, spill, 2);
+    EXPECT_EQ(std::string::npos, server.Request().find("Range:"));
+    EXPECT_EQ(200, resp.statusCode);
+    EXPECT_EQ("abcdefghij", readFile(spill));
+  }
+
+  // A server that ignores the range sends the whole body, which replaces
+  // the partial file instead of being appended to it.
+  {
+    std::ofstream(spill, std::ios::binary) << "0123";
+    OneShotServer server(response("200 OK", "", "abcdefghij"));
+    ASSERT_FALSE(server.url.empty());
+    auto resp = rest.Download(server.url, "", "", {}, {}, spill, 2, true);
+    EXPECT_NE(std::string::npos, server.Request().find("Range: bytes=4-"));
+    EXPECT_EQ(200, resp.statusCode);
+    EXPECT_EQ(spill, resp.dataPath);
+    EXPECT_EQ("abcdefghij", readFile(spill));
+  }
+
+  // A rejected range, e.g. because the partial file is complete already,
+  // is reported and leaves the partial file alone.
+  {
+    std::ofstream(spill, std::ios::binary) << "0123";
+    OneShotServer server(response("416 Range Not Satisfiable",
+        "Content-Range: bytes */4\r\n", ""));
+    ASSERT_FALSE(server.url.empty());
+    auto resp = rest.Download(server.url, "", "", {}, {}, spill, 2, true);
+    EXPECT_EQ(416, resp.statusCode);
+    EXPECT_TRUE(resp.dataPath.empty());
+    EXPECT_EQ("0123", readFile(spill));
+  }
+}
+#endif
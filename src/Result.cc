@@ -112,6 +112,8 @@ std::string Result::ReadableResult() const
         return "Patch failed.";
     case ResultType::PATCH:
       return "Successfully sent patch request to the server";
+    case ResultType::CANCELLED:
+      return "Cancelled";
     case ResultType::UNKNOWN:
     default:
       return "Unknown result";
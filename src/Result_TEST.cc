@@ -96,6 +96,7 @@ TEST(Result, ReadableStringsHaveLength)
   EXPECT_FALSE(
       Result(ResultType::UPLOAD_ALREADY_EXISTS).ReadableResult().empty());
   EXPECT_FALSE(Result(ResultType::UPLOAD_ERROR).ReadableResult().empty());
+  EXPECT_FALSE(Result(ResultType::CANCELLED).ReadableResult().empty());
 }
 
 //////////////////////////////////////////////////
@@ -113,4 +114,5 @@ TEST(Result, TrueOnSuccess)
   EXPECT_FALSE(Result(ResultType::FETCH_ERROR));
   EXPECT_FALSE(Result(ResultType::UPLOAD_ALREADY_EXISTS));
   EXPECT_FALSE(Result(ResultType::UPLOAD_ERROR));
+  EXPECT_FALSE(Result(ResultType::CANCELLED));
 }
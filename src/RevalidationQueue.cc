@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RevalidationQueue.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Outcome of the last check of a resource.
+struct RevalidationEntry
+{
+  /// \brief Time of the check.
+  public: std::chrono::steady_clock::time_point checked;
+
+  /// \brief Entity tag of the response, empty if none.
+  public: std::string etag;
+};
+
+/// \brief Private data class
+class RevalidationQueuePrivate
+{
+  /// \brief Protects all members.
+  public: mutable std::mutex mutex;
+
+  /// \brief Uses by this process, by URL.
+  public: std::map<std::string, std::size_t> hits;
+
+  /// \brief Last check of each resource, by URL.
+  public: std::map<std::string, RevalidationEntry> entries;
+};
+
+//////////////////////////////////////////////////
+RevalidationQueue::RevalidationQueue()
+  : dataPtr(new RevalidationQueuePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+RevalidationQueue::~RevalidationQueue() = default;
+
+//////////////////////////////////////////////////
+void RevalidationQueue::Hit(const std::string &_url)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  ++this->dataPtr->hits[_url];
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> RevalidationQueue::Due(
+    const std::map<std::string, std::size_t> &_recorded,
+    std::chrono::steady_clock::duration _interval, std::size_t _max,
+    std::chrono::steady_clock::time_point _now) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  std::map<std::string, std::size_t> counts = _recorded;
+  for (const auto &[url, hits] : this->dataPtr->hits)
+    counts[url] += hits;
+
+  std::vector<std::pair<std::size_t, std::string>> due;
+  for (const auto &[url, count] : counts)
+  {
+    auto entry = this->dataPtr->entries.find(url);
+    if (entry != this->dataPtr->entries.end() &&
+        _now - entry->second.checked < _interval)
+    {
+      continue;
+    }
+    due.emplace_back(count, url);
+  }
+
+  // Most used first, ties in URL order.
+  std::sort(due.begin(), due.end(), [](const auto &_a, const auto &_b)
+      {
+        return _a.first != _b.first ? _a.first > _b.first :
+          _a.second < _b.second;
+      });
+
+  std::vector<std::string> urls;
+  for (std::size_t i = 0; i < due.size() && i < _max; ++i)
+    urls.push_back(std::move(due[i].second));
+  return urls;
+}
+
+//////////////////////////////////////////////////
+void RevalidationQueue::Checked(const std::string &_url,
+    const std::string &_etag, std::chrono::steady_clock::time_point _now)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->entries[_url] = RevalidationEntry{_now, _etag};
+}
+
+//////////////////////////////////////////////////
+std::string RevalidationQueue::ETag(const std::string &_url) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto entry = this->dataPtr->entries.find(_url);
+  return entry == this->dataPtr->entries.end() ? "" : entry->second.etag;
+}
+}  // namespace gz::fuel_tools
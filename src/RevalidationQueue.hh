@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_REVALIDATIONQUEUE_HH_
+#define GZ_FUEL_TOOLS_REVALIDATIONQUEUE_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class RevalidationQueuePrivate;
+
+  /// \brief Decides which cached resources a client revalidates next.
+  ///
+  /// Resources are ranked by use count, which is the number of sessions
+  /// that recorded them in the usage history plus the number of times this
+  /// process used them. A resource is due when it was never checked, or
+  /// when its last check is older than the revalidation interval. The
+  /// entity tag returned by the last check is kept, so that the next one
+  /// can be a conditional request.
+  ///
+  /// This class is thread safe.
+  class GZ_FUEL_TOOLS_VISIBLE RevalidationQueue
+  {
+    /// \brief Constructor.
+    public: RevalidationQueue();
+
+    /// \brief Destructor.
+    public: ~RevalidationQueue();
+
+    /// \brief Count a use of a resource by this process.
+    /// \param[in] _url URL of the model or world.
+    public: void Hit(const std::string &_url);
+
+    /// \brief Get the resources due for revalidation, most used first.
+    /// \param[in] _recorded Use counts from the usage history, by URL.
+    /// \param[in] _interval Minimum time between two checks of a resource.
+    /// \param[in] _max Maximum number of resources to return.
+    /// \param[in] _now Current time.
+    /// \return URLs of the resources to check.
+    public: std::vector<std::string> Due(
+                const std::map<std::string, std::size_t> &_recorded,
+                std::chrono::steady_clock::duration _interval,
+                std::size_t _max,
+                std::chrono::steady_clock::time_point _now =
+                  std::chrono::steady_clock::now()) const;
+
+    /// \brief Record that a resource was checked.
+    /// \param[in] _url URL of the model or world.
+    /// \param[in] _etag Entity tag of the response, empty if none.
+    /// \param[in] _now Time of the check.
+    public: void Checked(const std::string &_url, const std::string &_etag,
+                std::chrono::steady_clock::time_point _now =
+                  std::chrono::steady_clock::now());
+
+    /// \brief Get the entity tag returned by the last check of a resource.
+    /// \param[in] _url URL of the model or world.
+    /// \return Entity tag, empty if unknown.
+    public: std::string ETag(const std::string &_url) const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<RevalidationQueuePrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_REVALIDATIONQUEUE_HH_
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "RevalidationQueue.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+static const char kHouse[] =
+  "https://fuel.gazebosim.org/1.0/openrobotics/models/house";
+static const char kTree[] =
+  "https://fuel.gazebosim.org/1.0/openrobotics/models/tree";
+static const char kCafe[] =
+  "https://fuel.gazebosim.org/1.0/openrobotics/worlds/cafe";
+
+/////////////////////////////////////////////////
+TEST(RevalidationQueue, Ranking)
+{
+  RevalidationQueue queue;
+  EXPECT_TRUE(queue.Due({}, std::chrono::hours(1), 10).empty());
+
+  // Recorded sessions and uses by this process add up.
+  std::map<std::string, std::size_t> recorded{{kHouse, 3}, {kTree, 1}};
+  queue.Hit(kTree);
+  queue.Hit(kTree);
+  queue.Hit(kTree);
+  queue.Hit(kCafe);
+
+  auto due = queue.Due(recorded, std::chrono::hours(1), 10);
+  ASSERT_EQ(3u, due.size());
+  EXPECT_EQ(kTree, due[0]);
+  EXPECT_EQ(kHouse, due[1]);
+  EXPECT_EQ(kCafe, due[2]);
+
+  due = queue.Due(recorded, std::chrono::hours(1), 2);
+  ASSERT_EQ(2u, due.size());
+  EXPECT_EQ(kTree, due[0]);
+  EXPECT_EQ(kHouse, due[1]);
+}
+
+/////////////////////////////////////////////////
+TEST(RevalidationQueue, Interval)
+{
+  RevalidationQueue queue;
+  std::map<std::string, std::size_t> recorded{{kHouse, 2}, {kTree, 1}};
+  const auto start = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(queue.ETag(kHouse).empty());
+  queue.Checked(kHouse, "\"v2\"", start);
+  EXPECT_EQ("\"v2\"", queue.ETag(kHouse));
+
+  // The house was just checked.
+  auto due = queue.Due(recorded, std::chrono::minutes(10), 10,
+      start + std::chrono::minutes(5));
+  ASSERT_EQ(1u, due.size());
+  EXPECT_EQ(kTree, due[0]);
+
+  // It's due again once the interval has passed.
+  due = queue.Due(recorded, std::chrono::minutes(10), 10,
+      start + std::chrono::minutes(10));
+  ASSERT_EQ(2u, due.size());
+  EXPECT_EQ(kHouse, due[0]);
+
+  // A check without entity tag forgets the previous one.
+  queue.Checked(kHouse, "", start + std::chrono::minutes(10));
+  EXPECT_TRUE(queue.ETag(kHouse).empty());
+}
@@ -0,0 +1,609 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/URI.hh>
+
+#include "SearchIndex.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief First line of an index file.
+static const char kIndexHeader[] = "gz-fuel-search-index\t1";
+
+/// \brief Occurrence of a term in a model.
+struct Posting
+{
+  /// \brief Index of the model.
+  std::uint32_t model;
+
+  /// \brief Sum of the weights of the fields holding the term.
+  float weight;
+};
+
+/// \brief Private data class
+class SearchIndexPrivate
+{
+  /// \brief Rebuild the terms and postings from the models.
+  public: void Rebuild();
+
+  /// \brief Add the postings of a model.
+  /// \param[in] _model Index of the model.
+  public: void AddPostings(std::uint32_t _model);
+
+  /// \brief Remove the postings of a model, and the terms left without
+  /// postings.
+  /// \param[in] _model Index of the model.
+  public: void RemovePostings(std::uint32_t _model);
+
+  /// \brief Server of the models.
+  public: ServerConfig server;
+
+  /// \brief Indexed models.
+  public: std::vector<ModelIdentifier> models;
+
+  /// \brief Records of the models, see Record, by owner and name.
+  public: std::unordered_map<std::string, std::string> records;
+
+  /// \brief Indices of the models, by owner and name.
+  public: std::unordered_map<std::string, std::uint32_t> positions;
+
+  /// \brief Sorted terms, for prefix lookups.
+  public: std::vector<std::string> terms;
+
+  /// \brief Postings of each term, in the order of terms.
+  public: std::vector<std::vector<Posting>> postings;
+};
+
+//////////////////////////////////////////////////
+/// \brief Escape the separators of a field of a record.
+/// \param[in] _field Field to escape.
+/// \return Escaped field.
+static std::string escape(const std::string &_field)
+{
+  std::string result;
+  result.reserve(_field.size());
+  for (char c : _field)
+  {
+    switch (c)
+    {
+      case '\\': result += "\\\\"; break;
+      case '\t': result += "\\t"; break;
+      case '\n': result += "\\n"; break;
+      case '\r': result += "\\r"; break;
+      default: result += c;
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+/// \brief Split a record into unescaped fields.
+/// \param[in] _record Record to split.
+/// \return Fields of the record.
+static std::vector<std::string> splitRecord(const std::string &_record)
+{
+  std::vector<std::string> fields(1);
+  for (std::size_t i = 0; i < _record.size(); ++i)
+  {
+    const char c = _record[i];
+    if (c == '\t')
+    {
+      fields.emplace_back();
+    }
+    else if (c == '\\' && i + 1 < _record.size())
+    {
+      const char next = _record[++i];
+      fields.back() += next == 't' ? '\t' : next == 'n' ? '\n' :
+        next == 'r' ? '\r' : next;
+    }
+    else
+    {
+      fields.back() += c;
+    }
+  }
+  return fields;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the record of a model, i.e. the line saved for it.
+/// \param[in] _id Model.
+/// \return Record of the model.
+static std::string record(const ModelIdentifier &_id)
+{
+  std::ostringstream out;
+  out << escape(_id.Owner()) << '\t' << escape(_id.Name()) << '\t'
+      << _id.Version() << '\t' << _id.ModifyDate() << '\t'
+      << _id.UploadDate() << '\t' << _id.LikeCount() << '\t'
+      << _id.DownloadCount() << '\t' << _id.FileSize() << '\t'
+      << escape(_id.LicenseName()) << '\t' << escape(_id.Description());
+  for (const std::string &tag : _id.Tags())
+    out << '\t' << escape(tag);
+  return out.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief Parse the record of a model.
+/// \param[in] _record Record to parse.
+/// \param[out] _id Model.
+/// \return False if the record is malformed.
+static bool parseRecord(const std::string &_record, ModelIdentifier &_id)
+{
+  const std::vector<std::string> fields = splitRecord(_record);
+  if (fields.size() < 10)
+    return false;
+
+  try
+  {
+    _id.SetOwner(fields[0]);
+    _id.SetName(fields[1]);
+    _id.SetVersion(std::stoul(fields[2]));
+    _id.SetModifyDate(static_cast<std::time_t>(std::stoll(fields[3])));
+    _id.SetUploadDate(static_cast<std::time_t>(std::stoll(fields[4])));
+    _id.SetLikeCount(std::stoul(fields[5]));
+    _id.SetDownloadCount(std::stoul(fields[6]));
+    _id.SetFileSize(std::stoul(fields[7]));
+  }
+  catch (const std::exception &)
+  {
+    return false;
+  }
+  _id.SetLicenseName(fields[8]);
+  _id.SetDescription(fields[9]);
+  _id.SetTags(std::vector<std::string>(fields.begin() + 10, fields.end()));
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Split text into lowercase words, made of letters and digits.
+/// \param[in] _text Text to split.
+/// \param[in] _camelCase True to also add the parts of words written in
+/// camel case, e.g. "office" and "chair" for "OfficeChair".
+/// \return The words, possibly repeated.
+static std::vector<std::string> words(const std::string &_text,
+    bool _camelCase)
+{
+  std::vector<std::string> result;
+  std::size_t i = 0;
+  while (i < _text.size())
+  {
+    if (!std::isalnum(static_cast<unsigned char>(_text[i])))
+    {
+      ++i;
+      continue;
+    }
+
+    std::size_t end = i;
+    while (end < _text.size() &&
+           std::isalnum(static_cast<unsigned char>(_text[end])))
+    {
+      ++end;
+    }
+
+    std::string word = _text.substr(i, end - i);
+    std::vector<std::string> parts;
+    if (_camelCase)
+    {
+      // A part starts at an uppercase letter that follows a lowercase
+      // letter, or that precedes one after other uppercase letters, as in
+      // "HTTPServer".
+      std::size_t start = 0;
+      for (std::size_t j = 1; j < word.size(); ++j)
+      {
+        const bool upper = std::isupper(static_cast<unsigned char>(word[j]));
+        const bool prevLower =
+          std::islower(static_cast<unsigned char>(word[j - 1]));
+        const bool prevUpper =
+          std::isupper(static_cast<unsigned char>(word[j - 1]));
+        const bool nextLower = j + 1 < word.size() &&
+          std::islower(static_cast<unsigned char>(word[j + 1]));
+        if (upper && (prevLower || (prevUpper && nextLower)))
+        {
+          parts.push_back(word.substr(start, j - start));
+          start = j;
+        }
+      }
+      if (start > 0)
+        parts.push_back(word.substr(start));
+    }
+
+    parts.push_back(word);
+    for (std::string &part : parts)
+    {
+      std::transform(part.begin(), part.end(), part.begin(),
+          [](unsigned char c) { return std::tolower(c); });
+      result.push_back(std::move(part));
+    }
+    i = end;
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the terms of a model.
+/// \param[in] _id Model.
+/// \return Weight of each term.
+static std::unordered_map<std::string, float> termWeights(
+    const ModelIdentifier &_id)
+{
+  // Names matter most, then tags and owners, then the free text.
+  std::unordered_map<std::string, float> weights;
+  auto add = [&weights](const std::string &_text, float _weight)
+  {
+    std::vector<std::string> fieldWords = words(_text, true);
+    std::sort(fieldWords.begin(), fieldWords.end());
+    fieldWords.erase(std::unique(fieldWords.begin(), fieldWords.end()),
+        fieldWords.end());
+    for (const std::string &word : fieldWords)
+      weights[word] += _weight;
+  };
+  add(_id.Name(), 3.0f);
+  for (const std::string &tag : _id.Tags())
+    add(tag, 2.0f);
+  add(_id.Owner(), 1.5f);
+  add(_id.Description(), 1.0f);
+  add(_id.LicenseName(), 0.5f);
+
+  for (auto &entry : weights)
+    entry.second = std::min(entry.second, 6.0f);
+  return weights;
+}
+
+//////////////////////////////////////////////////
+void SearchIndexPrivate::Rebuild()
+{
+  std::unordered_map<std::string, std::vector<Posting>> index;
+  this->positions.clear();
+  for (std::size_t m = 0; m < this->models.size(); ++m)
+  {
+    const ModelIdentifier &id = this->models[m];
+    this->positions[id.Owner() + "/" + id.Name()] =
+      static_cast<std::uint32_t>(m);
+    for (const auto &[word, weight] : termWeights(id))
+      index[word].push_back({static_cast<std::uint32_t>(m), weight});
+  }
+
+  this->terms.clear();
+  this->postings.clear();
+  this->terms.reserve(index.size());
+  for (const auto &entry : index)
+    this->terms.push_back(entry.first);
+  std::sort(this->terms.begin(), this->terms.end());
+  this->postings.reserve(this->terms.size());
+  for (const std::string &term : this->terms)
+    this->postings.push_back(std::move(index[term]));
+}
+
+//////////////////////////////////////////////////
+void SearchIndexPrivate::AddPostings(std::uint32_t _model)
+{
+  for (const auto &[word, weight] : termWeights(this->models[_model]))
+  {
+    auto it = std::lower_bound(this->terms.begin(), this->terms.end(), word);
+    const auto pos = it - this->terms.begin();
+    if (it == this->terms.end() || *it != word)
+    {
+      this->terms.insert(it, word);
+      this->postings.emplace(this->postings.begin() + pos);
+    }
+    this->postings[pos].push_back({_model, weight});
+  }
+}
+
+//////////////////////////////////////////////////
+void SearchIndexPrivate::RemovePostings(std::uint32_t _model)
+{
+  for (const auto &entry : termWeights(this->models[_model]))
+  {
+    auto it = std::lower_bound(this->terms.begin(), this->terms.end(),
+        entry.first);
+    if (it == this->terms.end() || *it != entry.first)
+      continue;
+
+    const auto pos = it - this->terms.begin();
+    auto &termPostings = this->postings[pos];
+    termPostings.erase(std::remove_if(termPostings.begin(),
+          termPostings.end(), [_model](const Posting &_posting)
+          {
+            return _posting.model == _model;
+          }), termPostings.end());
+    if (termPostings.empty())
+    {
+      this->terms.erase(it);
+      this->postings.erase(this->postings.begin() + pos);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+SearchIndex::SearchIndex()
+  : dataPtr(new SearchIndexPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+SearchIndex::~SearchIndex() = default;
+
+//////////////////////////////////////////////////
+bool SearchIndex::Load(const std::string &_path)
+{
+  *this->dataPtr = SearchIndexPrivate();
+
+  std::ifstream in(_path, std::ios::binary);
+  if (!in)
+    return false;
+
+  // The header is followed by the server URL.
+  std::string line;
+  std::getline(in, line);
+  const std::size_t headerSize = sizeof(kIndexHeader) - 1;
+  if (line.compare(0, headerSize, kIndexHeader) != 0 ||
+      line.size() < headerSize + 2 || line[headerSize] != '\t')
+  {
+    gzerr << "Malformed search index [" << _path << "]" << std::endl;
+    return false;
+  }
+  this->dataPtr->server.SetUrl(
+      common::URI(line.substr(headerSize + 1), true));
+
+  while (std::getline(in, line))
+  {
+    ModelIdentifier id;
+    if (!parseRecord(line, id))
+    {
+      gzerr << "Malformed search index [" << _path << "]" << std::endl;
+      *this->dataPtr = SearchIndexPrivate();
+      return false;
+    }
+    id.SetServer(this->dataPtr->server);
+    this->dataPtr->records[id.Owner() + "/" + id.Name()] = line;
+    this->dataPtr->models.push_back(std::move(id));
+  }
+
+  this->dataPtr->Rebuild();
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SearchIndex::Save(const std::string &_path) const
+{
+  const std::string tmpPath = _path + ".tmp";
+  {
+    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+    out << kIndexHeader << '\t' << this->dataPtr->server.Url().Str() << '\n';
+    for (const ModelIdentifier &id : this->dataPtr->models)
+      out << this->dataPtr->records.at(id.Owner() + "/" + id.Name()) << '\n';
+    if (!out.flush())
+    {
+      gzerr << "Unable to write [" << tmpPath << "]" << std::endl;
+      std::remove(tmpPath.c_str());
+      return false;
+    }
+  }
+
+  if (std::rename(tmpPath.c_str(), _path.c_str()) != 0)
+  {
+    gzerr << "Unable to write [" << _path << "]" << std::endl;
+    std::remove(tmpPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::size_t SearchIndex::Update(const ServerConfig &_server,
+    const std::vector<ModelIdentifier> &_models)
+{
+  std::size_t changes = 0;
+  if (_server.Url().Str() != this->dataPtr->server.Url().Str())
+  {
+    // Another server, start over.
+    changes = this->dataPtr->models.size();
+    this->dataPtr->records.clear();
+  }
+
+  std::unordered_map<std::string, std::string> records;
+  std::vector<ModelIdentifier> models;
+  models.reserve(_models.size());
+  for (const ModelIdentifier &id : _models)
+  {
+    const std::string key = id.Owner() + "/" + id.Name();
+    std::string line = record(id);
+    auto previous = this->dataPtr->records.find(key);
+    if (previous == this->dataPtr->records.end() || previous->second != line)
+      ++changes;
+    if (!records.emplace(key, std::move(line)).second)
+      continue;
+
+    models.push_back(id);
+    models.back().SetServer(_server);
+  }
+
+  // Models that are gone.
+  for (const auto &entry : this->dataPtr->records)
+  {
+    if (records.find(entry.first) == records.end())
+      ++changes;
+  }
+
+  this->dataPtr->server = _server;
+  this->dataPtr->models = std::move(models);
+  this->dataPtr->records = std::move(records);
+  this->dataPtr->Rebuild();
+  return changes;
+}
+
+//////////////////////////////////////////////////
+std::size_t SearchIndex::Merge(const ServerConfig &_server,
+    const std::vector<ModelIdentifier> &_models)
+{
+  if (_server.Url().Str() != this->dataPtr->server.Url().Str())
+    return this->Update(_server, _models);
+
+  // Only the terms of the models that changed are updated, so that a few
+  // changes don't cost a rebuild of the whole index.
+  std::size_t changes = 0;
+  for (const ModelIdentifier &id : _models)
+  {
+    const std::string key = id.Owner() + "/" + id.Name();
+    std::string line = record(id);
+    auto previous = this->dataPtr->records.find(key);
+    if (previous != this->dataPtr->records.end() && previous->second == line)
+      continue;
+    ++changes;
+
+    ModelIdentifier model = id;
+    model.SetServer(_server);
+    std::uint32_t m;
+    auto position = this->dataPtr->positions.find(key);
+    if (position == this->dataPtr->positions.end())
+    {
+      m = static_cast<std::uint32_t>(this->dataPtr->models.size());
+      this->dataPtr->models.push_back(std::move(model));
+      this->dataPtr->positions.emplace(key, m);
+    }
+    else
+    {
+      m = position->second;
+      this->dataPtr->RemovePostings(m);
+      this->dataPtr->models[m] = std::move(model);
+    }
+    this->dataPtr->records[key] = std::move(line);
+    this->dataPtr->AddPostings(m);
+  }
+  return changes;
+}
+
+//////////////////////////////////////////////////
+bool SearchIndex::Current(const ModelIdentifier &_id) const
+{
+  auto position = this->dataPtr->positions.find(_id.Owner() + "/" +
+      _id.Name());
+  return position != this->dataPtr->positions.end() &&
+    this->dataPtr->models[position->second].ModifyDate() == _id.ModifyDate();
+}
+
+//////////////////////////////////////////////////
+std::vector<ModelIdentifier> SearchIndex::Search(const std::string &_query,
+    std::size_t _limit) const
+{
+  std::vector<std::string> queryWords = words(_query, false);
+  std::sort(queryWords.begin(), queryWords.end());
+  queryWords.erase(std::unique(queryWords.begin(), queryWords.end()),
+      queryWords.end());
+  if (queryWords.empty())
+    return {};
+
+  const auto &terms = this->dataPtr->terms;
+  const float modelCount = static_cast<float>(this->dataPtr->models.size());
+
+  // Score and number of matched words by model. A model must match every
+  // word of the query.
+  std::unordered_map<std::uint32_t, std::pair<float, std::size_t>> matches;
+  for (std::size_t w = 0; w < queryWords.size(); ++w)
+  {
+    const std::string &word = queryWords[w];
+
+    // Best match of the word in each model. Prefixes weigh less than whole
+    // words, rare terms weigh more than common ones.
+    std::unordered_map<std::uint32_t, float> wordScores;
+    for (auto it = std::lower_bound(terms.begin(), terms.end(), word);
+         it != terms.end() && it->compare(0, word.size(), word) == 0; ++it)
+    {
+      const auto &termPostings = this->dataPtr->postings[it - terms.begin()];
+      const float idf = std::log(1.0f + modelCount / termPostings.size());
+      const float factor = it->size() == word.size() ? 1.0f : 0.5f;
+      for (const Posting &posting : termPostings)
+      {
+        if (w > 0)
+        {
+          auto match = matches.find(posting.model);
+          if (match == matches.end() || match->second.second != w)
+            continue;
+        }
+        float &score = wordScores[posting.model];
+        score = std::max(score, posting.weight * idf * factor);
+      }
+    }
+
+    if (wordScores.empty())
+      return {};
+
+    for (const auto &[model, score] : wordScores)
+    {
+      auto &match = matches[model];
+      match.first += score;
+      match.second = w + 1;
+    }
+  }
+
+  std::vector<std::pair<float, std::uint32_t>> ranked;
+  for (const auto &[model, match] : matches)
+  {
+    if (match.second == queryWords.size())
+      ranked.emplace_back(match.first, model);
+  }
+
+  // Ties go to the most downloaded models.
+  const auto &models = this->dataPtr->models;
+  auto better = [&models](const std::pair<float, std::uint32_t> &_a,
+      const std::pair<float, std::uint32_t> &_b)
+  {
+    if (_a.first != _b.first)
+      return _a.first > _b.first;
+    const ModelIdentifier &a = models[_a.second];
+    const ModelIdentifier &b = models[_b.second];
+    if (a.DownloadCount() != b.DownloadCount())
+      return a.DownloadCount() > b.DownloadCount();
+    return a.UniqueName() < b.UniqueName();
+  };
+  if (_limit > 0 && _limit < ranked.size())
+  {
+    std::partial_sort(ranked.begin(), ranked.begin() + _limit, ranked.end(),
+        better);
+    ranked.resize(_limit);
+  }
+  else
+  {
+    std::sort(ranked.begin(), ranked.end(), better);
+  }
+
+  std::vector<ModelIdentifier> result;
+  result.reserve(ranked.size());
+  for (const auto &entry : ranked)
+    result.push_back(models[entry.second]);
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::size_t SearchIndex::Size() const
+{
+  return this->dataPtr->models.size();
+}
+}  // namespace gz::fuel_tools
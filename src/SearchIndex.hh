@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_SEARCHINDEX_HH_
+#define GZ_FUEL_TOOLS_SEARCHINDEX_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+#include "gz/fuel_tools/ModelIdentifier.hh"
+#include "gz/fuel_tools/ServerConfig.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class SearchIndexPrivate;
+
+  /// \brief Inverted index over the model catalog of a server, built from
+  /// the listing data: name, owner, tags, description and license.
+  ///
+  /// The index is kept on disk so that it can be queried without any
+  /// network access, and is refreshed from new listings.
+  class GZ_FUEL_TOOLS_VISIBLE SearchIndex
+  {
+    /// \brief Constructor of an empty index.
+    public: SearchIndex();
+
+    /// \brief Destructor.
+    public: ~SearchIndex();
+
+    /// \brief Load an index saved with Save.
+    /// \param[in] _path Path of the index.
+    /// \return False if the index is missing or malformed, in which case
+    /// the index is left empty.
+    public: bool Load(const std::string &_path);
+
+    /// \brief Save the index. The index is written to a temporary file
+    /// first, so that readers never see a partial index.
+    /// \param[in] _path Path of the index.
+    /// \return True on success.
+    public: bool Save(const std::string &_path) const;
+
+    /// \brief Replace the indexed catalog with a new listing. Only the
+    /// models that were added, changed or removed are counted, so that
+    /// callers can skip saving an unchanged index.
+    /// \param[in] _server Server the listing comes from.
+    /// \param[in] _models All the models of the server.
+    /// \return Number of models added, changed or removed.
+    public: std::size_t Update(const ServerConfig &_server,
+                const std::vector<ModelIdentifier> &_models);
+
+    /// \brief Add or replace some models of the indexed catalog, e.g. the
+    /// ones changed since the last listing, and keep the others. Unlike
+    /// Update, models that are gone from the server stay indexed.
+    /// \param[in] _server Server the models come from. A server other than
+    /// the indexed one replaces the catalog, as Update does.
+    /// \param[in] _models Models to add or replace.
+    /// \return Number of models added or changed.
+    public: std::size_t Merge(const ServerConfig &_server,
+                const std::vector<ModelIdentifier> &_models);
+
+    /// \brief Check whether a model is indexed as it was last modified.
+    /// \param[in] _id Model, with its modification date.
+    /// \return True if the model is indexed with the same modification
+    /// date.
+    public: bool Current(const ModelIdentifier &_id) const;
+
+    /// \brief Find the models matching all the words of a query. Words
+    /// also match as prefixes, and words written in camel case, in tags or
+    /// descriptions, are indexed by parts, e.g. "chair" matches
+    /// "OfficeChair".
+    /// \param[in] _query Words to look for, case insensitive.
+    /// \param[in] _limit Maximum number of results, 0 for no limit.
+    /// \return The matching models, best matches first.
+    public: std::vector<ModelIdentifier> Search(const std::string &_query,
+                std::size_t _limit = 0) const;
+
+    /// \brief Get the number of indexed models.
+    /// \return Number of models.
+    public: std::size_t Size() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<SearchIndexPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_SEARCHINDEX_HH_
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "SearchIndex.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class SearchIndexTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+    server.SetUrl(common::URI("https://fuel.gazebosim.org", true));
+  }
+
+  /// \brief Create a model identifier.
+  /// \param[in] _owner Owner of the model.
+  /// \param[in] _name Name of the model.
+  /// \param[in] _description Description of the model.
+  /// \param[in] _tags Tags of the model.
+  /// \param[in] _downloads Number of downloads.
+  /// \return The identifier.
+  public: static ModelIdentifier Model(const std::string &_owner,
+      const std::string &_name, const std::string &_description = "",
+      const std::vector<std::string> &_tags = {},
+      unsigned int _downloads = 0)
+  {
+    ModelIdentifier id;
+    id.SetOwner(_owner);
+    id.SetName(_name);
+    id.SetDescription(_description);
+    id.SetTags(_tags);
+    id.SetDownloadCount(_downloads);
+    id.SetVersion(1);
+    return id;
+  }
+
+  /// \brief Get the names of models.
+  /// \param[in] _ids Models.
+  /// \return Their names, in order.
+  public: static std::vector<std::string> Names(
+      const std::vector<ModelIdentifier> &_ids)
+  {
+    std::vector<std::string> names;
+    for (const auto &id : _ids)
+      names.push_back(id.Name());
+    return names;
+  }
+
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+
+  public: ServerConfig server;
+};
+
+/////////////////////////////////////////////////
+TEST_F(SearchIndexTest, Search)
+{
+  SearchIndex index;
+  EXPECT_EQ(3u, index.Update(this->server, {
+      Model("OpenRobotics", "OfficeChair", "A chair\twith wheels",
+            {"OfficeFurniture"}, 10),
+      Model("OpenRobotics", "Ambulance", "Emergency vehicle",
+            {"vehicle", "car"}, 50),
+      Model("alice", "FireTruck", "Red truck, for fires", {"vehicle"}, 5)}));
+  EXPECT_EQ(3u, index.Size());
+
+  // Camel case parts of tags, owners and descriptions are searchable.
+  EXPECT_EQ(std::vector<std::string>{"officechair"},
+      Names(index.Search("chair")));
+  EXPECT_EQ(std::vector<std::string>{"officechair"},
+      Names(index.Search("FURNITURE")));
+  EXPECT_EQ(std::vector<std::string>{"firetruck"},
+      Names(index.Search("alice")));
+  EXPECT_EQ(std::vector<std::string>{"firetruck"},
+      Names(index.Search("red")));
+
+  // All the words must match, prefixes match too.
+  EXPECT_EQ(std::vector<std::string>({"ambulance", "firetruck"}),
+      Names(index.Search("vehicle")));
+  EXPECT_EQ(std::vector<std::string>{"firetruck"},
+      Names(index.Search("vehicle tru")));
+  EXPECT_TRUE(index.Search("vehicle banana").empty());
+  EXPECT_TRUE(index.Search("").empty());
+
+  // Names weigh more than descriptions.
+  EXPECT_EQ("firetruck", index.Search("truck")[0].Name());
+  EXPECT_EQ(1u, index.Search("vehicle", 1).size());
+
+  // Results carry the server.
+  EXPECT_EQ(this->server.Url().Str(),
+      index.Search("chair")[0].Server().Url().Str());
+}
+
+/////////////////////////////////////////////////
+TEST_F(SearchIndexTest, SaveLoadUpdate)
+{
+  const std::string path =
+    common::joinPaths(this->tempDir->Path(), ".search_index");
+
+  SearchIndex index;
+  EXPECT_FALSE(index.Load(path));
+  index.Update(this->server, {
+      Model("OpenRobotics", "OfficeChair", "A chair\nwith wheels",
+            {"furniture", "office\\desk"}),
+      Model("OpenRobotics", "Ambulance", "", {"vehicle"})});
+  ASSERT_TRUE(index.Save(path));
+  EXPECT_FALSE(common::exists(path + ".tmp"));
+
+  SearchIndex loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(2u, loaded.Size());
+  auto results = loaded.Search("chair");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ("openrobotics", results[0].Owner());
+  EXPECT_EQ("A chair\nwith wheels", results[0].Description());
+  EXPECT_EQ(std::vector<std::string>({"furniture", "office\\desk"}),
+      results[0].Tags());
+  EXPECT_EQ(this->server.Url().Str(), results[0].Server().Url().Str());
+
+  // Only the changes are counted.
+  EXPECT_EQ(0u, loaded.Update(this->server, {
+      Model("OpenRobotics", "OfficeChair", "A chair\nwith wheels",
+            {"furniture", "office\\desk"}),
+      Model("OpenRobotics", "Ambulance", "", {"vehicle"})}));
+  EXPECT_EQ(3u, loaded.Update(this->server, {
+      Model("OpenRobotics", "OfficeChair", "A chair", {"furniture"}),
+      Model("alice", "FireTruck")}));
+  EXPECT_TRUE(loaded.Search("ambulance").empty());
+  EXPECT_EQ(1u, loaded.Search("firetruck").size());
+
+  std::ofstream(path) << "not an index\n";
+  EXPECT_FALSE(loaded.Load(path));
+  EXPECT_EQ(0u, loaded.Size());
+}
+
+/////////////////////////////////////////////////
+TEST_F(SearchIndexTest, Merge)
+{
+  ModelIdentifier chair = Model("OpenRobotics", "OfficeChair", "A chair");
+  chair.SetModifyDate(100);
+  ModelIdentifier ambulance = Model("OpenRobotics", "Ambulance", "",
+      {"vehicle"});
+  ambulance.SetModifyDate(200);
+
+  SearchIndex index;
+  index.Update(this->server, {chair, ambulance});
+  EXPECT_TRUE(index.Current(chair));
+  EXPECT_TRUE(index.Current(ambulance));
+  EXPECT_FALSE(index.Current(Model("alice", "FireTruck")));
+
+  // Changed models are replaced, new ones added and the others kept.
+  ModelIdentifier newChair = Model("OpenRobotics", "OfficeChair",
+      "A stool", {"furniture"});
+  newChair.SetModifyDate(300);
+  EXPECT_FALSE(index.Current(newChair));
+  EXPECT_EQ(2u, index.Merge(this->server,
+      {newChair, Model("alice", "FireTruck", "", {"vehicle"}), ambulance}));
+  EXPECT_EQ(3u, index.Size());
+  EXPECT_TRUE(index.Current(newChair));
+  EXPECT_TRUE(index.Search("chair").empty());
+  EXPECT_EQ(std::vector<std::string>({"officechair"}),
+      Names(index.Search("stool furniture")));
+  EXPECT_EQ(2u, index.Search("vehicle").size());
+  EXPECT_EQ(0u, index.Merge(this->server, {newChair}));
+
+  // The merged index searches like one built at once.
+  const std::string path =
+    common::joinPaths(this->tempDir->Path(), ".search_index");
+  ASSERT_TRUE(index.Save(path));
+  SearchIndex loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(3u, loaded.Size());
+  EXPECT_EQ(Names(index.Search("vehicle")), Names(loaded.Search("vehicle")));
+  EXPECT_EQ(std::vector<std::string>({"officechair"}),
+      Names(loaded.Search("stool")));
+}
+
+/////////////////////////////////////////////////
+TEST_F(SearchIndexTest, LargeCatalog)
+{
+  // A catalog the size of the main Fuel server.
+  std::vector<ModelIdentifier> models;
+  for (int i = 0; i < 20000; ++i)
+  {
+    models.push_back(Model("owner" + std::to_string(i % 300),
+        "Model" + std::to_string(i), "Description of model number " +
+        std::to_string(i), {"tag" + std::to_string(i % 50)}, i));
+  }
+
+  const std::string path =
+    common::joinPaths(this->tempDir->Path(), ".search_index");
+  SearchIndex index;
+  index.Update(this->server, models);
+  ASSERT_TRUE(index.Save(path));
+
+  auto start = std::chrono::steady_clock::now();
+  SearchIndex loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  auto results = loaded.Search("description tag7 owner1", 10);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  ASSERT_EQ(10u, results.size());
+  EXPECT_EQ("tag7", results[0].Tags()[0]);
+  std::cout << "Loaded and queried " << models.size() << " models in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                elapsed).count() << " ms" << std::endl;
+}
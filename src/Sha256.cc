@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define GZ_FUEL_TOOLS_SHA_NI
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include <gz/common/Console.hh>
+
+#include "FileSync.hh"
+#include "Sha256.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Round constants.
+alignas(16) static const std::uint32_t kRoundConstants[64] =
+{
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+  0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+  0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+  0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+  0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+  0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+//////////////////////////////////////////////////
+/// \brief Rotate a word right.
+/// \param[in] _x Word to rotate.
+/// \param[in] _n Number of bits, between 1 and 31.
+/// \return Rotated word.
+static inline std::uint32_t rotr(std::uint32_t _x, int _n)
+{
+  return (_x >> _n) | (_x << (32 - _n));
+}
+
+//////////////////////////////////////////////////
+/// \brief Hash whole blocks with the portable implementation.
+/// \param[in,out] _state Intermediate hash value.
+/// \param[in] _data First block.
+/// \param[in] _blocks Number of 64 byte blocks.
+static void compressPortable(std::uint32_t *_state, const std::uint8_t *_data,
+    std::size_t _blocks)
+{
+  for (; _blocks > 0; --_blocks, _data += 64)
+  {
+    std::uint32_t w[64];
+    for (int i = 0; i < 16; ++i)
+    {
+      w[i] = (std::uint32_t(_data[4 * i]) << 24) |
+        (std::uint32_t(_data[4 * i + 1]) << 16) |
+        (std::uint32_t(_data[4 * i + 2]) << 8) |
+        std::uint32_t(_data[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; ++i)
+    {
+      const std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^
+        (w[i - 15] >> 3);
+      const std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^
+        (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    std::uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+    std::uint32_t e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+    for (int i = 0; i < 64; ++i)
+    {
+      const std::uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+      const std::uint32_t ch = (e & f) ^ (~e & g);
+      const std::uint32_t t1 = h + s1 + ch + kRoundConstants[i] + w[i];
+      const std::uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+      const std::uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+      const std::uint32_t t2 = s0 + maj;
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+
+    _state[0] += a;
+    _state[1] += b;
+    _state[2] += c;
+    _state[3] += d;
+    _state[4] += e;
+    _state[5] += f;
+    _state[6] += g;
+    _state[7] += h;
+  }
+}
+
+#ifdef GZ_FUEL_TOOLS_SHA_NI
+//////////////////////////////////////////////////
+/// \brief Hash whole blocks with the SHA extensions.
+/// \param[in,out] _state Intermediate hash value.
+/// \param[in] _data First block.
+/// \param[in] _blocks Number of 64 byte blocks.
+#ifndef _MSC_VER
+__attribute__((target("sha,sse4.1")))
+#endif
+static void compressShaNi(std::uint32_t *_state, const std::uint8_t *_data,
+    std::size_t _blocks)
+{
+  // The instructions work on the state as ABEF and CDGH.
+  const __m128i byteSwap =
+    _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i tmp = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(&_state[0])), 0xB1);
+  __m128i state1 = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(&_state[4])), 0x1B);
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+  for (; _blocks > 0; --_blocks, _data += 64)
+  {
+    const __m128i savedState0 = state0;
+    const __m128i savedState1 = state1;
+
+    // Four words of the message schedule each.
+    __m128i msg[4];
+    for (int i = 0; i < 4; ++i)
+    {
+      msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(_data + 16 * i)), byteSwap);
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+      __m128i words = _mm_add_epi32(msg[i & 3], _mm_load_si128(
+          reinterpret_cast<const __m128i *>(&kRoundConstants[4 * i])));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+      words = _mm_shuffle_epi32(words, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, words);
+
+      // Replace these words with the ones needed four steps later.
+      if (i < 12)
+      {
+        const __m128i &next3 = msg[(i + 3) & 3];
+        __m128i next = _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]);
+        next = _mm_add_epi32(next,
+            _mm_alignr_epi8(next3, msg[(i + 2) & 3], 4));
+        msg[i & 3] = _mm_sha256msg2_epu32(next, next3);
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, savedState0);
+    state1 = _mm_add_epi32(state1, savedState1);
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, tmp, 8);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&_state[0]), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&_state[4]), state1);
+}
+#endif
+
+//////////////////////////////////////////////////
+Sha256::Sha256(bool _accelerate)
+  : accelerate(_accelerate && Accelerated())
+{
+  this->Reset();
+}
+
+//////////////////////////////////////////////////
+void Sha256::Reset()
+{
+  static const std::uint32_t kInitialState[8] =
+  {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+  std::memcpy(this->state, kInitialState, sizeof(this->state));
+  this->buffered = 0;
+  this->length = 0;
+}
+
+//////////////////////////////////////////////////
+void Sha256::Compress(const std::uint8_t *_data, std::size_t _blocks)
+{
+#ifdef GZ_FUEL_TOOLS_SHA_NI
+  if (this->accelerate)
+  {
+    compressShaNi(this->state, _data, _blocks);
+    return;
+  }
+#endif
+  compressPortable(this->state, _data, _blocks);
+}
+
+//////////////////////////////////////////////////
+void Sha256::Update(const void *_data, std::size_t _size)
+{
+  const std::uint8_t *data = static_cast<const std::uint8_t *>(_data);
+  this->length += _size;
+
+  if (this->buffered > 0)
+  {
+    const std::size_t count = std::min(_size, 64 - this->buffered);
+    std::memcpy(this->buffer + this->buffered, data, count);
+    this->buffered += count;
+    data += count;
+    _size -= count;
+    if (this->buffered < 64)
+      return;
+    this->Compress(this->buffer, 1);
+    this->buffered = 0;
+  }
+
+  // Whole blocks are hashed in place.
+  if (_size >= 64)
+  {
+    this->Compress(data, _size / 64);
+    data += _size - _size % 64;
+    _size %= 64;
+  }
+
+  if (_size > 0)
+  {
+    std::memcpy(this->buffer, data, _size);
+    this->buffered = _size;
+  }
+}
+
+//////////////////////////////////////////////////
+Sha256::Digest Sha256::Final()
+{
+  // Pad with a one bit, zeros, and the length in bits.
+  const std::uint64_t bits = this->length * 8;
+  std::uint8_t padding[72] = {0x80};
+  const std::size_t zeros = (this->buffered < 56 ? 56 : 120) - this->buffered;
+  for (int i = 0; i < 8; ++i)
+    padding[zeros + i] = static_cast<std::uint8_t>(bits >> (56 - 8 * i));
+  this->Update(padding, zeros + 8);
+
+  Digest digest;
+  for (int i = 0; i < 8; ++i)
+  {
+    digest[4 * i] = static_cast<std::uint8_t>(this->state[i] >> 24);
+    digest[4 * i + 1] = static_cast<std::uint8_t>(this->state[i] >> 16);
+    digest[4 * i + 2] = static_cast<std::uint8_t>(this->state[i] >> 8);
+    digest[4 * i + 3] = static_cast<std::uint8_t>(this->state[i]);
+  }
+
+  this->Reset();
+  return digest;
+}
+
+//////////////////////////////////////////////////
+Sha256::Digest Sha256::Hash(const void *_data, std::size_t _size)
+{
+  Sha256 sha;
+  sha.Update(_data, _size);
+  return sha.Final();
+}
+
+//////////////////////////////////////////////////
+std::string Sha256::Hex(const Digest &_digest)
+{
+  static const char kDigits[] = "0123456789abcdef";
+  std::string hex;
+  hex.reserve(2 * _digest.size());
+  for (std::uint8_t byte : _digest)
+  {
+    hex += kDigits[byte >> 4];
+    hex += kDigits[byte & 0xf];
+  }
+  return hex;
+}
+
+//////////////////////////////////////////////////
+bool Sha256::Accelerated()
+{
+#ifdef GZ_FUEL_TOOLS_SHA_NI
+  static const bool accelerated = []()
+  {
+    // SSSE3 and SSE4.1 in leaf 1, SHA in leaf 7.
+    unsigned int leaf1[4] = {0, 0, 0, 0};
+    unsigned int leaf7[4] = {0, 0, 0, 0};
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7)
+      return false;
+    __cpuid(regs, 1);
+    leaf1[2] = regs[2];
+    __cpuidex(regs, 7, 0);
+    leaf7[1] = regs[1];
+#else
+    if (__get_cpuid_max(0, nullptr) < 7)
+      return false;
+    __get_cpuid(1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+    __get_cpuid_count(7, 0, &leaf7[0], &leaf7[1], &leaf7[2], &leaf7[3]);
+#endif
+    const bool ssse3 = leaf1[2] & (1u << 9);
+    const bool sse41 = leaf1[2] & (1u << 19);
+    const bool sha = leaf7[1] & (1u << 29);
+    return ssse3 && sse41 && sha;
+  }();
+  return accelerated;
+#else
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool writeSha256Manifest(const std::string &_path,
+    const std::map<std::string, std::string> &_hashes, bool _sync)
+{
+  const std::string tmpPath = _path + ".tmp";
+  {
+    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+    for (const auto &[file, hash] : _hashes)
+      out << hash << "  " << file << "\n";
+    if (!out.flush())
+    {
+      gzerr << "Unable to write [" << tmpPath << "]" << std::endl;
+      std::remove(tmpPath.c_str());
+      return false;
+    }
+  }
+
+  if ((_sync && !syncFile(tmpPath)) ||
+      std::rename(tmpPath.c_str(), _path.c_str()) != 0)
+  {
+    gzerr << "Unable to write [" << _path << "]" << std::endl;
+    std::remove(tmpPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool readSha256Manifest(const std::string &_path,
+    std::map<std::string, std::string> &_hashes)
+{
+  std::ifstream in(_path, std::ios::binary);
+  if (!in)
+    return false;
+
+  std::map<std::string, std::string> hashes;
+  std::string line;
+  while (std::getline(in, line))
+  {
+    // <64 hex digits><two spaces><path>
+    if (line.size() < 67 || line.compare(64, 2, "  ") != 0 ||
+        line.find_first_not_of("0123456789abcdef") < 64)
+    {
+      gzerr << "Malformed manifest [" << _path << "]" << std::endl;
+      return false;
+    }
+    hashes[line.substr(66)] = line.substr(0, 64);
+  }
+
+  _hashes = std::move(hashes);
+  return true;
+}
+}  // namespace gz::fuel_tools
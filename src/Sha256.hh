@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_SHA256_HH_
+#define GZ_FUEL_TOOLS_SHA256_HH_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "gz/fuel_tools/Export.hh"
+
+namespace gz::fuel_tools
+{
+  /// \brief Incremental SHA-256 hash, computed on data as it streams by,
+  /// e.g. a download or an archive being extracted.
+  ///
+  /// The SHA extensions of x86 CPUs are used when available, with a
+  /// portable implementation as a fallback.
+  class GZ_FUEL_TOOLS_VISIBLE Sha256
+  {
+    /// \brief A SHA-256 digest.
+    public: using Digest = std::array<std::uint8_t, 32>;
+
+    /// \brief Constructor.
+    /// \param[in] _accelerate False to use the portable implementation even
+    /// if the CPU has SHA extensions.
+    public: explicit Sha256(bool _accelerate = true);
+
+    /// \brief Hash more data.
+    /// \param[in] _data Data to hash.
+    /// \param[in] _size Size of the data in bytes.
+    public: void Update(const void *_data, std::size_t _size);
+
+    /// \brief Get the digest of all the data hashed so far, and start over.
+    /// \return The digest.
+    public: Digest Final();
+
+    /// \brief Hash a buffer.
+    /// \param[in] _data Data to hash.
+    /// \param[in] _size Size of the data in bytes.
+    /// \return The digest.
+    public: static Digest Hash(const void *_data, std::size_t _size);
+
+    /// \brief Get the lowercase hexadecimal form of a digest.
+    /// \param[in] _digest Digest to convert.
+    /// \return 64 hexadecimal digits.
+    public: static std::string Hex(const Digest &_digest);
+
+    /// \brief Get whether the CPU has the SHA extensions.
+    /// \return True if the accelerated implementation can be used.
+    public: static bool Accelerated();
+
+    /// \brief Reset the state to the initial hash value.
+    private: void Reset();
+
+    /// \brief Hash whole blocks.
+    /// \param[in] _data First block.
+    /// \param[in] _blocks Number of 64 byte blocks.
+    private: void Compress(const std::uint8_t *_data, std::size_t _blocks);
+
+    /// \brief True to use the SHA extensions.
+    private: bool accelerate;
+
+    /// \brief Intermediate hash value.
+    private: std::uint32_t state[8];
+
+    /// \brief Data waiting for a whole block.
+    private: std::uint8_t buffer[64];
+
+    /// \brief Number of bytes in buffer.
+    private: std::size_t buffered = 0;
+
+    /// \brief Number of bytes hashed.
+    private: std::uint64_t length = 0;
+  };
+
+  /// \brief Write a manifest of file hashes, in the format of sha256sum.
+  /// The manifest is written to a temporary file first, so that readers
+  /// never see a partial manifest.
+  /// \param[in] _path Path of the manifest.
+  /// \param[in] _hashes Hexadecimal digests by file path.
+  /// \param[in] _sync True to flush the manifest to storage.
+  /// \return True on success.
+  GZ_FUEL_TOOLS_VISIBLE
+  bool writeSha256Manifest(const std::string &_path,
+      const std::map<std::string, std::string> &_hashes, bool _sync);
+
+  /// \brief Read a manifest written by writeSha256Manifest.
+  /// \param[in] _path Path of the manifest.
+  /// \param[out] _hashes Hexadecimal digests by file path.
+  /// \return False if the manifest is missing or malformed.
+  GZ_FUEL_TOOLS_VISIBLE
+  bool readSha256Manifest(const std::string &_path,
+      std::map<std::string, std::string> &_hashes);
+}  // namespace gz::fuel_tools
+
+#endif  // GZ_FUEL_TOOLS_SHA256_HH_
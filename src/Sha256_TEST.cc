@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "Sha256.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+/// \brief Parameterized on whether the SHA extensions may be used.
+class Sha256Test : public ::testing::TestWithParam<bool>
+{
+  /// \brief Hash a string in one go.
+  /// \param[in] _data Data to hash.
+  /// \return Hexadecimal digest.
+  public: std::string Hash(const std::string &_data)
+  {
+    Sha256 sha(GetParam());
+    sha.Update(_data.data(), _data.size());
+    return Sha256::Hex(sha.Final());
+  }
+};
+
+/////////////////////////////////////////////////
+TEST_P(Sha256Test, TestVectors)
+{
+  if (GetParam() && !Sha256::Accelerated())
+    GTEST_SKIP() << "No SHA extensions on this CPU";
+
+  // FIPS 180-2 examples.
+  EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+      this->Hash(""));
+  EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+      this->Hash("abc"));
+  EXPECT_EQ("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+      this->Hash("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+  EXPECT_EQ("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0",
+      this->Hash(std::string(1000000, 'a')));
+}
+
+/////////////////////////////////////////////////
+TEST_P(Sha256Test, Incremental)
+{
+  std::mt19937 gen(42);
+  std::string data(100000, '\0');
+  for (char &c : data)
+    c = static_cast<char>(gen());
+
+  // Chunks of any size, including around the block boundaries, give the
+  // same digest as hashing in one go, with both implementations.
+  const Sha256::Digest expected = Sha256::Hash(data.data(), data.size());
+  Sha256 portable(false);
+  portable.Update(data.data(), data.size());
+  EXPECT_EQ(expected, portable.Final());
+
+  for (std::size_t chunk : {1u, 7u, 63u, 64u, 65u, 1000u})
+  {
+    Sha256 sha(GetParam());
+    for (std::size_t offset = 0; offset < data.size(); offset += chunk)
+      sha.Update(data.data() + offset, std::min(chunk, data.size() - offset));
+    EXPECT_EQ(expected, sha.Final()) << chunk;
+  }
+
+  // Final starts over.
+  Sha256 sha(GetParam());
+  sha.Update("abc", 3);
+  sha.Final();
+  sha.Update("abc", 3);
+  EXPECT_EQ(Sha256::Hash("abc", 3), sha.Final());
+}
+
+INSTANTIATE_TEST_SUITE_P(Implementations, Sha256Test,
+    ::testing::Values(true, false));
+
+/////////////////////////////////////////////////
+TEST(Sha256, Manifest)
+{
+  common::Console::SetVerbosity(4);
+  auto tempDir = common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+  const std::string path = common::joinPaths(tempDir->Path(), "1.sha256");
+
+  std::map<std::string, std::string> hashes =
+  {
+    {"model.config", Sha256::Hex(Sha256::Hash("config", 6))},
+    {"meshes/my mesh.dae", Sha256::Hex(Sha256::Hash("mesh", 4))},
+  };
+  ASSERT_TRUE(writeSha256Manifest(path, hashes, true));
+  EXPECT_FALSE(common::exists(path + ".tmp"));
+
+  std::map<std::string, std::string> read;
+  ASSERT_TRUE(readSha256Manifest(path, read));
+  EXPECT_EQ(hashes, read);
+
+  EXPECT_FALSE(readSha256Manifest(path + ".missing", read));
+
+  std::ofstream(path) << "not a manifest\n";
+  EXPECT_FALSE(readSha256Manifest(path, read));
+  EXPECT_EQ(hashes, read);
+}
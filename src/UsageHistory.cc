@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+
+#include "UsageHistory.hh"
+
+namespace gz::fuel_tools
+{
+/// \brief Extension of the history files.
+static const char kExtension[] = ".usage";
+
+/// \brief Number of lines of a history file per resource above which the
+/// file is compacted.
+static constexpr std::size_t kCompactionRatio = 4;
+
+/// \brief Private data class
+class UsageHistoryPrivate
+{
+  /// \brief Get the path of the history file of a tag.
+  /// \param[in] _tag Usage tag.
+  /// \return Path of the file.
+  public: std::string Path(const std::string &_tag) const;
+
+  /// \brief Read the history file of a tag.
+  /// \param[in] _tag Usage tag.
+  /// \param[out] _lines Number of lines read.
+  /// \return Use counts by resource URL, in no particular order.
+  public: std::map<std::string, std::size_t> Read(const std::string &_tag,
+              std::size_t &_lines) const;
+
+  /// \brief Rewrite the history file of a tag with one line per resource
+  /// if it has grown much larger than that.
+  /// \param[in] _tag Usage tag.
+  public: void Compact(const std::string &_tag) const;
+
+  /// \brief Directory of the history files.
+  public: std::string dir;
+
+  /// \brief Protects recorded.
+  public: std::mutex mutex;
+
+  /// \brief Resources recorded by this session, by tag.
+  public: std::map<std::string, std::set<std::string>> recorded;
+};
+
+//////////////////////////////////////////////////
+/// \brief Percent-encode the characters of a tag which aren't safe in a
+/// file name.
+/// \param[in] _tag Tag to encode.
+/// \return File name of the tag, without extension.
+static std::string encodeTag(const std::string &_tag)
+{
+  static const char kHex[] = "0123456789ABCDEF";
+  std::string result;
+  for (unsigned char c : _tag)
+  {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.')
+    {
+      result += static_cast<char>(c);
+    }
+    else
+    {
+      result += '%';
+      result += kHex[c >> 4];
+      result += kHex[c & 0xF];
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+/// \brief Decode a file name produced by encodeTag.
+/// \param[in] _name File name, without extension.
+/// \return The tag, or nullopt if an escape isn't followed by two
+/// hexadecimal digits.
+static std::optional<std::string> decodeTag(const std::string &_name)
+{
+  std::string result;
+  for (std::size_t i = 0; i < _name.size(); ++i)
+  {
+    if (_name[i] != '%')
+    {
+      result += _name[i];
+      continue;
+    }
+
+    const char *first = _name.data() + i + 1;
+    const char *last = first + std::min<std::size_t>(2, _name.size() - i - 1);
+    std::uint8_t c = 0;
+    auto [ptr, ec] = std::from_chars(first, last, c, 16);
+    if (ec != std::errc() || ptr != first + 2)
+      return std::nullopt;
+    result += static_cast<char>(c);
+    i += 2;
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::string UsageHistoryPrivate::Path(const std::string &_tag) const
+{
+  return common::joinPaths(this->dir, encodeTag(_tag) + kExtension);
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, std::size_t> UsageHistoryPrivate::Read(
+    const std::string &_tag, std::size_t &_lines) const
+{
+  // Each line is "<count>\t<url>".
+  std::map<std::string, std::size_t> counts;
+  _lines = 0;
+  std::ifstream in(this->Path(_tag));
+  std::string line;
+  while (std::getline(in, line))
+  {
+    auto tab = line.find('\t');
+    if (tab == std::string::npos || tab + 1 == line.size())
+      continue;
+    std::size_t count = 0;
+    try
+    {
+      count = std::stoul(line.substr(0, tab));
+    }
+    catch (const std::exception &)
+    {
+      continue;
+    }
+    counts[line.substr(tab + 1)] += count;
+    ++_lines;
+  }
+  return counts;
+}
+
+//////////////////////////////////////////////////
+void UsageHistoryPrivate::Compact(const std::string &_tag) const
+{
+  std::size_t lines = 0;
+  auto counts = this->Read(_tag, lines);
+  if (lines <= kCompactionRatio * counts.size())
+    return;
+
+  // Lines appended by other processes between the read and the rename are
+  // lost, which only lowers a few counts.
+  const std::string path = this->Path(_tag);
+  const std::string tmpPath = path + ".tmp";
+  {
+    std::ofstream out(tmpPath, std::ios::trunc);
+    for (const auto &[url, count] : counts)
+      out << count << '\t' << url << '\n';
+    if (!out.good())
+    {
+      common::removeFile(tmpPath);
+      return;
+    }
+  }
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    common::removeFile(tmpPath);
+}
+
+//////////////////////////////////////////////////
+UsageHistory::UsageHistory(const std::string &_dir)
+  : dataPtr(new UsageHistoryPrivate)
+{
+  this->dataPtr->dir = _dir;
+}
+
+//////////////////////////////////////////////////
+UsageHistory::~UsageHistory() = default;
+
+//////////////////////////////////////////////////
+bool UsageHistory::Record(const std::string &_tag, const std::string &_url)
+{
+  if (_tag.empty() || _url.empty() ||
+      _url.find_first_of("\n\r") != std::string::npos)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto &recorded = this->dataPtr->recorded[_tag];
+  if (recorded.count(_url))
+    return true;
+
+  if (!common::isDirectory(this->dataPtr->dir) &&
+      !common::createDirectories(this->dataPtr->dir))
+  {
+    gzerr << "Unable to create usage history directory ["
+          << this->dataPtr->dir << "]" << std::endl;
+    return false;
+  }
+
+  // Once per session and tag, keep the file from growing without bounds.
+  if (recorded.empty())
+    this->dataPtr->Compact(_tag);
+
+  // A single short append, so that concurrent sessions don't interleave.
+  std::ofstream out(this->dataPtr->Path(_tag), std::ios::app);
+  out << "1\t" + _url + "\n" << std::flush;
+  if (!out.good())
+  {
+    gzerr << "Unable to record usage of [" << _url << "] under tag ["
+          << _tag << "]" << std::endl;
+    return false;
+  }
+
+  recorded.insert(_url);
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> UsageHistory::Resources(
+    const std::string &_tag) const
+{
+  auto counts = this->Counts(_tag);
+  std::vector<std::pair<std::string, std::size_t>> sorted(
+      counts.begin(), counts.end());
+  std::stable_sort(sorted.begin(), sorted.end(),
+      [](const auto &_a, const auto &_b)
+      {
+        return _a.second > _b.second;
+      });
+
+  std::vector<std::string> result;
+  result.reserve(sorted.size());
+  for (const auto &entry : sorted)
+    result.push_back(entry.first);
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, std::size_t> UsageHistory::Counts(
+    const std::string &_tag) const
+{
+  if (_tag.empty())
+    return {};
+  std::size_t lines = 0;
+  return this->dataPtr->Read(_tag, lines);
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> UsageHistory::Tags() const
+{
+  std::vector<std::string> tags;
+  if (!common::isDirectory(this->dataPtr->dir))
+    return tags;
+
+  const std::string extension = kExtension;
+  common::DirIter end;
+  for (common::DirIter file(this->dataPtr->dir); file != end; ++file)
+  {
+    std::string name = common::basename(*file);
+    if (name.size() > extension.size() &&
+        name.compare(name.size() - extension.size(), extension.size(),
+          extension) == 0)
+    {
+      // Skip the files which weren't written by Record.
+      auto tag = decodeTag(name.substr(0, name.size() - extension.size()));
+      if (tag)
+        tags.push_back(*tag);
+    }
+  }
+  std::sort(tags.begin(), tags.end());
+  return tags;
+}
+}  // namespace gz::fuel_tools
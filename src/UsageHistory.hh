@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_FUEL_TOOLS_USAGEHISTORY_HH_
+#define GZ_FUEL_TOOLS_USAGEHISTORY_HH_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/Export.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace gz::fuel_tools
+{
+  /// \brief Forward declaration
+  class UsageHistoryPrivate;
+
+  /// \brief Record of the resources used under each usage tag, such as a
+  /// world or a simulation job, kept in the local cache.
+  ///
+  /// Each tag has its own append-only file with one line per resource and
+  /// session, so that processes sharing the cache can record concurrently.
+  /// A resource is recorded at most once per tag by each UsageHistory, and
+  /// the number of sessions that used a resource is its use count.
+  class GZ_FUEL_TOOLS_VISIBLE UsageHistory
+  {
+    /// \brief Constructor.
+    /// \param[in] _dir Directory of the history files, created when the
+    /// first resource is recorded.
+    public: explicit UsageHistory(const std::string &_dir);
+
+    /// \brief Destructor.
+    public: ~UsageHistory();
+
+    /// \brief Record that a resource was used under a tag. Only the first
+    /// call for a resource and tag writes to the history.
+    /// \param[in] _tag Usage tag.
+    /// \param[in] _url URL of the model or world.
+    /// \return False if the tag or URL is empty, or the history couldn't
+    /// be written.
+    public: bool Record(const std::string &_tag, const std::string &_url);
+
+    /// \brief Get the resources used under a tag, most used first.
+    /// \param[in] _tag Usage tag.
+    /// \return URLs of the resources, empty if the tag is unknown.
+    public: std::vector<std::string> Resources(const std::string &_tag) const;
+
+    /// \brief Get the number of sessions that used each resource of a tag.
+    /// \param[in] _tag Usage tag.
+    /// \return Use counts by resource URL.
+    public: std::map<std::string, std::size_t> Counts(
+                const std::string &_tag) const;
+
+    /// \brief Get all the tags with a history.
+    /// \return Usage tags, sorted.
+    public: std::vector<std::string> Tags() const;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<UsageHistoryPrivate> dataPtr;
+  };
+}  // namespace gz::fuel_tools
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif  // GZ_FUEL_TOOLS_USAGEHISTORY_HH_
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "UsageHistory.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/////////////////////////////////////////////////
+class UsageHistoryTest : public ::testing::Test
+{
+  public: void SetUp() override
+  {
+    gz::common::Console::SetVerbosity(4);
+    tempDir = gz::common::testing::MakeTestTempDirectory();
+    ASSERT_TRUE(tempDir->Valid()) << tempDir->Path();
+    dir = common::joinPaths(tempDir->Path(), ".usage");
+  }
+
+  /// \brief Directory of the history files.
+  public: std::string dir;
+
+  /// \brief Temporary directory of the test.
+  public: std::shared_ptr<gz::common::TempDirectory> tempDir;
+};
+
+/////////////////////////////////////////////////
+TEST_F(UsageHistoryTest, Record)
+{
+  const std::string house =
+    "https://fuel.gazebosim.org/1.0/openrobotics/models/house";
+  const std::string tree =
+    "https://fuel.gazebosim.org/1.0/openrobotics/models/tree/2";
+
+  {
+    UsageHistory history(dir);
+    EXPECT_TRUE(history.Tags().empty());
+    EXPECT_TRUE(history.Resources("depot").empty());
+
+    EXPECT_FALSE(history.Record("", house));
+    EXPECT_FALSE(history.Record("depot", ""));
+    EXPECT_FALSE(history.Record("depot", "bad\nurl"));
+
+    EXPECT_TRUE(history.Record("depot", house));
+    EXPECT_TRUE(history.Record("depot", tree));
+
+    // Recorded once per session.
+    EXPECT_TRUE(history.Record("depot", house));
+    EXPECT_EQ(1u, history.Counts("depot")[house]);
+
+    EXPECT_TRUE(history.Record("my world/night", tree));
+  }
+
+  // A second session uses the tree again, which becomes the most used.
+  UsageHistory history(dir);
+  EXPECT_TRUE(history.Record("depot", tree));
+
+  auto resources = history.Resources("depot");
+  ASSERT_EQ(2u, resources.size());
+  EXPECT_EQ(tree, resources[0]);
+  EXPECT_EQ(house, resources[1]);
+  EXPECT_EQ(2u, history.Counts("depot")[tree]);
+
+  // Files with malformed escapes are skipped.
+  for (const std::string name : {"x%zz", "x%4", "x%", "x%+1"})
+    std::ofstream(common::joinPaths(dir, name + ".usage")) << "1\tother\n";
+
+  std::vector<std::string> tags{"depot", "my world/night"};
+  EXPECT_EQ(tags, history.Tags());
+  EXPECT_EQ(std::vector<std::string>{tree},
+      history.Resources("my world/night"));
+}
+
+/////////////////////////////////////////////////
+TEST_F(UsageHistoryTest, Compact)
+{
+  const std::string url =
+    "https://fuel.gazebosim.org/1.0/openrobotics/models/house";
+
+  for (int i = 0; i < 20; ++i)
+  {
+    UsageHistory history(dir);
+    EXPECT_TRUE(history.Record("depot", url));
+  }
+
+  UsageHistory history(dir);
+  EXPECT_EQ(20u, history.Counts("depot")[url]);
+
+  // The file was compacted along the way instead of holding 20 lines.
+  std::ifstream in(common::joinPaths(dir, "depot.usage"));
+  std::size_t lines = 0;
+  std::string line;
+  while (std::getline(in, line))
+    ++lines;
+  EXPECT_LE(lines, 5u);
+
+  // Malformed lines are ignored.
+  {
+    std::ofstream out(common::joinPaths(dir, "depot.usage"), std::ios::app);
+    out << "garbage\n" << "x\tother\n" << "3\t\n";
+  }
+  EXPECT_EQ(1u, history.Counts("depot").size());
+}
@@ -51,6 +51,12 @@ class WorldIdentifierPrivate
   /// \brief True indicates the world is private, false indicates the
   /// world is public.
   public: bool privacy{false};
+
+  /// \brief SHA-256 hash of the world archive, all zeros if unknown.
+  public: std::array<std::uint8_t, 32> sha256{};
+
+  /// \brief World archive size in bytes, 0 if unknown.
+  public: unsigned int fileSize{0};
 };
 
 //////////////////////////////////////////////////
@@ -199,6 +205,19 @@ bool WorldIdentifier::SetLocalPath(const std::string &_path)
   return true;
 }
 
+//////////////////////////////////////////////////
+std::array<std::uint8_t, 32> WorldIdentifier::SHA_256() const
+{
+  return this->dataPtr->sha256;
+}
+
+//////////////////////////////////////////////////
+bool WorldIdentifier::SHA_256(const std::array<std::uint8_t, 32> &_hash)
+{
+  this->dataPtr->sha256 = _hash;
+  return true;
+}
+
 //////////////////////////////////////////////////
 std::string WorldIdentifier::AsString(const std::string &_prefix) const
 {
@@ -255,4 +274,17 @@ void WorldIdentifier::SetPrivate(bool _private)
 {
   this->dataPtr->privacy = _private;
 }
+
+//////////////////////////////////////////////////
+unsigned int WorldIdentifier::FileSize() const
+{
+  return this->dataPtr->fileSize;
+}
+
+//////////////////////////////////////////////////
+bool WorldIdentifier::SetFileSize(const unsigned int _fileSize)
+{
+  this->dataPtr->fileSize = _fileSize;
+  return true;
+}
 }  // namespace gz::fuel_tools
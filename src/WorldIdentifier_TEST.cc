@@ -16,6 +16,8 @@
 */
 
 #include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
 #include <string>
 #include <gz/common/Console.hh>
 
@@ -43,6 +45,10 @@ TEST(WorldIdentifier, SetFields)
   EXPECT_TRUE(id.Private());
   id.SetPrivate(false);
   EXPECT_FALSE(id.Private());
+
+  EXPECT_EQ(0u, id.FileSize());
+  EXPECT_TRUE(id.SetFileSize(2048u));
+  EXPECT_EQ(2048u, id.FileSize());
 }
 
 /////////////////////////////////////////////////
@@ -108,11 +114,14 @@ TEST(WorldIdentifier, CopyConstructorDeepCopy)
   id.SetOwner("watermelon");
   EXPECT_FALSE(id.SetVersionStr("NaN"));
   EXPECT_TRUE(id.SetVersionStr(""));
+  EXPECT_EQ((std::array<std::uint8_t, 32>{}), id.SHA_256());
+  EXPECT_TRUE(id.SHA_256({1, 2, 3}));
 
   WorldIdentifier id2(id);
   EXPECT_EQ(std::string("hello"), id2.Name());
   EXPECT_EQ(std::string("watermelon"), id2.Owner());
   EXPECT_EQ("tip", id2.VersionStr());
+  EXPECT_EQ((std::array<std::uint8_t, 32>{1, 2, 3}), id2.SHA_256());
 
   id2.SetName("hello2");
   EXPECT_EQ(std::string("hello"), id.Name());
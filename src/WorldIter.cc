@@ -41,10 +41,11 @@ WorldIter WorldIterFactory::Create(const std::vector<WorldIdentifier> &_ids)
 
 //////////////////////////////////////////////////
 WorldIter WorldIterFactory::Create(const Rest &_rest,
-    const ServerConfig &_server, const std::string &_path)
+    const ServerConfig &_server, const std::string &_path,
+    const ResourceQuery &_query)
 {
   std::unique_ptr<WorldIterPrivate> priv(new WorldIterRestIds(
-    _rest, _server, _path));
+    _rest, _server, _path, _query));
   return WorldIter(std::move(priv));
 }
 
@@ -102,66 +103,58 @@ WorldIterRestIds::~WorldIterRestIds()
 
 //////////////////////////////////////////////////
 WorldIterRestIds::WorldIterRestIds(const Rest &_rest,
-    const ServerConfig &_config, const std::string &_path)
-  : config(_config), rest(_rest)
+    const ServerConfig &_config, const std::string &_path,
+    const ResourceQuery &_query)
+  : config(_config), rest(_rest),
+    path(std::regex_replace(_path, std::regex(R"(\\)"), "/")),
+    queryStrings(_query.QueryStrings())
+{
+  // Pages are fetched as the iterator advances, so that the first worlds
+  // can be used while the rest of the listing is still on the server.
+  this->FetchPage("");
+}
+
+//////////////////////////////////////////////////
+void WorldIterRestIds::FetchPage(const std::string &_page)
 {
   auto method = HttpMethod::GET;
-  this->config = _config;
   std::vector<std::string> headers = {"Accept: application/json"};
-  RestResponse resp;
-  std::vector<WorldIdentifier> worldIds;
-  this->ids.clear();
 
-  // Empty query string will get the first page of worlds.
-  std::string queryStrPage  = "";
-  std::string queryStrPageKey = "page=";
-  do
-  {
-    // Fire the request.
-    resp = this->rest.Request(method, this->config.Url().Str(),
-      this->config.Version(),
-      std::regex_replace(_path, std::regex(R"(\\)"), "/"),
-      {queryStrPage}, headers, "");
-
-    // Reset the query string
-    queryStrPage = "";
-
-    // Get the next page from the headers.
-    if (resp.headers.find("Link") != resp.headers.end())
-    {
-      std::vector<std::string> links = gz::common::split(
-          resp.headers["Link"], ",");
-      for (const auto &l : links)
-      {
-        // cppcheck-suppress useStlAlgorithm
-        if (l.find("next") != std::string::npos) {
-          auto start = l.find(queryStrPageKey);
-          auto end = l.find(">", start+1);
-          queryStrPage = l.substr(start, end-start);
-          break;
-        }
-      }
-    }
-
-    // Fallsafe - break if response code is invalid
-    if (resp.data == "null\n" || resp.statusCode != 200)
-    {
-      break;
-    }
-
-    // Parse the response.
-    worldIds = JSONParser::ParseWorlds(resp.data, this->config);
-
-    // Add the vector of worlds to the list.
-    this->ids.insert(std::end(this->ids), std::begin(worldIds),
-      std::end(worldIds));
-  } while (!worldIds.empty() && !queryStrPage.empty());
+  // The filters are pushed down to the server with every page request. No
+  // page parameter will get the first page of worlds.
+  std::vector<std::string> pageQueryStrs = this->queryStrings;
+  if (!_page.empty())
+    pageQueryStrs.push_back(_page);
 
-  if (this->ids.empty())
+  // Fire the request.
+  RestResponse resp = this->rest.Request(method, this->config.Url().Str(),
+    this->config.Version(), this->path, pageQueryStrs, headers, "");
+
+  this->ids.clear();
+  this->nextPage.clear();
+  this->idIter = this->ids.begin();
+
+  // Fallsafe - stop if response code is invalid
+  if (resp.data == "null\n" || resp.statusCode != 200)
     return;
 
+  // Get the next page from the headers. Only keep the page number,
+  // "per_page" also contains "page=".
+  static const std::regex pageRegex("[?&]page=([0-9]+)");
+  const std::string next = resp.headers.LinkUrl("next");
+  std::smatch match;
+  if (std::regex_search(next, match, pageRegex))
+    this->nextPage = "page=" + match[1].str();
+
+  // Parse the response.
+  this->ids = JSONParser::ParseWorlds(resp.data, this->config);
+  if (this->ids.empty())
+    this->nextPage.clear();
   this->idIter = this->ids.begin();
 
+  if (this->ids.empty())
+    return;
+
   // make first world
   this->worldId = *(this->idIter);
   this->worldId.SetServer(this->config);
@@ -175,14 +168,19 @@ void WorldIterRestIds::Next()
   // advance pointer
   ++(this->idIter);
 
+  // Request the next page once the current one is used up
+  if (this->idIter == this->ids.end() && !this->nextPage.empty())
+  {
+    this->FetchPage(this->nextPage);
+    return;
+  }
+
   // Update personal world class
   if (this->idIter != this->ids.end())
   {
     this->worldId = *(this->idIter);
     this->worldId.SetServer(this->config);
   }
-  // TODO(nkoenig) request next page if api is paginated here instead of in the
-  // constructor
 }
 
 //////////////////////////////////////////////////
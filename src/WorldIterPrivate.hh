@@ -23,6 +23,7 @@
 
 #include "gz/fuel_tools/ClientConfig.hh"
 #include "gz/fuel_tools/WorldIdentifier.hh"
+#include "gz/fuel_tools/ResourceQuery.hh"
 #include "gz/fuel_tools/RestClient.hh"
 
 #ifdef _WIN32
@@ -49,10 +50,14 @@ namespace gz::fuel_tools
     /// \param[in] _rest a REST request
     /// \param[in] _server The server to request the operation
     /// \param[in] _path The path to request
+    /// \param[in] _query Filters, sort order and page size sent to the
+    /// server with every page request.
     /// \return World iterator
     public: static WorldIter Create(const Rest &_rest,
                                     const ServerConfig &_server,
-                                    const std::string &_path);
+                                    const std::string &_path,
+                                    const ResourceQuery &_query =
+                                        ResourceQuery());
 
     /// \brief Create a world iterator that is empty
     /// \return An empty iterator
@@ -106,9 +111,11 @@ namespace gz::fuel_tools
     /// \param[in] _rest REST client
     /// \param[in] _server Server configuration
     /// \param[in] _path The path to request
+    /// \param[in] _query Filters, sort order and page size
     public: WorldIterRestIds(const Rest &_rest,
                              const ServerConfig &_server,
-                             const std::string &_path);
+                             const std::string &_path,
+                             const ResourceQuery &_query = ResourceQuery());
 
     /// \brief Destructor
     public: virtual ~WorldIterRestIds();
@@ -125,6 +132,20 @@ namespace gz::fuel_tools
     /// \brief RESTful client
     public: Rest rest;
 
+    /// \brief Fetch a page of worlds, replacing the current page.
+    /// \param[in] _page Page parameter, e.g. "page=2", empty for the first
+    /// page.
+    protected: void FetchPage(const std::string &_page);
+
+    /// \brief The path of the RESTful requests
+    protected: std::string path;
+
+    /// \brief Query parameters sent with every page request
+    protected: std::vector<std::string> queryStrings;
+
+    /// \brief Page parameter of the next page, empty on the last page
+    protected: std::string nextPage;
+
     /// \brief World identifiers in the current page
     protected: std::vector<WorldIdentifier> ids;
 
@@ -21,12 +21,17 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <utility>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 
 #include "gz/fuel_tools/Zip.hh"
 
+#include "BatchFileWriter.hh"
+#include "MappedFile.hh"
+#include "Sha256.hh"
+
 using namespace gz;
 using namespace fuel_tools;
 
@@ -109,9 +114,35 @@ bool Zip::Compress(const std::string &_src, const std::string &_dst)
   return true;
 }
 
+/////////////////////////////////////////////////
+/// \brief Open an archive held in memory. The memory isn't copied and
+/// must outlive the archive.
+/// \param[in] _data Content of the archive.
+/// \param[in] _size Size of the archive.
+/// \return The archive, null on error.
+static zip *OpenBuffer(const char *_data, std::size_t _size)
+{
+  zip_error_t error;
+  zip_error_init(&error);
+  zip_source_t *source = zip_source_buffer_create(_data, _size, 0, &error);
+  zip *archive = nullptr;
+  if (source)
+  {
+    archive = zip_open_from_source(source, ZIP_RDONLY, &error);
+    if (!archive)
+      zip_source_free(source);
+  }
+  if (!archive)
+    gzerr << "Error opening zip archive: " << zip_error_strerror(&error)
+          << std::endl;
+  zip_error_fini(&error);
+  return archive;
+}
+
 /////////////////////////////////////////////////
 bool Zip::Extract(const std::string &_src,
-    const std::string &_dst)
+    const std::string &_dst, bool _sync,
+    std::map<std::string, std::string> *_hashes)
 {
   if (!gz::common::exists(_src))
   {
@@ -119,13 +150,28 @@ bool Zip::Extract(const std::string &_src,
     return false;
   }
 
-  int err;
-  zip *archive = zip_open(_src.c_str(), 0, &err);
-  if (!archive)
+  // Map the archive rather than reading it through stdio buffers.
+  MappedFile file(_src);
+  if (!file.Valid())
   {
     gzerr << "Error opening zip archive: '" << _src << "'" << std::endl;
     return false;
   }
+  return ExtractBuffer(file.Data(), file.Size(), _dst, _sync, _hashes);
+}
+
+/////////////////////////////////////////////////
+bool Zip::ExtractBuffer(const char *_data, std::size_t _size,
+    const std::string &_dst, bool _sync,
+    std::map<std::string, std::string> *_hashes)
+{
+  zip *archive = OpenBuffer(_data, _size);
+  if (!archive)
+    return false;
+
+  // Archives often hold many small files, which are written in batches.
+  BatchFileWriter writer;
+  writer.SetSync(_sync);
 
   for (unsigned int i = 0; i < zip_get_num_entries(archive, 0); ++i)
   {
@@ -133,7 +179,8 @@ bool Zip::Extract(const std::string &_src,
     if (zip_stat_index(archive, i, 0, &sb) != 0)
     {
       gzerr << "Error get stats on archive index: " << i << std::endl;
-      continue;
+      zip_discard(archive);
+      return false;
     }
 
     auto entryname = std::string(sb.name);
@@ -148,6 +195,7 @@ bool Zip::Extract(const std::string &_src,
       {
         gzerr << "Error creating directory [" << dst << "]. "
                << "Do you have the right permissions?" << std::endl;
+        zip_discard(archive);
         return false;
       }
       continue;
@@ -158,39 +206,42 @@ bool Zip::Extract(const std::string &_src,
     if (!zf)
     {
       gzerr << "Error opening: " << sb.name << std::endl;
-      continue;
+      zip_discard(archive);
+      return false;
     }
 
-    std::ofstream file(dst);
-    int readSize = sb.size;
-    char *buf = new char[readSize];
-    int len = zip_fread(zf, buf, readSize);
+    // A short read means a truncated entry. Reading past the end checks
+    // the CRC of the entry.
+    std::string data(sb.size, '\0');
+    zip_int64_t len = zip_fread(zf, data.data(), sb.size);
+    char extra;
+    const bool valid = len == static_cast<zip_int64_t>(sb.size) &&
+      zip_fread(zf, &extra, 1) == 0;
+    zip_fclose(zf);
 
-    if (len <= 0)
-      gzerr << "Error reading " << sb.name << std::endl;
-    else
+    if (!valid)
     {
-      file.write(buf, len);
-      if (file.fail())
-      {
-        gzerr << "Failed to write file [" << dst << "]" << std::endl;
-      }
-      else
-      {
-        gzdbg << "Created file [" << dst << "]" << std::endl;
-      }
+      gzerr << "Error reading " << sb.name << std::endl;
+      zip_discard(archive);
+      return false;
     }
 
-    delete[] buf;
-    file.close();
-    zip_fclose(zf);
+    // Hash while the entry is still in memory.
+    if (_hashes)
+      (*_hashes)[sb.name] = Sha256::Hex(Sha256::Hash(data.data(), data.size()));
+    writer.Write(dst, std::move(data));
   }
 
+  // Failures are reported per file by the writer. Any of them fails the
+  // extraction, whatever the durability, as do the archive errors above,
+  // so that a partial tree is never published.
+  const bool written = writer.Flush();
+
   if (zip_close(archive) < 0)
   {
     gzerr << "Error closing zip archive" << std::endl;
     return false;
   }
 
-  return true;
+  return written;
 }
@@ -138,9 +138,13 @@ bool createNewEmptyFile(const std::string &_filename)
 #endif
 
 #include <gtest/gtest.h>
+#include <fstream>
+#include <map>
+#include <sstream>
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include "gz/fuel_tools/Zip.hh"
+#include "Sha256.hh"
 
 using namespace gz;
 using namespace fuel_tools;
@@ -195,3 +199,71 @@ TEST_F(ZipTest, CompressAndExtract)
   // Clean.
   gz::common::removeAll(newTempDir);
 }
+
+/////////////////////////////////////////////////
+/// \brief Test extracting from memory
+TEST_F(ZipTest, ExtractBuffer)
+{
+  std::string newTempDir;
+  ASSERT_TRUE(createAndSwitchToTempDir(newTempDir));
+  auto d = gz::common::joinPaths(newTempDir, "d1", "d2");
+  ASSERT_TRUE(gz::common::createDirectories(d));
+  auto f = gz::common::joinPaths(d, "new_file");
+
+  // Random content is stored as is by the compressor.
+  std::string content;
+  unsigned int seed = 1;
+  for (int i = 0; i < 10000; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    content.push_back(static_cast<char>(seed >> 24));
+  }
+  {
+    std::ofstream out(f, std::ios::binary);
+    out << content;
+  }
+
+  auto d1 = gz::common::joinPaths(newTempDir, "d1");
+  auto zipOutFile = gz::common::joinPaths(newTempDir, "new_file.zip");
+  ASSERT_TRUE(Zip::Compress(d1, zipOutFile));
+
+  std::string data;
+  {
+    std::ifstream in(zipOutFile, std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    data = ss.str();
+  }
+
+  // Extract from memory.
+  auto extractOutDir = gz::common::joinPaths(newTempDir, "extract");
+  std::map<std::string, std::string> hashes;
+  EXPECT_TRUE(Zip::ExtractBuffer(data.data(), data.size(), extractOutDir,
+      false, &hashes));
+  EXPECT_TRUE(gz::common::exists(
+      gz::common::joinPaths(extractOutDir, "d1", "d2", "new_file")));
+
+  // Files are hashed as they are extracted.
+  ASSERT_EQ(1u, hashes.count("d1/d2/new_file"));
+  EXPECT_EQ(Sha256::Hex(Sha256::Hash(content.data(), content.size())),
+      hashes["d1/d2/new_file"]);
+  EXPECT_FALSE(Zip::ExtractBuffer("not a zip", 9, extractOutDir));
+
+  // A file that can't be written fails the extraction, even when the files
+  // don't need to be durable.
+  auto blockedDir = gz::common::joinPaths(newTempDir, "blocked");
+  ASSERT_TRUE(gz::common::createDirectories(
+      gz::common::joinPaths(blockedDir, "d1", "d2", "new_file")));
+  EXPECT_FALSE(Zip::ExtractBuffer(data.data(), data.size(), blockedDir,
+      false));
+
+  // A corrupted entry is detected.
+  auto pos = data.find(content.substr(5000, 16));
+  ASSERT_NE(std::string::npos, pos);
+  data[pos] ^= 0x55;
+  EXPECT_FALSE(Zip::ExtractBuffer(data.data(), data.size(),
+      gz::common::joinPaths(newTempDir, "corrupt")));
+
+  // Clean.
+  gz::common::removeAll(newTempDir);
+}
@@ -26,6 +26,8 @@ download
 edit
 list
 meta
+prefetch
+search
 upload
 "
 
@@ -53,6 +55,7 @@ GZ_DOWNLOAD_COMPLETION_LIST="
   -c --config
   -h --help
   -j --jobs
+  -o --owner
   -t --type
   -u --url
   --force-version
@@ -91,6 +94,26 @@ GZ_META_COMPLETION_LIST="
   --versions
 "
 
+GZ_PREFETCH_COMPLETION_LIST="
+  --tag
+  -c --config
+  -h --help
+  -j --jobs
+  --force-version
+  --versions
+"
+
+GZ_SEARCH_COMPLETION_LIST="
+  --update
+  -c --config
+  -h --help
+  -n --limit
+  -r --raw
+  -u --url
+  --force-version
+  --versions
+"
+
 GZ_UPLOAD_COMPLETION_LIST="
   --header
   -c --config
@@ -142,6 +165,16 @@ function _gz_fuel_meta
   __get_comp_from_list "$GZ_META_COMPLETION_LIST"
 }
 
+function _gz_fuel_prefetch
+{
+  __get_comp_from_list "$GZ_PREFETCH_COMPLETION_LIST"
+}
+
+function _gz_fuel_search
+{
+  __get_comp_from_list "$GZ_SEARCH_COMPLETION_LIST"
+}
+
 function _gz_fuel_upload
 {
   __get_comp_from_list "$GZ_UPLOAD_COMPLETION_LIST"
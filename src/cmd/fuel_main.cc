@@ -0,0 +1,394 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Native entry point of the fuel command line tools. It exposes the same
+// subcommands as the Ruby plugin of `gz fuel`, see cmdfuel.rb.in, but calls
+// the functions of gz.hh directly, without starting an interpreter and
+// loading the library at run time. The help text and the options of both
+// are generated from src/cmd/CMakeLists.txt, see fuel_usage.hh.in.
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gz/fuel_tools/config.hh"
+#include "fuel_usage.hh"
+#include "gz.hh"
+
+//////////////////////////////////////////////////
+/// \brief Find the description of an option.
+/// \param[in] _name Name of the option, e.g. "-u" or "--url".
+/// \return The description, null if unknown.
+static const OptionSpec *FindOption(const std::string &_name)
+{
+  for (const auto &option : kOptions)
+  {
+    if ((option.shortName && _name == option.shortName) ||
+        _name == option.longName)
+    {
+      return &option;
+    }
+  }
+  return nullptr;
+}
+
+//////////////////////////////////////////////////
+/// \brief Parse the command line. Options may appear anywhere and take
+/// their argument from the next word, e.g. "--url URL", or from the same
+/// word, e.g. "--url=URL" or "-uURL".
+/// \param[in] _args Arguments following the subcommand.
+/// \param[out] _options Values by option key, with kDefaultOptions for
+/// the ones not given.
+/// \param[out] _words Arguments which are not options.
+/// \return False if an option is unknown or misses its argument.
+static bool ParseOptions(const std::vector<std::string> &_args,
+    std::map<std::string, std::string> &_options,
+    std::vector<std::string> &_words)
+{
+  _options = kDefaultOptions;
+
+  for (std::size_t i = 0; i < _args.size(); ++i)
+  {
+    const std::string &arg = _args[i];
+    if (arg.size() < 2 || arg[0] != '-')
+    {
+      _words.push_back(arg);
+      continue;
+    }
+
+    // Split the argument attached to the option, if any.
+    std::string name = arg;
+    std::string value;
+    bool attached = false;
+    if (arg[1] == '-')
+    {
+      auto eq = arg.find('=');
+      if (eq != std::string::npos)
+      {
+        name = arg.substr(0, eq);
+        value = arg.substr(eq + 1);
+        attached = true;
+      }
+    }
+    else if (arg.size() > 2)
+    {
+      name = arg.substr(0, 2);
+      value = arg.substr(2);
+      attached = true;
+    }
+
+    const OptionSpec *option = FindOption(name);
+    if (!option)
+    {
+      std::cerr << "invalid option: " << arg << std::endl;
+      return false;
+    }
+
+    if (option->argument == ArgumentType::NONE)
+    {
+      if (attached)
+      {
+        std::cerr << "needless argument: " << arg << std::endl;
+        return false;
+      }
+      value = option->implicitValue;
+    }
+    else if (!attached)
+    {
+      // An optional argument is only taken from the next word if that word
+      // isn't an option itself.
+      bool hasNext = i + 1 < _args.size() &&
+        (option->argument == ArgumentType::REQUIRED ||
+         _args[i + 1].empty() || _args[i + 1][0] != '-');
+      if (hasNext)
+      {
+        value = _args[++i];
+      }
+      else if (option->argument == ArgumentType::REQUIRED)
+      {
+        std::cerr << "missing argument: " << arg << std::endl;
+        return false;
+      }
+      else
+      {
+        value = option->implicitValue;
+      }
+    }
+    _options[option->key] = value;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get an option as a C string for the functions of gz.hh.
+/// \param[in] _options Parsed options.
+/// \param[in] _key Key of the option.
+/// \return The value, null if the option wasn't given and has no default.
+static const char *Arg(const std::map<std::string, std::string> &_options,
+    const std::string &_key)
+{
+  auto it = _options.find(_key);
+  return it == _options.end() ? nullptr : it->second.c_str();
+}
+
+//////////////////////////////////////////////////
+int main(int _argc, char **_argv)
+{
+  std::vector<std::string> args(_argv + 1, _argv + _argc);
+
+  // The usages end with a newline already.
+  if (!args.empty() && (args[0] == "-h" || args[0] == "--help"))
+  {
+    std::cout << kUsage << std::flush;
+    return 0;
+  }
+  if (!args.empty() && args[0] == "--versions")
+  {
+    std::cout << GZ_FUEL_TOOLS_VERSION_FULL << std::endl;
+    return 0;
+  }
+
+  if (args.empty() || kSubcommands.find(args[0]) == kSubcommands.end())
+  {
+    std::cout << kUsage << std::flush;
+    return -1;
+  }
+
+  const std::string subcommand = args[0];
+  const std::string &usage = kSubcommands.at(subcommand);
+  args.erase(args.begin());
+
+  std::map<std::string, std::string> options;
+  std::vector<std::string> words;
+  if (!ParseOptions(args, options, words))
+    return -1;
+
+  if (options.count("help"))
+  {
+    std::cout << usage << std::flush;
+    return 0;
+  }
+  if (options.count("versions"))
+  {
+    std::cout << GZ_FUEL_TOOLS_VERSION_FULL << std::endl;
+    return 0;
+  }
+  if (options.count("force-version") &&
+      options["force-version"] != GZ_FUEL_TOOLS_VERSION_FULL)
+  {
+    std::cout << "Version error: I cannot find this command in version ["
+              << options["force-version"] << "]." << std::endl;
+    return -1;
+  }
+
+  std::string query;
+  for (const auto &word : words)
+    query += (query.empty() ? "" : " ") + word;
+
+  // Parse the number of parallel downloads.
+  int jobs = subcommand == "prefetch" ? 4 : 1;
+  if (subcommand == "download" || subcommand == "prefetch")
+  {
+    if (options.count("jobs") && options["jobs"] == "auto")
+    {
+      // Zero selects the automatic concurrency mode.
+      jobs = 0;
+    }
+    else if (options.count("jobs"))
+    {
+      char *end = nullptr;
+      const char *str = options["jobs"].c_str();
+      long value = std::strtol(str, &end, 10);
+      if (end == str || *end != '\0' || value < 0)
+      {
+        std::cout << "The provided 'jobs' parameter " << options["jobs"]
+                  << " is not a non-negative integer" << std::endl;
+        return -1;
+      }
+      if (value > kMaxParallelJobs)
+      {
+        std::cout << "The specified number of jobs " << value
+                  << " exceeds the maximum of " << kMaxParallelJobs
+                  << std::endl;
+        return -1;
+      }
+      jobs = static_cast<int>(value);
+    }
+  }
+
+  // Check the required flags.
+  int limit = 20;
+  if (subcommand == "delete" || subcommand == "edit")
+  {
+    if (options["url"].empty())
+    {
+      std::cout << "Missing resource URL (e.g. --url "
+                << "https://fuel.gazebosim.org/1.0/OpenRobotics/models/"
+                << "Ambulance)." << std::endl;
+      return -1;
+    }
+  }
+  else if (subcommand == "download")
+  {
+    if (options["url"].empty() && options["owner"].empty())
+    {
+      std::cout << "Missing resource URL (e.g. --url "
+                << "https://fuel.gazebosim.org/1.0/OpenRobotics/models/"
+                << "Ambulance) or owner (e.g. --owner OpenRobotics)."
+                << std::endl;
+      return -1;
+    }
+
+    if (options.count("type") && options["type"] != "model" &&
+        options["type"] != "world")
+    {
+      std::cout << "Invalid resource type, use 'model' or 'world'."
+                << std::endl;
+      return -1;
+    }
+  }
+  else if (subcommand == "list")
+  {
+    if (!options.count("type"))
+    {
+      std::cout << "Missing resource type (e.g. --type model)." << std::endl;
+      return -1;
+    }
+    if (options["type"] != "model" && options["type"] != "world")
+    {
+      std::cout << "Invalid resource type, use 'model' or 'world'."
+                << std::endl;
+      return -1;
+    }
+  }
+  else if (subcommand == "prefetch")
+  {
+    if (options["tag"].empty())
+    {
+      std::cout << "Missing usage tag (e.g. --tag my_world)." << std::endl;
+      return -1;
+    }
+  }
+  else if (subcommand == "search")
+  {
+    if (query.find_first_not_of(" \t") == std::string::npos)
+    {
+      std::cout << "Missing search words (e.g. gz fuel search office chair)."
+                << std::endl;
+      return -1;
+    }
+    char *end = nullptr;
+    const char *str = options["limit"].c_str();
+    long value = std::strtol(str, &end, 10);
+    if (end == str || *end != '\0' || value < 0)
+    {
+      std::cout << "The provided 'limit' parameter " << options["limit"]
+                << " is not a non-negative integer" << std::endl;
+      return -1;
+    }
+    limit = static_cast<int>(value);
+  }
+  else if (subcommand == "upload")
+  {
+    if (options["model"].empty())
+    {
+      std::cout << "Missing model path." << std::endl;
+      return -1;
+    }
+    if (options["url"].empty())
+    {
+      std::cout << "Missing URL (e.g. --url https://fuel.gazebosim.org)."
+                << std::endl;
+      return -1;
+    }
+  }
+
+  cmdVerbosity(options["verbose"].c_str());
+
+  int result = 1;
+  if (subcommand == "configure")
+  {
+    result = configure(Arg(options, "defaults"), Arg(options, "console"));
+  }
+  else if (subcommand == "delete")
+  {
+    result = deleteUrl(Arg(options, "url"), Arg(options, "header"));
+  }
+  else if (subcommand == "download")
+  {
+    if (!options["owner"].empty())
+    {
+      result = downloadOwner(Arg(options, "owner"), Arg(options, "url"),
+          Arg(options, "config"), jobs);
+    }
+    else
+    {
+      result = downloadUrl(Arg(options, "url"), Arg(options, "config"),
+          Arg(options, "header"), Arg(options, "type"), jobs);
+    }
+  }
+  else if (subcommand == "edit")
+  {
+    result = editUrl(Arg(options, "url"), Arg(options, "header"),
+        Arg(options, "private"), Arg(options, "model"));
+  }
+  else if (subcommand == "list")
+  {
+    if (options["type"] == "model")
+    {
+      result = listModels(Arg(options, "url"), Arg(options, "owner"),
+          Arg(options, "raw"), Arg(options, "config"));
+    }
+    else
+    {
+      result = listWorlds(Arg(options, "url"), Arg(options, "owner"),
+          Arg(options, "raw"), Arg(options, "config"));
+    }
+  }
+  else if (subcommand == "meta")
+  {
+    if (!options["config2pbtxt"].empty())
+      result = config2Pbtxt(Arg(options, "config2pbtxt"));
+    else if (!options["pbtxt2config"].empty())
+      result = pbtxt2Config(Arg(options, "pbtxt2config"));
+  }
+  else if (subcommand == "prefetch")
+  {
+    result = prefetch(Arg(options, "tag"), Arg(options, "config"), jobs);
+  }
+  else if (subcommand == "search")
+  {
+    result = searchModels(query.c_str(), Arg(options, "url"),
+        Arg(options, "update"), Arg(options, "raw"), Arg(options, "config"),
+        limit);
+  }
+  else if (subcommand == "upload")
+  {
+    result = upload(Arg(options, "model"), Arg(options, "url"),
+        Arg(options, "header"), Arg(options, "private"),
+        Arg(options, "owner"));
+  }
+  else if (subcommand == "update")
+  {
+    result = update(Arg(options, "onlymodels"), Arg(options, "onlyworlds"),
+        Arg(options, "header"));
+  }
+
+  return result ? 0 : -1;
+}
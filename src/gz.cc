@@ -30,6 +30,7 @@
 #endif
 
 #include <csignal>
+#include <cstdlib>
 #include <exception>
 
 #include <gz/msgs/fuel_metadata.pb.h>
@@ -38,10 +39,13 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <fstream>
 #include <future>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <utility>
@@ -50,8 +54,11 @@
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/SignalHandler.hh>
+#include <gz/common/StringUtils.hh>
 #include <gz/common/URI.hh>
+#include <gz/common/Util.hh>
 
+#include "gz/fuel_tools/CancellationToken.hh"
 #include "gz/fuel_tools/ClientConfig.hh"
 #include "gz/fuel_tools/CollectionIdentifier.hh"
 #include "gz/fuel_tools/config.hh"
@@ -464,18 +471,49 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int listWorlds(const char *_url,
 }
 
 //////////////////////////////////////////////////
-extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadUrl(const char *_url,
-    const char *_configFile, const char *_header, const char *_type, int _jobs)
+/// \brief Add a callback for SIGTERM and SIGINT. Ctrl-C doesn't work without
+/// it. The first signal cancels the client operations, so transfers in
+/// flight abort and clean up after themselves. A second one exits at once.
+/// \param[in] _handler Signal handler to add the callback to.
+/// \param[in] _cancellation Token cancelled by the first signal.
+static void cancelOnSignal(gz::common::SignalHandler &_handler,
+    gz::fuel_tools::CancellationToken _cancellation)
 {
-  // Add signal handler for SIGTERM and SIGINT. Ctrl-C doesn't work without this
-  // handler.
-  gz::common::SignalHandler sigHandler;
-  sigHandler.AddCallback([&](int _sig) {
+  _handler.AddCallback([_cancellation](int _sig) mutable {
       if (SIGTERM == _sig || SIGINT == _sig)
       {
-        std::exit(1);
+        if (_cancellation.Cancelled())
+          std::_Exit(1);
+        _cancellation.Cancel();
       }
   });
+}
+
+//////////////////////////////////////////////////
+/// \brief Print the summary of a bulk download.
+/// \param[in] _stats Statistics of the download.
+static void printStats(const gz::fuel_tools::BulkDownloadStats &_stats)
+{
+  const double seconds =
+    std::chrono::duration<double>(_stats.elapsed).count();
+  const double megabytes = static_cast<double>(_stats.bytes) / 1e6;
+  std::cout << "Downloaded " << _stats.downloaded << " of " << _stats.listed
+            << " resources (" << _stats.skipped << " already cached, "
+            << _stats.failed << " failed): " << std::fixed
+            << std::setprecision(1) << megabytes << " MB in " << seconds
+            << " s";
+  if (seconds > 0)
+    std::cout << " (" << megabytes / seconds << " MB/s)";
+  std::cout << std::defaultfloat << std::endl;
+}
+
+//////////////////////////////////////////////////
+extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadUrl(const char *_url,
+    const char *_configFile, const char *_header, const char *_type, int _jobs)
+{
+  gz::fuel_tools::CancellationToken cancellation;
+  gz::common::SignalHandler sigHandler;
+  cancelOnSignal(sigHandler, cancellation);
   std::string urlStr{_url};
   gz::common::URI url(urlStr);
   if (!url.Valid())
@@ -495,6 +533,7 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadUrl(const char *_url,
   conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
 
   gz::fuel_tools::FuelClient client(conf);
+  client.SetCancellationToken(cancellation);
   gz::fuel_tools::ModelIdentifier model;
   gz::fuel_tools::WorldIdentifier world;
   gz::fuel_tools::CollectionIdentifier collection;
@@ -588,62 +627,178 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadUrl(const char *_url,
       }
     }
 
-    std::vector<gz::fuel_tools::ModelIdentifier> modelIds;
-    std::vector<gz::fuel_tools::WorldIdentifier> worldIds;
-
-    if (downloadModels)
+    // The listing and the downloads overlap, items start downloading as
+    // soon as their page of the listing is received. Cached models and
+    // dependencies, which collections often share, aren't downloaded again.
+    auto result = client.DownloadCollection(collection, downloadModels,
+        downloadWorlds, _jobs, gz::fuel_tools::DownloadPriority::NORMAL,
+        gz::fuel_tools::CacheCheck::PINNED);
+    if (!result && result.Type() != gz::fuel_tools::ResultType::CANCELLED)
     {
-      // Get list of model identifiers in collection
-      auto modelsIter = client.Models(collection);
-      for (; modelsIter; ++modelsIter)
-      {
-        modelIds.push_back(modelsIter->Identification());
-      }
-      gzmsg << "Found " << modelIds.size() << " models in collection ["
-        << collection.Name() << "]" << std::endl;
+      std::cout << "Failed to download collection [" << collection.Name()
+        << "], either it has no items or some downloads failed."
+        << std::endl;
+      return false;
     }
 
-    if (downloadWorlds)
+    // Report how the automatic concurrency mode adjusted the transfers.
+    if (_jobs == 0)
     {
-      // Get list of world identifiers in collection
-      auto worldIter = client.Worlds(collection);
-      for (; worldIter; ++worldIter)
+      for (const auto &decision : client.DownloadStatistics().decisions)
       {
-        worldIds.push_back(worldIter);
+        gzdbg << "Parallel transfers " << decision.previousLimit << " -> "
+              << decision.limit << " (" << decision.reason << ")"
+              << std::endl;
       }
-      gzmsg << "Found " << worldIds.size() << " worlds in collection ["
-        << collection.Name() << "]" << std::endl;
     }
+  }
+  else
+  {
+    std::cout << "Invalid URL: only models and worlds or collections can be "
+              << "downloaded so far." << std::endl;
+    return false;
+  }
 
-    const std::size_t totalItemCount = modelIds.size() + worldIds.size();
-    if (totalItemCount == 0)
-    {
-      std::cout << "There are no items in collection [" << collection.Name()
-        << "]" << std::endl;
-      return false;
-    }
+  if (cancellation.Cancelled())
+  {
+    std::cout << "Download cancelled." << std::endl;
+    return false;
+  }
+
+  if (gz::common::Console::Verbosity() >= 3)
+  {
+    std::cout << "Download succeeded." << std::endl;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadOwner(const char *_owner,
+    const char *_url, const char *_configFile, int _jobs)
+{
+  gz::fuel_tools::CancellationToken cancellation;
+  gz::common::SignalHandler sigHandler;
+  cancelOnSignal(sigHandler, cancellation);
+
+  std::string owner{_owner ? _owner : ""};
+  if (owner.empty())
+  {
+    std::cout << "Download failed: missing owner" << std::endl;
+    return false;
+  }
+
+  std::string urlStr{_url ? _url : ""};
+  if (!urlStr.empty() && !gz::common::URI::Valid(urlStr))
+  {
+    std::cout << "Invalid URL [" << urlStr << "]" << std::endl;
+    return false;
+  }
 
-    if (downloadModels)
+  // Client
+  gz::fuel_tools::ClientConfig conf;
+  if (_configFile && strlen(_configFile) > 0)
+  {
+    conf.Clear();
+    conf.LoadConfig(_configFile);
+  }
+
+  if (!urlStr.empty())
+  {
+    conf.Clear();
+    gz::fuel_tools::ServerConfig serverConf;
+    serverConf.SetUrl(gz::common::URI(urlStr, true));
+    conf.AddServer(serverConf);
+  }
+
+  conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
+
+  gz::fuel_tools::FuelClient client(conf);
+  client.SetCancellationToken(cancellation);
+
+  bool success = true;
+  for (const auto &server : conf.Servers())
+  {
+    if (gz::common::Console::Verbosity() >= 3)
     {
-      auto result = client.DownloadModels(modelIds, _jobs);
+      std::cout << "Downloading everything by [" << owner << "] from "
+                << server.Url().Str() << std::endl;
     }
 
-    if (downloadWorlds)
+    gz::fuel_tools::BulkDownloadStats stats;
+    auto result = client.DownloadOwner(server, owner, stats, _jobs);
+    printStats(stats);
+
+    if (result.Type() == gz::fuel_tools::ResultType::CANCELLED)
     {
-      auto result = client.DownloadWorlds(worldIds, _jobs);
+      std::cout << "Download cancelled." << std::endl;
+      return false;
     }
+    success = success && result;
   }
-  else
+
+  if (!success)
   {
-    std::cout << "Invalid URL: only models and worlds or collections can be "
-              << "downloaded so far." << std::endl;
+    std::cout << "Download failed." << std::endl;
     return false;
   }
 
   if (gz::common::Console::Verbosity() >= 3)
-  {
     std::cout << "Download succeeded." << std::endl;
+  return true;
+}
+
+//////////////////////////////////////////////////
+extern "C" GZ_FUEL_TOOLS_VISIBLE int prefetch(const char *_tag,
+    const char *_configFile, int _jobs)
+{
+  gz::fuel_tools::CancellationToken cancellation;
+  gz::common::SignalHandler sigHandler;
+  cancelOnSignal(sigHandler, cancellation);
+
+  std::string tag{_tag ? _tag : ""};
+  if (tag.empty())
+  {
+    std::cout << "Prefetch failed: missing usage tag" << std::endl;
+    return false;
+  }
+
+  // Client
+  gz::fuel_tools::ClientConfig conf;
+  if (_configFile && strlen(_configFile) > 0)
+  {
+    conf.Clear();
+    conf.LoadConfig(_configFile);
+  }
+  conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
+
+  gz::fuel_tools::FuelClient client(conf);
+  client.SetCancellationToken(cancellation);
+
+  if (gz::common::Console::Verbosity() >= 3)
+  {
+    std::cout << "Prefetching the resources used by [" << tag << "]"
+              << std::endl;
+    for (const auto &url : client.UsedResources(tag))
+      std::cout << "  " << url << std::endl;
+  }
+
+  gz::fuel_tools::BulkDownloadStats stats;
+  auto result = client.Prefetch(tag, stats, _jobs);
+  printStats(stats);
+
+  if (result.Type() == gz::fuel_tools::ResultType::CANCELLED)
+  {
+    std::cout << "Prefetch cancelled." << std::endl;
+    return false;
   }
+  if (!result)
+  {
+    std::cout << "Prefetch failed." << std::endl;
+    return false;
+  }
+
+  if (gz::common::Console::Verbosity() >= 3)
+    std::cout << "Prefetch succeeded." << std::endl;
   return true;
 }
 
@@ -658,16 +813,18 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int upload(const char *_path,
     const char *_url, const char *_header, const char *_private,
     const char *_owner)
 {
+  // Cancel the upload in flight and skip the remaining models on a signal.
   gz::common::SignalHandler handler;
-  bool sigKilled{false};
-  handler.AddCallback([&sigKilled](const int)
+  gz::fuel_tools::CancellationToken cancellation;
+  handler.AddCallback([&cancellation](const int)
   {
-    sigKilled = true;
+    cancellation.Cancel();
   });
 
   gz::fuel_tools::ClientConfig conf;
   conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
   gz::fuel_tools::FuelClient client(conf);
+  client.SetCancellationToken(cancellation);
   gz::fuel_tools::ModelIdentifier model;
 
   // Set the server URL, if present.
@@ -711,7 +868,7 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int upload(const char *_path,
   // that the given path is a directory containing multiple models.
   gz::common::DirIter dirIter(_path);
   gz::common::DirIter end;
-  while (!sigKilled && dirIter != end)
+  while (!cancellation.Cancelled() && dirIter != end)
   {
     if (gz::common::isDirectory(*dirIter) &&
         (gz::common::exists(
@@ -896,15 +1053,9 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int editUrl(
 extern "C" GZ_FUEL_TOOLS_VISIBLE int update(
     const char *_onlyModels, const char *_onlyWorlds, const char *_header)
 {
-  // Add signal handler for SIGTERM and SIGINT. Ctrl-C doesn't work without this
-  // handler.
+  gz::fuel_tools::CancellationToken cancellation;
   gz::common::SignalHandler sigHandler;
-  sigHandler.AddCallback([&](int _sig) {
-      if (SIGTERM == _sig || SIGINT == _sig)
-      {
-        std::exit(1);
-      }
-  });
+  cancelOnSignal(sigHandler, cancellation);
 
   bool onlyModelsBool = false;
   if (_onlyModels && std::strlen(_onlyModels) != 0)
@@ -924,6 +1075,7 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int update(
   conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
 
   gz::fuel_tools::FuelClient client(conf);
+  client.SetCancellationToken(cancellation);
 
   // Headers
   std::vector<std::string> headers;
@@ -938,3 +1090,274 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int update(
   }
   return 1;
 }
+
+//////////////////////////////////////////////////
+extern "C" GZ_FUEL_TOOLS_VISIBLE int searchModels(const char *_query,
+    const char *_url, const char *_update, const char *_raw,
+    const char *_configFile, int _limit)
+{
+  std::string urlStr{_url ? _url : ""};
+  if (!urlStr.empty() && !gz::common::URI::Valid(urlStr))
+  {
+    std::cout << "Invalid URL [" << urlStr << "]" << std::endl;
+    return 0;
+  }
+
+  bool updateBool = false;
+  if (_update && std::strlen(_update) != 0)
+  {
+    std::string str = gz::common::lowercase(_update);
+    updateBool = str == "1" || str == "true";
+  }
+  bool pretty = !_raw || gz::common::lowercase(_raw) != "true";
+
+  // Client
+  gz::fuel_tools::ClientConfig conf;
+  if (_configFile && strlen(_configFile) > 0)
+  {
+    conf.Clear();
+    conf.LoadConfig(_configFile);
+  }
+
+  if (!urlStr.empty())
+  {
+    conf.Clear();
+    gz::fuel_tools::ServerConfig serverConf;
+    serverConf.SetUrl(gz::common::URI(urlStr, true));
+    conf.AddServer(serverConf);
+  }
+
+  conf.SetUserAgent("FuelTools " GZ_FUEL_TOOLS_VERSION_FULL);
+
+  gz::fuel_tools::FuelClient client(conf);
+
+  if (updateBool)
+  {
+    for (const auto &server : conf.Servers())
+    {
+      if (pretty)
+      {
+        std::cout << "Indexing models of " << server.Url().Str() << "..."
+                  << std::endl;
+      }
+      if (!client.UpdateSearchIndex(server))
+        return 0;
+    }
+  }
+
+  auto startTime = std::chrono::high_resolution_clock::now();
+  auto results = client.SearchModels(_query ? _query : "",
+      _limit > 0 ? static_cast<std::size_t>(_limit) : 0u);
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::high_resolution_clock::now() - startTime);
+
+  for (const auto &id : results)
+  {
+    if (!pretty)
+    {
+      std::cout << id.Url().Str() << std::endl;
+      continue;
+    }
+
+    std::cout << "\033[1m" << id.Owner() << "/" << id.Name() << "\033[0m"
+              << " (" << id.Server().Url().Str() << ")" << std::endl;
+    std::string description = id.Description().substr(0, 100);
+    std::replace(description.begin(), description.end(), '\n', ' ');
+    if (!description.empty())
+      std::cout << "    " << description << std::endl;
+  }
+
+  if (pretty)
+  {
+    std::cout << results.size() << " models found (took " << duration.count()
+              << "ms)." << std::endl;
+    if (results.empty() && !updateBool)
+      std::cout << "Use --update to refresh the search index." << std::endl;
+  }
+
+  return 1;
+}
+
+//////////////////////////////////////////////////
+/// \brief Format a string as a YAML scalar, quoting it when needed.
+/// \param[in] _str String to format.
+/// \return The scalar.
+static std::string yamlScalar(const std::string &_str)
+{
+  bool plain = !_str.empty() &&
+    _str.find_first_of("#'\"{}[],&*!|>%@`") == std::string::npos &&
+    _str.find(": ") == std::string::npos &&
+    _str.front() != ' ' && _str.back() != ' ' && _str.back() != ':' &&
+    _str.front() != '-' && _str.front() != '?';
+  if (plain)
+    return _str;
+
+  std::string quoted = "'";
+  for (char c : _str)
+  {
+    if (c == '\'')
+      quoted += '\'';
+    quoted += c;
+  }
+  return quoted + "'";
+}
+
+//////////////////////////////////////////////////
+/// \brief Read a line from the standard input.
+/// \param[in] _prompt Text printed before reading.
+/// \param[in] _default Value returned for an empty line.
+/// \return The line, or the default. Nothing if the input ended or was
+/// interrupted.
+static std::optional<std::string> prompt(const std::string &_prompt,
+    const std::string &_default)
+{
+  std::cout << _prompt << std::flush;
+  std::string line;
+  if (!std::getline(std::cin, line))
+  {
+    std::cout << std::endl;
+    return std::nullopt;
+  }
+  if (!line.empty() && line.back() == '\r')
+    line.pop_back();
+  return line.empty() ? _default : line;
+}
+
+//////////////////////////////////////////////////
+extern "C" GZ_FUEL_TOOLS_VISIBLE int configure(const char *_defaults,
+    const char *_console)
+{
+  const bool defaults = _defaults && gz::common::lowercase(_defaults) == "true";
+  const bool console = _console && gz::common::lowercase(_console) == "true";
+
+  std::string home;
+  gz::common::env(GZ_HOMEDIR, home);
+  const std::string localFuelDir = gz::common::joinPaths(home, ".gz", "fuel");
+  const std::string configPath =
+    gz::common::joinPaths(localFuelDir, "config.yaml");
+  const std::string defaultUrl = "https://fuel.gazebosim.org";
+
+  if (!console)
+  {
+    std::cout << "# Set Fuel server configurations.\n"
+              << "# This will create or replace `" << configPath << "`.\n\n";
+  }
+
+  struct Server
+  {
+    std::string name;
+    std::string url;
+    std::string token;
+    std::string cache;
+  };
+  std::vector<Server> servers;
+
+  // Allow the user to enter multiple Fuel servers.
+  std::optional<std::string> confirmation = "n";
+  do
+  {
+    Server server{"Fuel", defaultUrl, "", localFuelDir};
+    if (!defaults)
+    {
+      // Repeat until the URL is valid, or the user hits ctrl-c.
+      while (true)
+      {
+        auto url = prompt("Fuel server URL [" + defaultUrl + "]: ",
+            defaultUrl);
+        if (!url)
+          return 0;
+        server.url = *url;
+        if (gz::common::URI::Valid(server.url))
+          break;
+        std::cout << "Invalid URL.\n";
+      }
+      gz::common::URI uri(server.url);
+      std::string defaultName = server.url;
+      if (uri.Authority() && !uri.Authority()->Host().empty())
+        defaultName = uri.Authority()->Host();
+
+      auto token = prompt("Optional access token [None]: ", "");
+      if (!token)
+        return 0;
+      server.token = *token;
+
+      auto cache = prompt("Local cache path [" + localFuelDir + "]: ",
+          localFuelDir);
+      if (!cache)
+        return 0;
+      server.cache = *cache;
+
+      auto name = prompt("Name this server [" + defaultName + "]: ",
+          defaultName);
+      if (!name)
+        return 0;
+      server.name = *name;
+    }
+    servers.push_back(server);
+
+    if (!defaults)
+    {
+      confirmation = prompt("\nAdd another Fuel server? [y/N]:", "n");
+      if (!confirmation)
+        return 0;
+      confirmation = gz::common::lowercase(*confirmation);
+    }
+  } while (*confirmation == "y");
+
+  if (!defaults && !console)
+  {
+    std::cout << "\nReview:\n";
+    for (const auto &server : servers)
+    {
+      std::cout << "    Name: " << server.name << "\n"
+                << "    URL: " << server.url << "\n"
+                << "    Cache: " << server.cache << "\n"
+                << "    Access token: " << server.token << "\n";
+      if (servers.size() > 1)
+        std::cout << "\n";
+    }
+  }
+
+  confirmation = "y";
+  if (!defaults && !console)
+  {
+    confirmation = prompt("Save? [Y/n]:", "y");
+    if (!confirmation)
+      return 0;
+    confirmation = gz::common::lowercase(*confirmation);
+  }
+
+  if (*confirmation != "y")
+  {
+    std::cout << "Settings not saved." << std::endl;
+    return 1;
+  }
+
+  std::ostringstream config;
+  config << "---\nservers:\n";
+  for (const auto &server : servers)
+  {
+    config << "- name: " << yamlScalar(server.name) << "\n"
+           << "  url: " << yamlScalar(server.url) << "\n"
+           << "  private-token: " << yamlScalar(server.token) << "\n"
+           << "  cache:\n"
+           << "    path: " << yamlScalar(server.cache) << "\n";
+  }
+
+  if (console)
+  {
+    std::cout << config.str();
+    return 1;
+  }
+
+  gz::common::createDirectories(localFuelDir);
+  std::ofstream file(configPath);
+  file << config.str();
+  if (!file.good())
+  {
+    std::cerr << "Failed to write [" << configPath << "]." << std::endl;
+    return 0;
+  }
+  std::cout << "Settings saved to ~/.gz/fuel/config.yaml." << std::endl;
+  return 1;
+}
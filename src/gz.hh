@@ -58,6 +58,7 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int listWorlds(
 /// \param[in] _header An HTTP header.
 /// \param[in] _type Type of resource to download from collection
 /// \param[in] _jobs Number of parallel jobs for downloading collections.
+/// Zero selects the automatic concurrency mode.
 /// \return 1 if successful, 0 if not.
 extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadUrl(
     const char *_url = nullptr, const char *_configFile = nullptr,
@@ -137,4 +138,52 @@ extern "C" GZ_FUEL_TOOLS_VISIBLE int update(
     const char *_onlyModels = nullptr, const char *_onlyWorlds = nullptr,
     const char *_header = nullptr);
 
+/// \brief External hook to execute 'gz fuel download -o owner' from the
+/// command line.
+/// \param[in] _owner Owner whose models and worlds are downloaded.
+/// \param[in] _url Optional server URL.
+/// \param[in] _configFile Path to a YAML configuration file.
+/// \param[in] _jobs Number of parallel downloads, 0 for automatic.
+/// \return 1 if successful, 0 if not.
+extern "C" GZ_FUEL_TOOLS_VISIBLE int downloadOwner(
+    const char *_owner, const char *_url = nullptr,
+    const char *_configFile = nullptr, int _jobs = 1);
+
+/// \brief External hook to execute 'gz fuel prefetch --tag tag' from the
+/// command line. The resources recorded under the tag, see
+/// ClientConfig::SetUsageTag, are downloaded at background priority unless
+/// already cached.
+/// \param[in] _tag Usage tag, such as a world or job name.
+/// \param[in] _configFile Path to a YAML configuration file.
+/// \param[in] _jobs Number of parallel downloads, 0 for automatic.
+/// \return 1 if successful, 0 if not.
+extern "C" GZ_FUEL_TOOLS_VISIBLE int prefetch(
+    const char *_tag, const char *_configFile = nullptr, int _jobs = 4);
+
+/// \brief External hook to execute 'gz fuel search [options] query' from
+/// the command line. The search runs over the offline indexes of the
+/// servers, see FuelClient::UpdateSearchIndex.
+/// \param[in] _query Words to look for.
+/// \param[in] _url Optional server URL.
+/// \param[in] _update "1" to refresh the indexes from the servers first.
+/// \param[in] _raw 'true' for machine readable output.
+/// \param[in] _configFile Path to a YAML configuration file.
+/// \param[in] _limit Maximum number of results, 0 for no limit.
+/// \return 1 if successful, 0 if not.
+extern "C" GZ_FUEL_TOOLS_VISIBLE int searchModels(
+    const char *_query, const char *_url = nullptr,
+    const char *_update = nullptr, const char *_raw = "false",
+    const char *_configFile = nullptr, int _limit = 20);
+
+/// \brief External hook to execute 'gz fuel configure' from the command
+/// line, which creates ~/.gz/fuel/config.yaml. The servers are read from
+/// the standard input.
+/// \param[in] _defaults "true" to use the default server without
+/// prompting.
+/// \param[in] _console "true" to print the configuration instead of saving
+/// it.
+/// \return 1 if successful, 0 if not.
+extern "C" GZ_FUEL_TOOLS_VISIBLE int configure(
+    const char *_defaults = nullptr, const char *_console = nullptr);
+
 #endif
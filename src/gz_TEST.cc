@@ -168,3 +168,21 @@ TEST(CmdLine,
 
   EXPECT_EQ(output.find(expected), 0);
 }
+
+#ifdef GZ_FUEL_EXE
+/////////////////////////////////////////////////
+// The native front-end parses the command line and reports its errors like
+// the ruby script.
+TEST(CmdLine, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(NativeParity))
+{
+  for (const std::string args : {"download -h", "list", "list -t banana",
+      "download", "download -u url -t banana", "download -u url --jobs=-1",
+      "download -u url -j 99", "prefetch", "search", "search chair -n none",
+      "upload", "delete", "edit", "configure --defaults --console"})
+  {
+    const std::string suffix = " " + args + " --force-version " + g_version;
+    EXPECT_EQ(custom_exec_str(g_exec + " fuel" + suffix),
+              custom_exec_str(std::string(GZ_FUEL_EXE) + suffix)) << args;
+  }
+}
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+#include "BatchOrder.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of parallel jobs, as used by DownloadModels.
+static constexpr std::size_t kJobs = 8;
+
+/// \brief Simulated link speed of each job, in bytes per second.
+static constexpr double kBytesPerSecond = 10e6;
+
+/// \brief Simulated request latency of each item, in seconds.
+static constexpr double kLatency = 0.2;
+
+/////////////////////////////////////////////////
+/// \brief Time until the last of _jobs workers is done, if each of them
+/// takes the next item in _order as soon as it's free.
+double makespan(const std::vector<std::uint64_t> &_sizes,
+    const std::vector<std::size_t> &_order, std::size_t _jobs)
+{
+  std::priority_queue<double, std::vector<double>, std::greater<double>>
+      freeAt;
+  for (std::size_t i = 0; i < _jobs; ++i)
+    freeAt.push(0.0);
+
+  double end = 0.0;
+  for (auto index : _order)
+  {
+    double start = freeAt.top();
+    freeAt.pop();
+    double done = start + kLatency + _sizes[index] / kBytesPerSecond;
+    end = std::max(end, done);
+    freeAt.push(done);
+  }
+  return end;
+}
+
+/////////////////////////////////////////////////
+// Compare the time to download a skewed batch, many small models and a few
+// large worlds listed last, in listing order and largest first.
+TEST(BatchOrder, SkewedMakespan)
+{
+  std::vector<std::uint64_t> sizes;
+  for (int i = 0; i < 400; ++i)
+    sizes.push_back((1 + i % 5) * 1000000u);
+  for (int i = 0; i < 6; ++i)
+    sizes.push_back(400000000u);
+
+  std::vector<std::size_t> listing(sizes.size());
+  std::iota(listing.begin(), listing.end(), 0u);
+
+  double listed = makespan(sizes, listing, kJobs);
+  double largest = makespan(sizes, largestFirst(sizes), kJobs);
+
+  // No schedule is faster than the largest item, or than the total work
+  // spread evenly over the jobs.
+  double total = 0.0;
+  for (auto size : sizes)
+    total += kLatency + size / kBytesPerSecond;
+  double bound = std::max(total / kJobs,
+      kLatency + *std::max_element(sizes.begin(), sizes.end()) /
+      kBytesPerSecond);
+
+  std::cout << sizes.size() << " items, " << kJobs << " jobs\n"
+            << "  lower bound:   " << bound << " s\n"
+            << "  listing order: " << listed << " s\n"
+            << "  largest first: " << largest << " s" << std::endl;
+
+  EXPECT_LT(largest, listed);
+  EXPECT_LE(largest, bound * 4.0 / 3.0);
+}
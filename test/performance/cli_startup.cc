@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "gz/fuel_tools/config.hh"
+
+/// \brief Number of invocations per front-end.
+static constexpr int kRuns = 20;
+
+/////////////////////////////////////////////////
+/// \brief Get the median wall time of a command.
+/// \param[in] _cmd Command to run, its output is discarded.
+/// \return Median time in milliseconds, negative on failure.
+static double MedianMilliseconds(const std::string &_cmd)
+{
+  std::vector<double> samples;
+  for (int i = 0; i < kRuns; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    if (std::system((_cmd + " > /dev/null 2>&1").c_str()) != 0)
+      return -1;
+    samples.push_back(std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count());
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+/////////////////////////////////////////////////
+// Compare the latency of a short command, which converts a model.config
+// without network access, through the native front-end and through the
+// Ruby plugin of `gz fuel`. Both go through the same library function, so
+// the difference is the startup cost of each front-end.
+TEST(CliStartup, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(Latency))
+{
+  auto tempDir = gz::common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid());
+
+  const std::string config =
+    gz::common::joinPaths(tempDir->Path(), "model.config");
+  std::ofstream out(config);
+  out << "<?xml version=\"1.0\"?>\n"
+      << "<model>\n"
+      << "  <name>Startup</name>\n"
+      << "  <version>1.0</version>\n"
+      << "  <sdf version=\"1.6\">model.sdf</sdf>\n"
+      << "  <description>Startup benchmark</description>\n"
+      << "</model>\n";
+  out.close();
+
+  const std::string args = " meta --config2pbtxt " + config;
+
+  double native = MedianMilliseconds(std::string(GZ_FUEL_EXE) + args);
+  ASSERT_GT(native, 0);
+  std::cout << "Median of " << kRuns << " runs of [meta --config2pbtxt]\n"
+            << "  native: " << native << " ms" << std::endl;
+
+  const std::string gz = GZ_PATH;
+  if (gz.empty() || gz.find("NOTFOUND") != std::string::npos)
+  {
+    GTEST_SKIP() << "gz not found, skipping the Ruby front-end.";
+  }
+
+  double ruby = MedianMilliseconds(gz + " fuel" + args +
+      " --force-version " + GZ_FUEL_TOOLS_VERSION_FULL);
+  ASSERT_GT(ruby, 0);
+  std::cout << "  ruby:   " << ruby << " ms" << std::endl;
+}
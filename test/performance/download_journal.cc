@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+
+#include "DownloadJournal.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of resources of the batch, a large collection.
+static constexpr int kItems = 2000;
+
+/////////////////////////////////////////////////
+// Measure the cost of journaling a large batch download, each resource
+// being planned, started and completed, and of reading the journal back
+// when the batch is resumed.
+TEST(DownloadJournal, Overhead)
+{
+  common::Console::SetVerbosity(1);
+
+  auto tempDir = common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid());
+  const std::string dir = common::joinPaths(tempDir->Path(), ".downloads");
+  const std::string batch =
+    "collection:fuel.gazebosim.org/openrobotics/collections/depot:models";
+
+  auto item = [](int _i)
+  {
+    return "model:fuel.gazebosim.org/openrobotics/models/model_" +
+      std::to_string(_i) + "@tip";
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  {
+    DownloadJournal journal(dir, batch);
+    for (int i = 0; i < kItems; ++i)
+      ASSERT_TRUE(journal.Plan(item(i)));
+    for (int i = 0; i < kItems; ++i)
+    {
+      ASSERT_TRUE(journal.Start(item(i)));
+      // Stop half way through the batch.
+      if (i < kItems / 2)
+      {
+        ASSERT_TRUE(journal.Complete(item(i)));
+      }
+    }
+  }
+  double writeSeconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  DownloadJournal journal(dir, batch);
+  double readSeconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(static_cast<std::size_t>(kItems), journal.PlannedCount());
+  EXPECT_EQ(static_cast<std::size_t>(kItems / 2), journal.CompletedCount());
+  EXPECT_EQ(static_cast<std::size_t>(kItems / 2), journal.Pending().size());
+
+  std::cout << "Journaling " << kItems << " resources\n"
+            << "  per resource: " << writeSeconds / kItems * 1e6
+            << " us\n"
+            << "  resume:       " << readSeconds * 1e3 << " ms"
+            << std::endl;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+#include <gz/common/URI.hh>
+
+#include "gz/fuel_tools/ClientConfig.hh"
+#include "gz/fuel_tools/ServerConfig.hh"
+#include "gz/fuel_tools/WorldIdentifier.hh"
+#include "gz/fuel_tools/Zip.hh"
+
+#include "LocalCache.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of files per resource.
+static constexpr int kFiles = 500;
+
+/// \brief Size of each file in bytes.
+static constexpr int kFileSize = 8 * 1024;
+
+/// \brief Number of installs per policy.
+static constexpr int kInstalls = 20;
+
+/////////////////////////////////////////////////
+// Compare the install throughput of the durability policies. Run it on the
+// filesystem of the deployment, e.g. by pointing TMPDIR to it, the cost of
+// flushing depends heavily on the storage.
+TEST(Durability, InstallThroughput)
+{
+  // Logging every file would dominate the measurements.
+  common::Console::SetVerbosity(1);
+
+  auto tempDir = common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid());
+
+  const std::string src = common::joinPaths(tempDir->Path(), "world");
+  ASSERT_TRUE(common::createDirectories(src));
+  for (int i = 0; i < kFiles; ++i)
+  {
+    std::ofstream out(common::joinPaths(src, std::to_string(i) + ".dae"));
+    out << std::string(kFileSize, 'a' + i % 26);
+  }
+
+  const std::string zip = common::joinPaths(tempDir->Path(), "world.zip");
+  ASSERT_TRUE(Zip::Compress(src, zip));
+  std::ifstream in(zip, std::ios::binary);
+  std::stringstream data;
+  data << in.rdbuf();
+
+  ServerConfig server;
+  server.SetUrl(common::URI("https://fuel.gazebosim.org", true));
+
+  std::cout << "Installing " << kInstalls << " worlds of " << kFiles
+            << " files of " << kFileSize << " bytes" << std::endl;
+
+  for (auto [policy, name] : {
+      std::make_pair(DurabilityPolicy::NONE, "none"),
+      std::make_pair(DurabilityPolicy::BATCHED, "batched"),
+      std::make_pair(DurabilityPolicy::PER_FILE, "per_file")})
+  {
+    ClientConfig config;
+    config.Clear();
+    config.SetCacheLocation(common::joinPaths(tempDir->Path(), name));
+    config.SetDurability(policy);
+    LocalCache cache(&config);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kInstalls; ++i)
+    {
+      WorldIdentifier id;
+      id.SetServer(server);
+      id.SetOwner("owner");
+      id.SetName("world");
+      id.SetVersion(i + 1);
+      ASSERT_TRUE(cache.SaveWorld(id, data.str(), true));
+    }
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "  " << name << ": " << kInstalls / seconds
+              << " installs/s, " << kInstalls * kFiles / seconds
+              << " files/s" << std::endl;
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/testing/TestPaths.hh>
+#include <gz/common/Util.hh>
+
+#include "gz/fuel_tools/Zip.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of files in the archive.
+static constexpr int kFiles = 20000;
+
+/// \brief Number of files per directory.
+static constexpr int kFilesPerDir = 500;
+
+/// \brief Number of measurements per configuration.
+static constexpr int kRuns = 3;
+
+/////////////////////////////////////////////////
+/// \brief Get the median extraction throughput of an archive.
+/// \param[in] _zip Archive to extract.
+/// \param[in] _dir Directory to extract into.
+/// \return Median number of files per second, negative on failure.
+static double MedianFilesPerSecond(const std::string &_zip,
+    const std::string &_dir)
+{
+  std::vector<double> samples;
+  for (int i = 0; i < kRuns; ++i)
+  {
+    const std::string dst = common::joinPaths(_dir, std::to_string(i));
+    auto start = std::chrono::steady_clock::now();
+    if (!Zip::Extract(_zip, dst))
+      return -1;
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    samples.push_back(kFiles / seconds);
+    common::removeAll(dst);
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+/////////////////////////////////////////////////
+// Compare the extraction throughput of an archive made of many small files,
+// typical of meshes split in tiles or of texture sets, with batched io_uring
+// writes and with regular writes.
+TEST(ExtractSmallFiles, FilesPerSecond)
+{
+  // Logging every file would dominate the measurements.
+  common::Console::SetVerbosity(1);
+
+  auto tempDir = common::testing::MakeTestTempDirectory();
+  ASSERT_TRUE(tempDir->Valid());
+
+  const std::string src = common::joinPaths(tempDir->Path(), "model");
+  for (int i = 0; i < kFiles; ++i)
+  {
+    const std::string dir =
+      common::joinPaths(src, "dir" + std::to_string(i / kFilesPerDir));
+    if (i % kFilesPerDir == 0)
+    {
+      ASSERT_TRUE(common::createDirectories(dir));
+    }
+    std::ofstream out(common::joinPaths(dir, std::to_string(i) + ".txt"));
+    out << std::string(64 + i % 2048, 'x');
+  }
+
+  const std::string zip = common::joinPaths(tempDir->Path(), "model.zip");
+  ASSERT_TRUE(Zip::Compress(src, zip));
+  common::removeAll(src);
+
+  const std::string dst = common::joinPaths(tempDir->Path(), "extract");
+  common::unsetenv("GZ_FUEL_DISABLE_IO_URING");
+  double batched = MedianFilesPerSecond(zip, dst);
+  common::setenv("GZ_FUEL_DISABLE_IO_URING", "1");
+  double regular = MedianFilesPerSecond(zip, dst);
+  common::unsetenv("GZ_FUEL_DISABLE_IO_URING");
+
+  ASSERT_GT(batched, 0);
+  ASSERT_GT(regular, 0);
+
+  std::cout << "Extracting " << kFiles << " files, median of " << kRuns
+            << " runs\n"
+            << "  batched: " << batched << " files/s\n"
+            << "  regular: " << regular << " files/s" << std::endl;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gz/fuel_tools/RestClient.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of requests issued by each run.
+static constexpr int kRequests = 1000;
+
+/// \brief Number of threads issuing requests concurrently.
+static constexpr int kThreads = 16;
+
+/////////////////////////////////////////////////
+/// \brief Issue kRequests small GET requests from kThreads threads.
+/// \param[in] _rest REST client.
+/// \param[in] _url Server URL.
+/// \param[out] _failures Number of requests that didn't return 200.
+/// \return Wall time taken by all the requests.
+static std::chrono::duration<double> RunRequests(const Rest &_rest,
+    const std::string &_url, int &_failures)
+{
+  std::atomic<int> next{0};
+  std::atomic<int> failures{0};
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&]()
+    {
+      while (next++ < kRequests)
+      {
+        RestResponse resp = _rest.Request(HttpMethod::GET, _url, "", "", {},
+            {}, "");
+        if (resp.statusCode != 200)
+          ++failures;
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  _failures = failures;
+  return std::chrono::steady_clock::now() - start;
+}
+
+/////////////////////////////////////////////////
+// Compare many small concurrent requests over HTTP/1.1 and HTTP/2.
+// Point GZ_FUEL_TEST_H2_URL to an HTTPS endpoint of a local HTTP/2 capable
+// server returning a small body, e.g. `nghttpd 8443 key.pem cert.pem`
+// serving a tiny file, or any reverse proxy with HTTP/2 enabled.
+TEST(Http2Requests, SmallRequests)
+{
+  const char *url = std::getenv("GZ_FUEL_TEST_H2_URL");
+  if (!url)
+    GTEST_SKIP() << "GZ_FUEL_TEST_H2_URL is not set";
+
+  Rest http1;
+  int http1Failures = 0;
+  auto http1Time = RunRequests(http1, url, http1Failures);
+
+  Rest http2;
+  http2.SetHttp2(true);
+  int http2Failures = 0;
+  auto http2Time = RunRequests(http2, url, http2Failures);
+
+  EXPECT_EQ(0, http1Failures);
+  EXPECT_EQ(0, http2Failures);
+
+  std::cout << kRequests << " requests, " << kThreads << " threads\n"
+            << "  HTTP/1.1: " << http1Time.count() << " s ("
+            << kRequests / http1Time.count() << " req/s)\n"
+            << "  HTTP/2:   " << http2Time.count() << " s ("
+            << kRequests / http2Time.count() << " req/s)" << std::endl;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/fuel_tools/JSONParser.hh"
+#include "gz/fuel_tools/ModelIdentifier.hh"
+#include "gz/fuel_tools/ServerConfig.hh"
+
+#include "ModelIterPrivate.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of identifiers to serialize.
+static constexpr int kIdentifiers = 100000;
+
+/////////////////////////////////////////////////
+// Compare the serialization throughput of a large catalog with one
+// BuildModel call per identifier, which builds a JSON document for each of
+// them, and with a single streaming WriteModels call.
+TEST(JsonWriter, IdentifiersPerSecond)
+{
+  common::Console::SetVerbosity(1);
+
+  std::vector<ModelIdentifier> ids;
+  ids.reserve(kIdentifiers);
+  for (int i = 0; i < kIdentifiers; ++i)
+  {
+    ModelIdentifier id;
+    id.SetOwner("owner" + std::to_string(i % 100));
+    id.SetName("model_" + std::to_string(i));
+    id.SetVersion(1 + i % 7);
+    id.SetDescription("A \"test\" model\nwith a description of moderate "
+        "length, as found in most catalogs.");
+    ids.push_back(id);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::string dom = "[";
+  for (size_t i = 0; i < ids.size(); ++i)
+  {
+    if (i > 0)
+      dom += ",";
+    dom += JSONParser::BuildModel(ModelIterFactory::Create({ids[i]}));
+  }
+  dom += "]";
+  double domSeconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  std::ostringstream out;
+  ASSERT_TRUE(JSONParser::WriteModels(ModelIterFactory::Create(ids), out));
+  double streamSeconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(static_cast<size_t>(kIdentifiers),
+      JSONParser::ParseModels(out.str(), ServerConfig()).size());
+
+  std::cout << "Serializing " << kIdentifiers << " identifiers\n"
+            << "  BuildModel:  " << kIdentifiers / domSeconds << " ids/s, "
+            << dom.size() << " bytes\n"
+            << "  WriteModels: " << kIdentifiers / streamSeconds << " ids/s, "
+            << out.str().size() << " bytes" << std::endl;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gz/common/URI.hh>
+
+#include "gz/fuel_tools/ClientConfig.hh"
+#include "gz/fuel_tools/FuelClient.hh"
+#include "gz/fuel_tools/RestClient.hh"
+#include "gz/fuel_tools/ServerConfig.hh"
+
+using namespace gz;
+using namespace fuel_tools;
+
+/// \brief Number of measurements per configuration.
+static constexpr int kRuns = 5;
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+/// \brief Measure the latency of the first request of a fresh process.
+/// Name resolution, TLS sessions and HTTP/2 connections are cached process
+/// wide, so every measurement runs in its own child process.
+/// \param[in] _url Server URL.
+/// \param[in] _http2 True to use HTTP/2 mode.
+/// \param[in] _warmup True to warm up the connection before the request.
+/// \return Latency of the first request in milliseconds, negative on
+/// failure.
+static double FirstRequest(const std::string &_url, bool _http2,
+    bool _warmup)
+{
+  int fds[2];
+  if (pipe(fds) != 0)
+    return -1;
+
+  pid_t pid = fork();
+  if (pid == 0)
+  {
+    close(fds[0]);
+    ServerConfig server;
+    server.SetUrl(common::URI(_url));
+    ClientConfig config;
+    config.Clear();
+    config.AddServer(server);
+    config.SetHttp2(_http2);
+
+    Rest rest;
+    rest.SetHttp2(_http2);
+    FuelClient client(config, rest);
+    if (_warmup)
+      client.Warmup();
+
+    auto start = std::chrono::steady_clock::now();
+    RestResponse resp = rest.Request(HttpMethod::GET, _url, "", "", {}, {},
+        "");
+    double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    if (resp.statusCode != 200)
+      ms = -1;
+    ssize_t written = write(fds[1], &ms, sizeof(ms));
+    _exit(written == sizeof(ms) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  double ms = -1;
+  if (pid < 0 || read(fds[0], &ms, sizeof(ms)) != sizeof(ms))
+    ms = -1;
+  close(fds[0]);
+  if (pid > 0)
+    waitpid(pid, nullptr, 0);
+  return ms;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the median of kRuns measurements.
+/// \param[in] _url Server URL.
+/// \param[in] _http2 True to use HTTP/2 mode.
+/// \param[in] _warmup True to warm up the connection before the request.
+/// \return Median latency in milliseconds, negative on failure.
+static double MedianFirstRequest(const std::string &_url, bool _http2,
+    bool _warmup)
+{
+  std::vector<double> samples;
+  for (int i = 0; i < kRuns; ++i)
+  {
+    double ms = FirstRequest(_url, _http2, _warmup);
+    if (ms < 0)
+      return -1;
+    samples.push_back(ms);
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+#endif
+
+/////////////////////////////////////////////////
+// Compare the latency of the first request with and without warming up the
+// connection. Point GZ_FUEL_TEST_WARMUP_URL to a small resource on a
+// remote HTTPS server, e.g. https://fuel.gazebosim.org/1.0/licenses, so that
+// name resolution and handshakes weigh in.
+TEST(Warmup, FirstRequestLatency)
+{
+#ifdef _WIN32
+  GTEST_SKIP() << "Requires fork()";
+#else
+  const char *url = std::getenv("GZ_FUEL_TEST_WARMUP_URL");
+  if (!url)
+    GTEST_SKIP() << "GZ_FUEL_TEST_WARMUP_URL is not set";
+
+  for (bool http2 : {false, true})
+  {
+    double cold = MedianFirstRequest(url, http2, false);
+    double warm = MedianFirstRequest(url, http2, true);
+    ASSERT_GE(cold, 0);
+    ASSERT_GE(warm, 0);
+    EXPECT_LT(warm, cold);
+
+    std::cout << (http2 ? "HTTP/2" : "HTTP/1.1")
+              << " first request, median of " << kRuns << " runs\n"
+              << "  cold:      " << cold << " ms\n"
+              << "  warmed up: " << warm << " ms" << std::endl;
+  }
+#endif
+}